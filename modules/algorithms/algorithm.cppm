@@ -5,11 +5,14 @@
  */
 
 module;
+#include <cstddef>
 #include <functional>
+#include <iterator>
 
 export module j:algorithm;
 
 import :heap_algo;
+import :sort_algo;
 
 namespace j {
 export template <std::random_access_iterator Iter, class Compare> void make_heap(Iter first, Iter last, Compare comp) {
@@ -35,4 +38,114 @@ export template <std::random_access_iterator Iter, class Compare> void pop_heap(
 export template <std::random_access_iterator Iter> void pop_heap(Iter first, Iter last) {
     _pop_heap(first, last, std::less<>());
 }
+
+// d-ary heap variants, e.g. j::make_heap<4>(first, last); all calls on one heap must use the same arity.
+// Kept as separate overloads so that unqualified calls without an arity resolve exactly as before.
+export template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+void make_heap(Iter first, Iter last, Compare comp) {
+    _make_heap<Arity>(first, last, comp);
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter> void make_heap(Iter first, Iter last) {
+    _make_heap<Arity>(first, last, std::less<>());
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+void push_heap(Iter first, Iter last, Compare comp) {
+    _push_heap<Arity>(first, last, comp);
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter> void push_heap(Iter first, Iter last) {
+    _push_heap<Arity>(first, last, std::less<>());
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+void pop_heap(Iter first, Iter last, Compare comp) {
+    _pop_heap<Arity>(first, last, comp);
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter> void pop_heap(Iter first, Iter last) {
+    _pop_heap<Arity>(first, last, std::less<>());
+}
+
+// batch operations, see _push_heap_range/_pop_heap_n
+export template <std::random_access_iterator Iter, class Compare>
+void push_heap_range(Iter first, Iter middle, Iter last, Compare comp) {
+    _push_heap_range(first, middle, last, comp);
+}
+
+export template <std::random_access_iterator Iter> void push_heap_range(Iter first, Iter middle, Iter last) {
+    _push_heap_range(first, middle, last, std::less<>());
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+void push_heap_range(Iter first, Iter middle, Iter last, Compare comp) {
+    _push_heap_range<Arity>(first, middle, last, comp);
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter>
+void push_heap_range(Iter first, Iter middle, Iter last) {
+    _push_heap_range<Arity>(first, middle, last, std::less<>());
+}
+
+export template <std::random_access_iterator Iter, class Compare>
+void pop_heap_n(Iter first, Iter last, std::iter_difference_t<Iter> k, Compare comp) {
+    _pop_heap_n(first, last, k, comp);
+}
+
+export template <std::random_access_iterator Iter>
+void pop_heap_n(Iter first, Iter last, std::iter_difference_t<Iter> k) {
+    _pop_heap_n(first, last, k, std::less<>());
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+void pop_heap_n(Iter first, Iter last, std::iter_difference_t<Iter> k, Compare comp) {
+    _pop_heap_n<Arity>(first, last, k, comp);
+}
+
+export template <std::size_t Arity, std::random_access_iterator Iter>
+void pop_heap_n(Iter first, Iter last, std::iter_difference_t<Iter> k) {
+    _pop_heap_n<Arity>(first, last, k, std::less<>());
+}
+
+// Pattern-defeating quicksort: introsort-like with O(n log n) worst case (heapsort after too many bad pivots), linear
+// on sorted, reversed and all-equal inputs, and a branchless block partition for arithmetic values under
+// std::less/std::greater. Not stable.
+export template <std::random_access_iterator Iter, class Compare> void sort(Iter first, Iter last, Compare comp) {
+    _sort(first, last, comp);
+}
+
+export template <std::random_access_iterator Iter> void sort(Iter first, Iter last) {
+    std::less<> comp;
+    _sort(first, last, comp);
+}
+
+// Stable LSD radix sort by an integer or float/double key: the elements themselves, or key(element). Each pass
+// sorts by DigitBits bits of the key; 8 suits short ranges, 11 or 16 saves passes on long ranges of 32/64-bit keys.
+// Uses a scratch j::vector of the range's length. Floats order as by their sign and magnitude bits: -0.0 before
+// 0.0, negative NaNs first and positive NaNs last.
+export template <std::size_t DigitBits = 8, std::random_access_iterator Iter>
+    requires _radix_key_type<std::iter_value_t<Iter>>
+void radix_sort(Iter first, Iter last) {
+    std::identity key;
+    _radix_sort<DigitBits>(first, last, key);
+}
+
+export template <std::size_t DigitBits = 8, std::random_access_iterator Iter, class KeyFn>
+void radix_sort(Iter first, Iter last, KeyFn key) {
+    _radix_sort<DigitBits>(first, last, key);
+}
+
+// Sorts the N elements at first (N a power of two) with a bitonic sorting network: a fixed sequence of
+// compare-exchanges, independent of the data. With AVX2, blocks of 8, 16 or 32 int32_t/uint32_t/float in contiguous
+// memory under std::less/std::greater are sorted inside vector registers; float blocks must not contain NaNs.
+export template <std::size_t N, std::random_access_iterator Iter, class Compare>
+void sort_network(Iter first, Compare comp) {
+    _network_sort<N>(first, comp);
+}
+
+export template <std::size_t N, std::random_access_iterator Iter> void sort_network(Iter first) {
+    std::less<> comp;
+    _network_sort<N>(first, comp);
+}
 } // namespace j
\ No newline at end of file
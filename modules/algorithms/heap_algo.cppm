@@ -5,6 +5,8 @@
  */
 
 module;
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 
 #if defined(__clang__)
@@ -14,19 +16,41 @@ module j:heap_algo;
 #endif
 
 namespace j {
-template <std::random_access_iterator Iter, class Compare>
+// All heap routines take the heap arity as their first template argument (2 is the classic binary heap).
+// Node i has children Arity * i + 1 ... Arity * i + Arity and parent (i - 1) / Arity; wider nodes make the heap
+// shallower and keep the children compared at each level next to each other in memory.
+
+// index of the preferred child among the (at most Arity) children starting at first_child
+template <std::size_t Arity, std::random_access_iterator Iter, class Compare>
+std::ptrdiff_t _best_child(Iter first, std::ptrdiff_t first_child, std::ptrdiff_t distance, Compare &comp) {
+    auto best = first_child;
+    if constexpr (Arity == 2) {
+        if (first_child + 1 < distance && comp(first[first_child], first[first_child + 1])) {
+            ++best; // right
+        }
+    } else {
+        const auto last_child = std::min<std::ptrdiff_t>(first_child + Arity, distance);
+        for (auto child = first_child + 1; child < last_child; ++child) {
+            if (comp(first[best], first[child])) {
+                best = child;
+            }
+        }
+    }
+    return best;
+}
+
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
 void _heapify(Iter first, std::ptrdiff_t parent, std::ptrdiff_t distance, Compare comp) {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
     auto value = std::move(first[parent]);
     auto hole = parent;
 
     while (true) {
-        auto child = 2 * hole + 1; // left
+        auto child = static_cast<std::ptrdiff_t>(Arity) * hole + 1; // leftmost
         if (child >= distance)
             break;
 
-        if (child + 1 < distance && comp(first[child], first[child + 1])) {
-            ++child; // right
-        }
+        child = _best_child<Arity>(first, child, distance, comp);
 
         if (!comp(value, first[child]))
             break;
@@ -37,36 +61,44 @@ void _heapify(Iter first, std::ptrdiff_t parent, std::ptrdiff_t distance, Compar
     first[hole] = std::move(value);
 }
 
-template <std::random_access_iterator Iter, class Compare> void _make_heap(Iter first, Iter last, Compare comp) {
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
+void _make_heap(Iter first, Iter last, Compare comp) {
     const auto distance = std::distance(first, last);
     if (distance < 2)
         return;
-    for (auto i = distance / 2 - 1; i >= 0; --i) {
-        _heapify(first, i, distance, comp);
+    for (auto i = (distance - 2) / static_cast<std::ptrdiff_t>(Arity); i >= 0; --i) {
+        _heapify<Arity>(first, i, distance, comp);
     }
 }
 
-template <std::random_access_iterator Iter, class Compare> void _push_heap(Iter first, Iter last, Compare comp) {
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
+void _push_heap(Iter first, Iter last, Compare comp) {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
     auto distance = std::distance(first, last);
     if (distance < 2)
         return;
 
     auto hole = distance - 1;
     auto value = std::move(first[hole]);
-    auto parent = (hole - 1) / 2;
+    auto parent = (hole - 1) / static_cast<std::ptrdiff_t>(Arity);
 
     while (hole > 0 && comp(first[parent], value)) {
         first[hole] = std::move(first[parent]);
         hole = parent;
         if (hole == 0)
             break;
-        parent = (hole - 1) / 2;
+        parent = (hole - 1) / static_cast<std::ptrdiff_t>(Arity);
     }
 
     first[hole] = std::move(value);
 }
 
-template <std::random_access_iterator Iter, class Compare> void _pop_heap(Iter first, Iter last, Compare comp) {
+// Floyd's bottom-up deletion: the hole left by the top walks down to a leaf along the preferred children without
+// comparing against the displaced last element, which is then sifted up from that leaf. The last element almost
+// always belongs near the bottom, so this needs about half the comparisons of the top-down sift.
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
+void _pop_heap(Iter first, Iter last, Compare comp) {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
     const auto distance = std::distance(first, last);
     if (distance < 2)
         return;
@@ -78,21 +110,105 @@ template <std::random_access_iterator Iter, class Compare> void _pop_heap(Iter f
     const auto limit = distance - 1;
 
     while (true) {
-        auto child = 2 * hole + 1;
+        auto child = static_cast<std::ptrdiff_t>(Arity) * hole + 1;
         if (child >= limit)
             break;
 
-        if (child + 1 < limit && comp(first[child], first[child + 1])) {
-            ++child;
+        child = _best_child<Arity>(first, child, limit, comp);
+        first[hole] = std::move(first[child]);
+        hole = child;
+    }
+
+    while (hole > 0) {
+        const auto parent = (hole - 1) / static_cast<std::ptrdiff_t>(Arity);
+        if (!comp(first[parent], value))
+            break;
+        first[hole] = std::move(first[parent]);
+        hole = parent;
+    }
+
+    first[hole] = std::move(value);
+}
+
+// [first, middle) is a heap and [middle, last) are new elements.
+// A few elements are sifted up one by one; a larger batch re-heapifies only the ancestors of the new elements,
+// level by level (a partial make_heap), so the untouched part of the heap is never visited.
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
+void _push_heap_range(Iter first, Iter middle, Iter last, Compare comp) {
+    const auto n = std::distance(first, middle);
+    const auto k = std::distance(middle, last);
+    if (k == 0)
+        return;
+
+    if (k < n / 8) {
+        for (auto i = n + 1; i <= n + k; ++i) {
+            _push_heap<Arity>(first, first + i, comp);
+        }
+        return;
+    }
+
+    // every ancestor of a new element is reached by walking the index range [lo, hi] up one level at a time;
+    // a node is always sifted down again after any of its children was
+    const auto distance = n + k;
+    auto lo = n;
+    auto hi = distance - 1;
+    while (hi > 0) {
+        lo = lo > 0 ? (lo - 1) / static_cast<std::ptrdiff_t>(Arity) : 0;
+        hi = (hi - 1) / static_cast<std::ptrdiff_t>(Arity);
+        for (auto i = hi; i >= lo; --i) {
+            _heapify<Arity>(first, i, distance, comp);
         }
+    }
+}
+
+// Pops the top k elements: afterwards [last - k, last) holds them in ascending order (the former top at last - 1)
+// and [first, last - k) is a heap.
+template <std::size_t Arity = 2, std::random_access_iterator Iter, class Compare>
+void _pop_heap_n(Iter first, Iter last, std::ptrdiff_t k, Compare comp) {
+    k = std::min<std::ptrdiff_t>(k, std::distance(first, last));
+    for (std::ptrdiff_t i = 0; i < k; ++i, --last) {
+        _pop_heap<Arity>(first, last, comp);
+    }
+}
+
+// Sifts for heaps whose elements track their own position (indexed priority queues):
+// moved(element, index) is called for every element that lands at a new index, including the sifted one.
+template <std::size_t Arity, std::random_access_iterator Iter, class Compare, class Moved>
+std::ptrdiff_t _sift_up_tracked(Iter first, std::ptrdiff_t hole, Compare &comp, Moved &moved) {
+    auto value = std::move(first[hole]);
+    while (hole > 0) {
+        const auto parent = (hole - 1) / static_cast<std::ptrdiff_t>(Arity);
+        if (!comp(first[parent], value))
+            break;
+        first[hole] = std::move(first[parent]);
+        moved(first[hole], hole);
+        hole = parent;
+    }
+    first[hole] = std::move(value);
+    moved(first[hole], hole);
+    return hole;
+}
+
+template <std::size_t Arity, std::random_access_iterator Iter, class Compare, class Moved>
+std::ptrdiff_t _sift_down_tracked(Iter first, std::ptrdiff_t hole, std::ptrdiff_t distance, Compare &comp,
+                                  Moved &moved) {
+    auto value = std::move(first[hole]);
+    while (true) {
+        auto child = static_cast<std::ptrdiff_t>(Arity) * hole + 1;
+        if (child >= distance)
+            break;
+
+        child = _best_child<Arity>(first, child, distance, comp);
 
         if (!comp(value, first[child]))
             break;
 
         first[hole] = std::move(first[child]);
+        moved(first[hole], hole);
         hole = child;
     }
-
     first[hole] = std::move(value);
+    moved(first[hole], hole);
+    return hole;
 }
 } // namespace j
@@ -0,0 +1,374 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__clang__)
+export module j:list_algo;
+#else
+module j:list_algo;
+#endif
+
+import :vector;
+
+namespace j {
+// Node-level algorithms shared by list, forward_list and their intrusive variants.
+// Nodes only need _next (and _prev for the doubly linked routines); value(node) projects a node to its element.
+// Doubly linked lists are circular around a sentinel, singly linked lists are null-terminated after a before-head
+// node. Routines that drop nodes hand them to dispose(node), which frees or merely unlinks them.
+
+// --- null-terminated chains (through _next only) ---
+
+// stable merge of two sorted chains into a. If comp throws, a still holds every node of both chains.
+template <class Node, class Value, class Compare> void _chain_merge(Node *&a, Node *b, Value &value, Compare &comp) {
+    if (b == nullptr)
+        return;
+    if (a == nullptr) {
+        a = b;
+        return;
+    }
+    Node *head = nullptr;
+    Node **tail = &head;
+    Node *rest_a = a;
+    try {
+        while (rest_a != nullptr && b != nullptr) {
+            if (comp(value(b), value(rest_a))) {
+                *tail = b;
+                b = b->_next;
+            } else {
+                *tail = rest_a;
+                rest_a = rest_a->_next;
+            }
+            tail = &(*tail)->_next;
+        }
+        *tail = rest_a != nullptr ? rest_a : b;
+    } catch (...) {
+        *tail = rest_a;
+        while (*tail != nullptr) {
+            tail = &(*tail)->_next;
+        }
+        *tail = b;
+        a = head;
+        throw;
+    }
+    a = head;
+}
+
+// Bottom-up merge sort of the chain at head, without recursion or length walks: bins[i] holds a sorted run of
+// 2^i nodes, each new node is carried up through the occupied bins like a binary counter, and the bins are
+// merged from the smallest at the end. Higher bins always hold earlier nodes, which keeps the sort stable.
+// If comp throws, head still holds every node.
+template <class Node, class Value, class Compare> void _chain_sort(Node *&head, Value &value, Compare &comp) {
+    if (head == nullptr || head->_next == nullptr)
+        return;
+    constexpr std::size_t max_bins = 64;
+    Node *bins[max_bins] = {};
+    std::size_t fill = 0;
+    Node *rest = head;
+    try {
+        while (rest != nullptr) {
+            Node *carry = rest;
+            rest = rest->_next;
+            carry->_next = nullptr;
+            std::size_t i = 0;
+            for (; i < fill && bins[i] != nullptr; ++i) {
+                _chain_merge(bins[i], carry, value, comp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i == fill)
+                ++fill;
+        }
+        for (std::size_t i = 1; i < fill; ++i) {
+            Node *run = bins[i - 1];
+            bins[i - 1] = nullptr;
+            _chain_merge(bins[i], run, value, comp);
+        }
+    } catch (...) {
+        // a failed merge leaves both of its runs in bins[i]; string the bins and the unsorted rest together
+        Node **tail = &head;
+        for (std::size_t i = 0; i < fill; ++i) {
+            *tail = bins[i];
+            while (*tail != nullptr) {
+                tail = &(*tail)->_next;
+            }
+        }
+        *tail = rest;
+        throw;
+    }
+    head = bins[fill - 1];
+}
+
+// --- circular doubly linked lists around a sentinel ---
+
+// makes the chain at head the content of sentinel's list, rebuilding every _prev
+template <class Node> void _dlist_relink(Node *sentinel, Node *head) noexcept {
+    Node *prev = sentinel;
+    for (Node *p = head; p != nullptr; p = p->_next) {
+        p->_prev = prev;
+        prev = p;
+    }
+    prev->_next = sentinel;
+    sentinel->_prev = prev;
+    sentinel->_next = prev == sentinel ? sentinel : head;
+}
+
+// detaches the content of sentinel's list as a null-terminated chain
+template <class Node> Node *_dlist_detach(Node *sentinel) noexcept {
+    if (sentinel->_next == sentinel)
+        return nullptr;
+    Node *head = sentinel->_next;
+    sentinel->_prev->_next = nullptr;
+    sentinel->_next = sentinel;
+    sentinel->_prev = sentinel;
+    return head;
+}
+
+// moves [first, last) in front of position; the range may come from another list
+template <class Node> void _dlist_transfer(Node *position, Node *first, Node *last) noexcept {
+    if (first == last)
+        return;
+    Node *last_in_range = last->_prev;
+    first->_prev->_next = last;
+    last->_prev = first->_prev;
+
+    first->_prev = position->_prev;
+    position->_prev->_next = first;
+    last_in_range->_next = position;
+    position->_prev = last_in_range;
+}
+
+// merges other's sorted list into sentinel's sorted list; other ends up empty even if comp throws
+template <class Node, class Value, class Compare>
+void _dlist_merge(Node *sentinel, Node *other, Value value, Compare &comp) {
+    Node *head = _dlist_detach(sentinel);
+    try {
+        _chain_merge(head, _dlist_detach(other), value, comp);
+    } catch (...) {
+        _dlist_relink(sentinel, head);
+        throw;
+    }
+    _dlist_relink(sentinel, head);
+}
+
+// sorts through the _next chain only and rebuilds the _prev links once at the end
+template <class Node, class Value, class Compare> void _dlist_sort(Node *sentinel, Value value, Compare &comp) {
+    if (sentinel->_next == sentinel->_prev)
+        return;
+    Node *head = _dlist_detach(sentinel);
+    try {
+        _chain_sort(head, value, comp);
+    } catch (...) {
+        _dlist_relink(sentinel, head);
+        throw;
+    }
+    _dlist_relink(sentinel, head);
+}
+
+// --- gather-sort-scatter for lists of small trivially copyable elements ---
+// Relinking merge sort pays a likely cache miss per comparison once the list outgrows the caches. Copying
+// (element, node) records into a contiguous buffer, sorting the buffer and relinking in one pass touches every node
+// only twice. Records carry the node rather than writing values back, so iterators keep referring to the same
+// elements.
+
+template <class T>
+inline constexpr bool _gather_sortable = std::is_trivially_copy_constructible_v<T> &&
+                                         std::is_trivially_copy_assignable_v<T> && sizeof(T) <= 2 * sizeof(void *);
+
+// below this the nodes of a freshly built list are mostly still cached and the merge sort wins
+inline constexpr std::size_t _gather_sort_threshold = 512;
+
+// integral keys under the standard orderings are sorted by LSD radix sort on an order-preserving unsigned key
+template <class T, class Compare>
+inline constexpr bool _radix_sortable =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+    (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>> ||
+     std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>);
+
+template <class T, class Compare> constexpr std::make_unsigned_t<T> _radix_key(T v) noexcept {
+    using key_type = std::make_unsigned_t<T>;
+    auto key = static_cast<key_type>(v);
+    if constexpr (std::is_signed_v<T>)
+        key ^= static_cast<key_type>(key_type{1} << (sizeof(T) * 8 - 1));
+    if constexpr (std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>)
+        key = static_cast<key_type>(~key);
+    return key;
+}
+
+// stable LSD radix sort of n (key, payload) records, one byte per pass, skipping bytes every key shares.
+// buffer must hold n records; returns whichever of first and buffer ends up holding the result.
+template <class Record> Record *_radix_sort_records(Record *first, Record *buffer, std::size_t n) noexcept {
+    using key_type = decltype(first->first);
+    constexpr std::size_t passes = sizeof(key_type);
+    std::size_t counts[passes][256] = {};
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t p = 0; p < passes; ++p) {
+            ++counts[p][(first[i].first >> (8 * p)) & 0xff];
+        }
+    }
+    Record *from = first;
+    Record *to = buffer;
+    for (std::size_t p = 0; p < passes; ++p) {
+        if (counts[p][(from[0].first >> (8 * p)) & 0xff] == n)
+            continue;
+        std::size_t offset = 0;
+        for (std::size_t &count : counts[p]) {
+            offset += std::exchange(count, offset);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            to[counts[p][(from[i].first >> (8 * p)) & 0xff]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+    return from;
+}
+
+// sorts the n nodes of sentinel's list through a buffer of (key, node) records. Returns false, leaving the list
+// untouched, if the buffer cannot be allocated. If comp throws, the list is left untouched as well.
+template <class Node, class Value, class Compare>
+bool _dlist_gather_sort(Node *sentinel, std::size_t n, Value value, Compare &comp) {
+    using T = std::remove_cvref_t<decltype(value(sentinel))>;
+    using key_type =
+        typename std::conditional_t<_radix_sortable<T, Compare>, std::make_unsigned<T>, std::type_identity<T>>::type;
+    using record = std::pair<key_type, Node *>;
+
+    vector<record> records;
+    vector<record> buffer;
+    try {
+        records.reserve(n);
+        if constexpr (_radix_sortable<T, Compare>)
+            buffer.resize(n);
+    } catch (const std::bad_alloc &) {
+        return false;
+    }
+    for (Node *p = sentinel->_next; p != sentinel; p = p->_next) {
+        if constexpr (_radix_sortable<T, Compare>)
+            records.push_back(record(_radix_key<T, Compare>(value(p)), p));
+        else
+            records.push_back(record(value(p), p));
+    }
+
+    const record *sorted = records.data();
+    if constexpr (_radix_sortable<T, Compare>) {
+        sorted = _radix_sort_records(records.data(), buffer.data(), n);
+    } else {
+        // list::sort is stable, which rules out the faster unstable sorts
+        std::stable_sort(records.data(), records.data() + n,
+                         [&comp](const record &a, const record &b) { return comp(a.first, b.first); });
+    }
+
+    Node *prev = sentinel;
+    for (std::size_t i = 0; i < n; ++i) {
+        Node *node = sorted[i].second;
+        node->_prev = prev;
+        prev->_next = node;
+        prev = node;
+    }
+    prev->_next = sentinel;
+    sentinel->_prev = prev;
+    return true;
+}
+
+// removes all but the first of every run of consecutive equivalent elements; returns the number removed
+template <class Node, class Value, class BinaryPredicate, class Dispose>
+std::size_t _dlist_unique(Node *sentinel, Value value, BinaryPredicate &pred, Dispose dispose) {
+    std::size_t removed = 0;
+    if (sentinel->_next == sentinel)
+        return removed;
+    Node *kept = sentinel->_next;
+    Node *next = kept->_next;
+    while (next != sentinel) {
+        Node *after = next->_next;
+        if (pred(value(kept), value(next))) {
+            kept->_next = after;
+            after->_prev = kept;
+            dispose(next);
+            ++removed;
+        } else {
+            kept = next;
+        }
+        next = after;
+    }
+    return removed;
+}
+
+template <class Node> void _dlist_reverse(Node *sentinel) noexcept {
+    Node *p = sentinel;
+    do {
+        std::swap(p->_next, p->_prev);
+        p = p->_prev; // the old _next
+    } while (p != sentinel);
+}
+
+// --- null-terminated singly linked lists after a before-head node ---
+
+// moves the nodes strictly between before_first and last after position; returns the last moved node (nullptr if
+// there was none) and the number of moved nodes, both found by the walk the transfer needs anyway
+template <class Node>
+std::pair<Node *, std::size_t> _slist_transfer_after(Node *position, Node *before_first, Node *last) noexcept {
+    if (before_first == last || before_first->_next == last)
+        return {nullptr, 0};
+    Node *last_in_range = before_first->_next;
+    std::size_t moved = 1;
+    while (last_in_range->_next != last) {
+        last_in_range = last_in_range->_next;
+        ++moved;
+    }
+    Node *first = before_first->_next;
+    before_first->_next = last;
+    last_in_range->_next = position->_next;
+    position->_next = first;
+    return {last_in_range, moved};
+}
+
+template <class Node, class Value, class Compare>
+void _slist_merge(Node *before_head, Node *other_before_head, Value value, Compare &comp) {
+    Node *other = other_before_head->_next;
+    other_before_head->_next = nullptr;
+    _chain_merge(before_head->_next, other, value, comp);
+}
+
+template <class Node, class Value, class Compare> void _slist_sort(Node *before_head, Value value, Compare &comp) {
+    _chain_sort(before_head->_next, value, comp);
+}
+
+template <class Node, class Value, class BinaryPredicate, class Dispose>
+std::size_t _slist_unique(Node *before_head, Value value, BinaryPredicate &pred, Dispose dispose) {
+    std::size_t removed = 0;
+    Node *kept = before_head->_next;
+    if (kept == nullptr)
+        return removed;
+    while (Node *next = kept->_next) {
+        if (pred(value(kept), value(next))) {
+            kept->_next = next->_next;
+            dispose(next);
+            ++removed;
+        } else {
+            kept = next;
+        }
+    }
+    return removed;
+}
+
+template <class Node> void _slist_reverse(Node *before_head) noexcept {
+    Node *prev = nullptr;
+    Node *current = before_head->_next;
+    while (current != nullptr) {
+        Node *next = current->_next;
+        current->_next = prev;
+        prev = current;
+        current = next;
+    }
+    before_head->_next = prev;
+}
+} // namespace j
@@ -0,0 +1,574 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+export module j:parallel;
+
+import :vector;
+import :deque;
+import :thread_pool;
+import :sort_algo;
+
+namespace j::execution {
+// execution policies of the j::par algorithms
+export struct sequenced_policy {};
+// runs on the shared default pool, or on the given one: j::par::sort(j::execution::par.on(pool), ...)
+export struct parallel_policy {
+    thread_pool *_pool = nullptr;
+
+    constexpr parallel_policy on(thread_pool &pool) const noexcept {
+        return parallel_policy{&pool};
+    }
+};
+
+export inline constexpr sequenced_policy seq{};
+export inline constexpr parallel_policy par{};
+} // namespace j::execution
+
+namespace j {
+export template <class T>
+concept execution_policy = std::same_as<std::remove_cvref_t<T>, execution::sequenced_policy> ||
+                           std::same_as<std::remove_cvref_t<T>, execution::parallel_policy>;
+
+template <class Policy>
+inline constexpr bool _is_parallel = std::same_as<std::remove_cvref_t<Policy>, execution::parallel_policy>;
+
+// --- pool ---
+
+inline thread_pool &_default_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+template <class Policy> thread_pool &_pool_of(const Policy &policy) noexcept {
+    return policy._pool != nullptr ? *policy._pool : _default_pool();
+}
+
+// calls fn(i) for every i in [0, count), one task per index
+template <class Fn> void _run_tasks(thread_pool &pool, std::size_t count, Fn &fn) {
+    pool.parallel_for(std::size_t(0), count, std::ref(fn), 1);
+}
+
+// --- chunking ---
+
+// deque iterators: elements are contiguous up to the end of the current block
+template <class Iter>
+concept _segmented_iterator = std::random_access_iterator<Iter> && requires(const Iter &it) {
+    { Iter::_segment_size } -> std::convertible_to<std::ptrdiff_t>;
+    { it._segment_end() - it.operator->() } -> std::convertible_to<std::ptrdiff_t>;
+};
+
+// smallest piece worth handing to another thread
+inline constexpr std::ptrdiff_t _parallel_grain = 1 << 14;
+
+// number of chunks for n elements: a few per thread for balance, but none smaller than the grain
+inline std::size_t _chunk_count(thread_pool &pool, std::ptrdiff_t n) noexcept {
+    const auto by_size = static_cast<std::size_t>(n / _parallel_grain);
+    return std::max<std::size_t>(1, std::min(by_size, pool.concurrency() * 4));
+}
+
+// start of chunk k of [first, first + n) split into chunks pieces. Inner boundaries of a deque range are moved down
+// to a block start, so no chunk straddles a block boundary.
+template <class Iter>
+std::ptrdiff_t _chunk_boundary(const Iter &first, std::ptrdiff_t n, std::size_t chunks, std::size_t k) noexcept {
+    if (k == 0)
+        return 0;
+    if (k >= chunks)
+        return n;
+    const std::ptrdiff_t raw = static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n) * k / chunks);
+    if constexpr (_segmented_iterator<Iter>) {
+        const std::ptrdiff_t size = Iter::_segment_size;
+        const std::ptrdiff_t lead = first._segment_end() - first.operator->(); // elements before the first boundary
+        return raw < lead ? 0 : std::min(n, lead + (raw - lead) / size * size);
+    } else {
+        return raw;
+    }
+}
+
+// calls fn(run_first, run_last, offset) for consecutive pieces of [first + begin, first + end) in order. The pieces
+// are raw pointer ranges for contiguous and deque iterators; offset is the position of run_first in the range.
+template <class Iter, class Fn> void _for_each_run(Iter first, std::ptrdiff_t begin, std::ptrdiff_t end, Fn &&fn) {
+    if (begin >= end)
+        return;
+    if constexpr (std::contiguous_iterator<Iter>) {
+        auto *data = std::to_address(first);
+        fn(data + begin, data + end, begin);
+    } else if constexpr (_segmented_iterator<Iter>) {
+        Iter it = first + begin;
+        while (true) {
+            auto *run = it.operator->();
+            const std::ptrdiff_t length = std::min<std::ptrdiff_t>(it._segment_end() - run, end - begin);
+            fn(run, run + length, begin);
+            begin += length;
+            if (begin == end)
+                break;
+            it += length;
+        }
+    } else {
+        fn(first + begin, first + end, begin);
+    }
+}
+
+// runs body(chunk_begin, chunk_end) over the chunks of [first, first + n) on the pool
+template <class Iter, class Body> void _parallel_chunks(thread_pool &pool, Iter first, std::ptrdiff_t n, Body body) {
+    const std::size_t chunks = _chunk_count(pool, n);
+    auto task = [&](std::size_t k) {
+        body(_chunk_boundary(first, n, chunks, k), _chunk_boundary(first, n, chunks, k + 1));
+    };
+    _run_tasks(pool, chunks, task);
+}
+
+// calls fn(i) for every i in [first, last): on the pool under execution::par once the range is worth splitting,
+// in order otherwise. Used by segment_tree to build one level at a time.
+template <class Policy, class Fn>
+void _for_indices(const Policy &policy, std::size_t first, std::size_t last, Fn &&fn) {
+    if constexpr (_is_parallel<Policy>) {
+        if (last > first && last - first >= static_cast<std::size_t>(_parallel_grain)) {
+            _pool_of(policy).parallel_for(first, last, std::ref(fn), static_cast<std::size_t>(_parallel_grain));
+            return;
+        }
+    }
+    for (; first < last; ++first) {
+        fn(first);
+    }
+}
+
+// left fold of op over [first + begin, first + end), which must not be empty
+template <class T, class Iter, class Project, class Op>
+T _fold_chunk(Iter first, std::ptrdiff_t begin, std::ptrdiff_t end, Project &project, Op &op) {
+    T acc = project(first[begin]);
+    _for_each_run(first, begin + 1, end, [&](auto run, auto run_last, std::ptrdiff_t) {
+        for (; run != run_last; ++run) {
+            acc = op(std::move(acc), project(*run));
+        }
+    });
+    return acc;
+}
+
+// folds every chunk in parallel and the chunk results, in order, onto init
+template <class T, class Iter, class Project, class Op>
+T _parallel_fold(thread_pool &pool, Iter first, std::ptrdiff_t n, T init, Project project, Op op) {
+    const std::size_t chunks = _chunk_count(pool, n);
+    vector<T> partials;
+    partials.reserve(chunks);
+    for (std::size_t k = 0; k < chunks; ++k) {
+        partials.push_back(init); // placeholders; chunks are never empty, so each one is overwritten
+    }
+    auto task = [&](std::size_t k) {
+        const std::ptrdiff_t begin = _chunk_boundary(first, n, chunks, k);
+        const std::ptrdiff_t end = _chunk_boundary(first, n, chunks, k + 1);
+        if (begin != end)
+            partials[k] = _fold_chunk<T>(first, begin, end, project, op);
+    };
+    _run_tasks(pool, chunks, task);
+    for (std::size_t k = 0; k < chunks; ++k) {
+        if (_chunk_boundary(first, n, chunks, k) != _chunk_boundary(first, n, chunks, k + 1))
+            init = op(std::move(init), std::move(partials[k]));
+    }
+    return init;
+}
+
+// --- merging ---
+
+// number of elements of a in the first k elements of the stable merge of a and b
+template <class Iter1, class Iter2, class Compare>
+std::ptrdiff_t _merge_split(Iter1 a, std::ptrdiff_t na, Iter2 b, std::ptrdiff_t nb, std::ptrdiff_t k, Compare &comp) {
+    std::ptrdiff_t low = std::max<std::ptrdiff_t>(0, k - nb);
+    std::ptrdiff_t high = std::min(k, na);
+    while (low < high) {
+        const std::ptrdiff_t i = low + (high - low) / 2;
+        const std::ptrdiff_t j = k - i;
+        if (j > 0 && !comp(b[j - 1], a[i])) // a[i] goes before b[j - 1], so it is among the first k
+            low = i + 1;
+        else
+            high = i;
+    }
+    return low;
+}
+
+// std::merge, but moving the elements; comparisons see lvalues, so a comparator taking its arguments by value
+// cannot move from them
+template <class Iter, class OutIter, class Compare>
+void _move_merge(Iter first1, Iter last1, Iter first2, Iter last2, OutIter out, Compare &comp) {
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first2, *first1)) {
+            *out = std::move(*first2);
+            ++first2;
+        } else {
+            *out = std::move(*first1);
+            ++first1;
+        }
+        ++out;
+    }
+    out = std::move(first1, last1, out);
+    std::move(first2, last2, out);
+}
+
+// piece part of parts of the stable merge of [a, a + na) and [b, b + nb) into out; the pieces have equal lengths
+template <bool Move, class Iter1, class Iter2, class OutIter, class Compare>
+void _merge_part(Iter1 a, std::ptrdiff_t na, Iter2 b, std::ptrdiff_t nb, OutIter out, Compare &comp,
+                 std::size_t parts, std::size_t part) {
+    const std::ptrdiff_t n = na + nb;
+    const auto k_begin = static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n) * part / parts);
+    const auto k_end = static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n) * (part + 1) / parts);
+    const std::ptrdiff_t i_begin = _merge_split(a, na, b, nb, k_begin, comp);
+    const std::ptrdiff_t i_end = _merge_split(a, na, b, nb, k_end, comp);
+    if constexpr (Move)
+        _move_merge(a + i_begin, a + i_end, b + (k_begin - i_begin), b + (k_end - i_end), out + k_begin, comp);
+    else
+        std::merge(a + i_begin, a + i_end, b + (k_begin - i_begin), b + (k_end - i_end), out + k_begin, comp);
+}
+
+template <class Iter1, class Iter2, class OutIter, class Compare>
+void _parallel_merge(thread_pool &pool, Iter1 a, std::ptrdiff_t na, Iter2 b, std::ptrdiff_t nb, OutIter out,
+                     Compare &comp) {
+    const std::size_t parts = _chunk_count(pool, na + nb);
+    auto task = [&](std::size_t part) { _merge_part<false>(a, na, b, nb, out, comp, parts, part); };
+    _run_tasks(pool, parts, task);
+}
+
+// --- sorting ---
+
+// sorts chunks in parallel, then merges neighbours round by round, ping-ponging between the range and a buffer.
+// Every merge round is cut into pieces of equal length, so all threads stay busy up to the final merge.
+template <bool Stable, class Iter, class Compare>
+void _parallel_sort(thread_pool &pool, Iter first, Iter last, Compare comp) {
+    using T = std::iter_value_t<Iter>;
+    const std::ptrdiff_t n = last - first;
+    std::size_t leaves = 1;
+    while (leaves < pool.concurrency() && static_cast<std::ptrdiff_t>(leaves * 2) * _parallel_grain <= n) {
+        leaves *= 2;
+    }
+    if (leaves == 1 || !std::is_default_constructible_v<T>) {
+        if constexpr (Stable)
+            std::stable_sort(first, last, comp);
+        else
+            _sort(first, last, comp);
+        return;
+    }
+    if constexpr (std::is_default_constructible_v<T>) {
+        vector<std::ptrdiff_t> bounds;
+        bounds.reserve(leaves + 1);
+        for (std::size_t k = 0; k <= leaves; ++k) {
+            bounds.push_back(_chunk_boundary(first, n, leaves, k));
+        }
+        auto sort_leaf = [&](std::size_t k) {
+            Compare leaf_comp = comp; // every leaf sorts with its own copy, as std::sort would
+            if constexpr (Stable)
+                std::stable_sort(first + bounds[k], first + bounds[k + 1], leaf_comp);
+            else
+                _sort(first + bounds[k], first + bounds[k + 1], leaf_comp);
+        };
+        _run_tasks(pool, leaves, sort_leaf);
+
+        vector<T> buffer(static_cast<std::size_t>(n));
+        bool in_buffer = false;
+        const std::size_t parts_per_round = pool.concurrency() * 2;
+        for (std::size_t width = 1; width < leaves; width *= 2) {
+            // pieces of every pair's merge, each pair getting pieces in proportion to its length
+            vector<std::pair<std::size_t, std::size_t>> pieces; // (pair start leaf, part), part count in pair_parts
+            vector<std::size_t> pair_parts(leaves, 0);
+            for (std::size_t k = 0; k < leaves; k += 2 * width) {
+                const std::ptrdiff_t length = bounds[k + 2 * width] - bounds[k];
+                pair_parts[k] = std::max<std::size_t>(1, parts_per_round * static_cast<std::size_t>(length) /
+                                                             static_cast<std::size_t>(n));
+                for (std::size_t part = 0; part < pair_parts[k]; ++part) {
+                    pieces.push_back({k, part});
+                }
+            }
+            auto merge_piece = [&](std::size_t p) {
+                const auto [k, part] = pieces[p];
+                const std::ptrdiff_t begin = bounds[k];
+                const std::ptrdiff_t middle = bounds[k + width];
+                const std::ptrdiff_t end = bounds[k + 2 * width];
+                if (in_buffer)
+                    _merge_part<true>(buffer.begin() + begin, middle - begin, buffer.begin() + middle, end - middle,
+                                      first + begin, comp, pair_parts[k], part);
+                else
+                    _merge_part<true>(first + begin, middle - begin, first + middle, end - middle,
+                                      buffer.begin() + begin, comp, pair_parts[k], part);
+            };
+            _run_tasks(pool, pieces.size(), merge_piece);
+            in_buffer = !in_buffer;
+        }
+        if (in_buffer) {
+            _parallel_chunks(pool, first, n, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+            });
+        }
+    }
+}
+} // namespace j
+
+// The j::par algorithms take an execution policy first and random access iterators, e.g. into j::vector, j::deque
+// or j::array. With execution::par they split the range into chunks run on a shared work-stealing pool; the chunks of
+// a j::deque range are whole blocks, walked through raw pointers. Without a policy they run in parallel.
+namespace j::par {
+export template <execution_policy Policy, std::random_access_iterator Iter, class Fn>
+void for_each(Policy &&policy, Iter first, Iter last, Fn fn) {
+    if constexpr (_is_parallel<Policy>) {
+        _parallel_chunks(_pool_of(policy), first, last - first, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+            _for_each_run(first, begin, end, [&](auto run, auto run_last, std::ptrdiff_t) {
+                for (; run != run_last; ++run) {
+                    fn(*run);
+                }
+            });
+        });
+    } else {
+        std::for_each(first, last, fn);
+    }
+}
+
+export template <std::random_access_iterator Iter, class Fn> void for_each(Iter first, Iter last, Fn fn) {
+    par::for_each(execution::par, first, last, std::move(fn));
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, std::random_access_iterator OutIter,
+                 class UnaryOp>
+OutIter transform(Policy &&policy, Iter first, Iter last, OutIter d_first, UnaryOp op) {
+    if constexpr (_is_parallel<Policy>) {
+        const std::ptrdiff_t n = last - first;
+        _parallel_chunks(_pool_of(policy), first, n, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+            _for_each_run(first, begin, end, [&](auto run, auto run_last, std::ptrdiff_t offset) {
+                std::transform(run, run_last, d_first + offset, op);
+            });
+        });
+        return d_first + n;
+    } else {
+        return std::transform(first, last, d_first, op);
+    }
+}
+
+export template <std::random_access_iterator Iter, std::random_access_iterator OutIter, class UnaryOp>
+OutIter transform(Iter first, Iter last, OutIter d_first, UnaryOp op) {
+    return par::transform(execution::par, first, last, d_first, std::move(op));
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter1, std::random_access_iterator Iter2,
+                 std::random_access_iterator OutIter, class BinaryOp>
+OutIter transform(Policy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, OutIter d_first, BinaryOp op) {
+    if constexpr (_is_parallel<Policy>) {
+        const std::ptrdiff_t n = last1 - first1;
+        _parallel_chunks(_pool_of(policy), first1, n, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+            _for_each_run(first1, begin, end, [&](auto run, auto run_last, std::ptrdiff_t offset) {
+                std::transform(run, run_last, first2 + offset, d_first + offset, op);
+            });
+        });
+        return d_first + n;
+    } else {
+        return std::transform(first1, last1, first2, d_first, op);
+    }
+}
+
+// op must be associative; unlike std::reduce it need not be commutative, the chunk results are combined in order
+export template <execution_policy Policy, std::random_access_iterator Iter, class T, class BinaryOp>
+T reduce(Policy &&policy, Iter first, Iter last, T init, BinaryOp op) {
+    if constexpr (_is_parallel<Policy>) {
+        return _parallel_fold(_pool_of(policy), first, last - first, std::move(init), std::identity(), op);
+    } else {
+        return std::accumulate(first, last, std::move(init), op);
+    }
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, class T>
+T reduce(Policy &&policy, Iter first, Iter last, T init) {
+    return par::reduce(policy, first, last, std::move(init), std::plus<>());
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter>
+std::iter_value_t<Iter> reduce(Policy &&policy, Iter first, Iter last) {
+    return par::reduce(policy, first, last, std::iter_value_t<Iter>(), std::plus<>());
+}
+
+export template <std::random_access_iterator Iter>
+std::iter_value_t<Iter> reduce(Iter first, Iter last) {
+    return par::reduce(execution::par, first, last);
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, class T, class BinaryReduceOp,
+                 class UnaryTransformOp>
+T transform_reduce(Policy &&policy, Iter first, Iter last, T init, BinaryReduceOp reduce_op,
+                   UnaryTransformOp transform_op) {
+    if constexpr (_is_parallel<Policy>) {
+        auto project = [&](auto &x) -> T { return transform_op(x); };
+        return _parallel_fold(_pool_of(policy), first, last - first, std::move(init), project, reduce_op);
+    } else {
+        return std::transform_reduce(first, last, std::move(init), reduce_op, transform_op);
+    }
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter1, std::random_access_iterator Iter2,
+                 class T, class BinaryReduceOp, class BinaryTransformOp>
+T transform_reduce(Policy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, T init, BinaryReduceOp reduce_op,
+                   BinaryTransformOp transform_op) {
+    if constexpr (_is_parallel<Policy>) {
+        // fold over positions so that the second range follows the first one's chunks
+        const std::ptrdiff_t n = last1 - first1;
+        thread_pool &pool = _pool_of(policy);
+        const std::size_t chunks = _chunk_count(pool, n);
+        vector<T> partials;
+        partials.reserve(chunks);
+        for (std::size_t k = 0; k < chunks; ++k) {
+            partials.push_back(init);
+        }
+        auto task = [&](std::size_t k) {
+            const std::ptrdiff_t begin = _chunk_boundary(first1, n, chunks, k);
+            const std::ptrdiff_t end = _chunk_boundary(first1, n, chunks, k + 1);
+            if (begin == end)
+                return;
+            T acc = transform_op(first1[begin], first2[begin]);
+            _for_each_run(first1, begin + 1, end, [&](auto run, auto run_last, std::ptrdiff_t offset) {
+                for (Iter2 it = first2 + offset; run != run_last; ++run, ++it) {
+                    acc = reduce_op(std::move(acc), transform_op(*run, *it));
+                }
+            });
+            partials[k] = std::move(acc);
+        };
+        _run_tasks(pool, chunks, task);
+        for (std::size_t k = 0; k < chunks; ++k) {
+            if (_chunk_boundary(first1, n, chunks, k) != _chunk_boundary(first1, n, chunks, k + 1))
+                init = reduce_op(std::move(init), std::move(partials[k]));
+        }
+        return init;
+    } else {
+        return std::transform_reduce(first1, last1, first2, std::move(init), reduce_op, transform_op);
+    }
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter1, std::random_access_iterator Iter2,
+                 class T>
+T transform_reduce(Policy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, T init) {
+    return par::transform_reduce(policy, first1, last1, first2, std::move(init), std::plus<>(), std::multiplies<>());
+}
+
+// two passes: the chunk totals, then every chunk scanned again starting from the total of the chunks before it
+export template <execution_policy Policy, std::random_access_iterator Iter, std::random_access_iterator OutIter,
+                 class BinaryOp, class T>
+OutIter inclusive_scan(Policy &&policy, Iter first, Iter last, OutIter d_first, BinaryOp op, T init) {
+    if constexpr (_is_parallel<Policy>) {
+        const std::ptrdiff_t n = last - first;
+        thread_pool &pool = _pool_of(policy);
+        const std::size_t chunks = _chunk_count(pool, n);
+        vector<T> carries; // carries[k]: init folded with every element before chunk k
+        carries.reserve(chunks);
+        for (std::size_t k = 0; k < chunks; ++k) {
+            carries.push_back(init);
+        }
+        std::identity project;
+        auto total = [&](std::size_t k) {
+            const std::ptrdiff_t begin = _chunk_boundary(first, n, chunks, k);
+            const std::ptrdiff_t end = _chunk_boundary(first, n, chunks, k + 1);
+            if (k + 1 < chunks && begin != end)
+                carries[k + 1] = _fold_chunk<T>(first, begin, end, project, op);
+        };
+        _run_tasks(pool, chunks, total);
+        for (std::size_t k = 1; k < chunks; ++k) {
+            if (_chunk_boundary(first, n, chunks, k - 1) != _chunk_boundary(first, n, chunks, k))
+                carries[k] = op(carries[k - 1], std::move(carries[k]));
+            else
+                carries[k] = carries[k - 1];
+        }
+        auto scan = [&](std::size_t k) {
+            T acc = std::move(carries[k]);
+            _for_each_run(first, _chunk_boundary(first, n, chunks, k), _chunk_boundary(first, n, chunks, k + 1),
+                          [&](auto run, auto run_last, std::ptrdiff_t offset) {
+                              for (OutIter out = d_first + offset; run != run_last; ++run, ++out) {
+                                  acc = op(std::move(acc), *run);
+                                  *out = acc;
+                              }
+                          });
+        };
+        _run_tasks(pool, chunks, scan);
+        return d_first + n;
+    } else {
+        return std::inclusive_scan(first, last, d_first, op, std::move(init));
+    }
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, std::random_access_iterator OutIter,
+                 class BinaryOp>
+OutIter inclusive_scan(Policy &&policy, Iter first, Iter last, OutIter d_first, BinaryOp op) {
+    if (first == last)
+        return d_first;
+    // the first element seeds the scan
+    *d_first = *first;
+    return par::inclusive_scan(policy, std::next(first), last, std::next(d_first), op, std::iter_value_t<Iter>(*first));
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, std::random_access_iterator OutIter>
+OutIter inclusive_scan(Policy &&policy, Iter first, Iter last, OutIter d_first) {
+    return par::inclusive_scan(policy, first, last, d_first, std::plus<>());
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, class Compare>
+void sort(Policy &&policy, Iter first, Iter last, Compare comp) {
+    if constexpr (_is_parallel<Policy>)
+        _parallel_sort<false>(_pool_of(policy), first, last, comp);
+    else
+        _sort(first, last, comp);
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter>
+void sort(Policy &&policy, Iter first, Iter last) {
+    par::sort(policy, first, last, std::less<>());
+}
+
+export template <std::random_access_iterator Iter> void sort(Iter first, Iter last) {
+    par::sort(execution::par, first, last, std::less<>());
+}
+
+export template <std::random_access_iterator Iter, class Compare> void sort(Iter first, Iter last, Compare comp) {
+    par::sort(execution::par, first, last, comp);
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter, class Compare>
+void stable_sort(Policy &&policy, Iter first, Iter last, Compare comp) {
+    if constexpr (_is_parallel<Policy>)
+        _parallel_sort<true>(_pool_of(policy), first, last, comp);
+    else
+        std::stable_sort(first, last, comp);
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter>
+void stable_sort(Policy &&policy, Iter first, Iter last) {
+    par::stable_sort(policy, first, last, std::less<>());
+}
+
+export template <std::random_access_iterator Iter> void stable_sort(Iter first, Iter last) {
+    par::stable_sort(execution::par, first, last, std::less<>());
+}
+
+export template <std::random_access_iterator Iter, class Compare>
+void stable_sort(Iter first, Iter last, Compare comp) {
+    par::stable_sort(execution::par, first, last, comp);
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter1, std::random_access_iterator Iter2,
+                 std::random_access_iterator OutIter, class Compare>
+OutIter merge(Policy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, OutIter d_first, Compare comp) {
+    if constexpr (_is_parallel<Policy>) {
+        _parallel_merge(_pool_of(policy), first1, last1 - first1, first2, last2 - first2, d_first, comp);
+        return d_first + ((last1 - first1) + (last2 - first2));
+    } else {
+        return std::merge(first1, last1, first2, last2, d_first, comp);
+    }
+}
+
+export template <execution_policy Policy, std::random_access_iterator Iter1, std::random_access_iterator Iter2,
+                 std::random_access_iterator OutIter>
+OutIter merge(Policy &&policy, Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, OutIter d_first) {
+    return par::merge(policy, first1, last1, first2, last2, d_first, std::less<>());
+}
+} // namespace j::par
@@ -0,0 +1,636 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__clang__)
+export module j:sort_algo;
+#else
+module j:sort_algo;
+#endif
+
+import :heap_algo;
+import :vector;
+
+namespace j {
+// --- insertion sort ---
+
+template <std::random_access_iterator Iter, class Compare> void _insertion_sort(Iter first, Iter last, Compare &comp) {
+    if (first == last)
+        return;
+    for (Iter cur = first + 1; cur != last; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            auto value = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (sift != first && comp(value, *--sift_1));
+            *sift = std::move(value);
+        }
+    }
+}
+
+// *(first - 1) must not be greater than any element of [first, last), so the inner loop needs no bounds check
+template <std::random_access_iterator Iter, class Compare>
+void _unguarded_insertion_sort(Iter first, Iter last, Compare &comp) {
+    if (first == last)
+        return;
+    for (Iter cur = first + 1; cur != last; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            auto value = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (comp(value, *--sift_1));
+            *sift = std::move(value);
+        }
+    }
+}
+
+// insertion sort that gives up once more than _partial_insertion_limit elements were moved; true if it finished
+inline constexpr std::ptrdiff_t _partial_insertion_limit = 8;
+
+template <std::random_access_iterator Iter, class Compare>
+bool _partial_insertion_sort(Iter first, Iter last, Compare &comp) {
+    if (first == last)
+        return true;
+    std::ptrdiff_t moved = 0;
+    for (Iter cur = first + 1; cur != last; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            auto value = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (sift != first && comp(value, *--sift_1));
+            *sift = std::move(value);
+            moved += cur - sift;
+        }
+        if (moved > _partial_insertion_limit)
+            return false;
+    }
+    return true;
+}
+
+// --- pattern-defeating quicksort (Orson Peters, 2021) ---
+
+inline constexpr std::ptrdiff_t _insertion_sort_threshold = 24;
+inline constexpr std::ptrdiff_t _ninther_threshold = 128;
+inline constexpr std::ptrdiff_t _partition_block = 64; // elements classified per block by the branchless partition
+
+// comparisons that compile to a flag, so the block partition can classify elements without branches
+template <class T, class Compare>
+inline constexpr bool _branchless_compare =
+    std::is_arithmetic_v<T> &&
+    (std::same_as<Compare, std::less<T>> || std::same_as<Compare, std::less<>> ||
+     std::same_as<Compare, std::greater<T>> || std::same_as<Compare, std::greater<>> ||
+     std::same_as<Compare, std::ranges::less> || std::same_as<Compare, std::ranges::greater>);
+
+template <std::random_access_iterator Iter, class Compare> void _sort2(Iter a, Iter b, Compare &comp) {
+    if (comp(*b, *a))
+        std::iter_swap(a, b);
+}
+
+template <std::random_access_iterator Iter, class Compare> void _sort3(Iter a, Iter b, Iter c, Compare &comp) {
+    _sort2(a, b, comp);
+    _sort2(b, c, comp);
+    _sort2(a, b, comp);
+}
+
+// Partitions around the pivot *first: elements less than it end up left of the returned position, the others right
+// of it. The flag reports that no element had to be swapped.
+template <std::random_access_iterator Iter, class Compare>
+std::pair<Iter, bool> _partition_right(Iter begin, Iter end, Compare &comp) {
+    auto pivot = std::move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    // the median-of-3 pivot selection guarantees an element not less than the pivot before end
+    while (comp(*++first, pivot)) {
+    }
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {
+        }
+    } else {
+        while (!comp(*--last, pivot)) {
+        }
+    }
+
+    const bool already_partitioned = first >= last;
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(*++first, pivot)) {
+        }
+        while (!comp(*--last, pivot)) {
+        }
+    }
+
+    Iter pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+// swaps the elements at first + offsets_l[i] and last - offsets_r[i]; without swaps, as one cycle of moves
+template <std::random_access_iterator Iter>
+void _swap_offsets(Iter first, Iter last, const unsigned char *offsets_l, const unsigned char *offsets_r,
+                   std::ptrdiff_t num, bool use_swaps) {
+    if (use_swaps) {
+        // both sides hold the same number of misplaced elements: a cycle would not be shorter
+        for (std::ptrdiff_t i = 0; i < num; ++i) {
+            std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+    } else if (num > 0) {
+        Iter l = first + offsets_l[0];
+        Iter r = last - offsets_r[0];
+        auto tmp = std::move(*l);
+        *l = std::move(*r);
+        for (std::ptrdiff_t i = 1; i < num; ++i) {
+            l = first + offsets_l[i];
+            *r = std::move(*l);
+            r = last - offsets_r[i];
+            *l = std::move(*r);
+        }
+        *r = std::move(tmp);
+    }
+}
+
+// _partition_right with block partitioning (Edelkamp and Weiss): a block of comparisons only records offsets, so
+// the outcome of each comparison never decides a branch
+template <std::random_access_iterator Iter, class Compare>
+std::pair<Iter, bool> _partition_right_branchless(Iter begin, Iter end, Compare &comp) {
+    auto pivot = std::move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    while (comp(*++first, pivot)) {
+    }
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {
+        }
+    } else {
+        while (!comp(*--last, pivot)) {
+        }
+    }
+
+    const bool already_partitioned = first >= last;
+    if (!already_partitioned) {
+        std::iter_swap(first, last);
+        ++first;
+
+        alignas(64) unsigned char offsets_l[_partition_block];
+        alignas(64) unsigned char offsets_r[_partition_block];
+        Iter offsets_l_base = first;
+        Iter offsets_r_base = last;
+        std::ptrdiff_t num_l = 0;
+        std::ptrdiff_t num_r = 0;
+        std::ptrdiff_t start_l = 0;
+        std::ptrdiff_t start_r = 0;
+
+        while (first < last) {
+            // fill whichever offset buffer ran empty; split the rest between both when both did
+            const std::ptrdiff_t num_unknown = last - first;
+            const std::ptrdiff_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            const std::ptrdiff_t right_split = num_r == 0 ? num_unknown - left_split : 0;
+
+            const std::ptrdiff_t left_count = std::min(left_split, _partition_block);
+            for (std::ptrdiff_t i = 0; i < left_count; ++i) {
+                offsets_l[num_l] = static_cast<unsigned char>(i);
+                num_l += !comp(*first, pivot);
+                ++first;
+            }
+            const std::ptrdiff_t right_count = std::min(right_split, _partition_block);
+            for (std::ptrdiff_t i = 0; i < right_count;) {
+                offsets_r[num_r] = static_cast<unsigned char>(++i);
+                num_r += comp(*--last, pivot);
+            }
+
+            const std::ptrdiff_t num = std::min(num_l, num_r);
+            _swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num,
+                          num_l == num_r);
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // one side may still hold misplaced elements; move them next to the boundary
+        if (num_l != 0) {
+            while (num_l-- != 0) {
+                std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+            }
+            first = last;
+        }
+        if (num_r != 0) {
+            while (num_r-- != 0) {
+                std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                ++first;
+            }
+            last = first;
+        }
+    }
+
+    Iter pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+// Partitions around the pivot *first, putting the elements equal to it on the left. Used when the pivot equals the
+// element before the range: then nothing in the range is less than it, and the equal elements need no more sorting.
+template <std::random_access_iterator Iter, class Compare> Iter _partition_left(Iter begin, Iter end, Compare &comp) {
+    auto pivot = std::move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    while (comp(pivot, *--last)) {
+    }
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first)) {
+        }
+    } else {
+        while (!comp(pivot, *++first)) {
+        }
+    }
+
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(pivot, *--last)) {
+        }
+        while (!comp(pivot, *++first)) {
+        }
+    }
+
+    Iter pivot_pos = last;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return pivot_pos;
+}
+
+template <std::random_access_iterator Iter, class Compare> void _heap_sort(Iter first, Iter last, Compare &comp) {
+    _make_heap(first, last, comp);
+    for (; last - first > 1; --last) {
+        _pop_heap(first, last, comp);
+    }
+}
+
+// bad_allowed counts the highly unbalanced partitions still tolerated before switching to heapsort; leftmost
+// tells whether an element precedes [begin, end) to act as a sentinel
+template <bool Branchless, std::random_access_iterator Iter, class Compare>
+void _pdqsort_loop(Iter begin, Iter end, Compare &comp, int bad_allowed, bool leftmost) {
+    while (true) {
+        const std::ptrdiff_t size = end - begin;
+        if (size < _insertion_sort_threshold) {
+            if (leftmost)
+                _insertion_sort(begin, end, comp);
+            else
+                _unguarded_insertion_sort(begin, end, comp);
+            return;
+        }
+
+        // pivot: median of 3, or Tukey's ninther for larger ranges; it ends up at *begin
+        const std::ptrdiff_t half = size / 2;
+        if (size > _ninther_threshold) {
+            _sort3(begin, begin + half, end - 1, comp);
+            _sort3(begin + 1, begin + (half - 1), end - 2, comp);
+            _sort3(begin + 2, begin + (half + 1), end - 3, comp);
+            _sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+            std::iter_swap(begin, begin + half);
+        } else {
+            _sort3(begin + half, begin, end - 1, comp);
+        }
+
+        // many equal elements: a pivot equal to the element before the range goes to the left in one pass
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = _partition_left(begin, end, comp) + 1;
+            continue;
+        }
+
+        const auto [pivot_pos, already_partitioned] = Branchless ? _partition_right_branchless(begin, end, comp)
+                                                                 : _partition_right(begin, end, comp);
+        const std::ptrdiff_t l_size = pivot_pos - begin;
+        const std::ptrdiff_t r_size = end - (pivot_pos + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                _heap_sort(begin, end, comp);
+                return;
+            }
+            // break up patterns that keep producing bad pivots
+            if (l_size >= _insertion_sort_threshold) {
+                std::iter_swap(begin, begin + l_size / 4);
+                std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                if (l_size > _ninther_threshold) {
+                    std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                    std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+            if (r_size >= _insertion_sort_threshold) {
+                std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                std::iter_swap(end - 1, end - r_size / 4);
+                if (r_size > _ninther_threshold) {
+                    std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    std::iter_swap(end - 2, end - (1 + r_size / 4));
+                    std::iter_swap(end - 3, end - (2 + r_size / 4));
+                }
+            }
+        } else if (already_partitioned && _partial_insertion_sort(begin, pivot_pos, comp) &&
+                   _partial_insertion_sort(pivot_pos + 1, end, comp)) {
+            // a balanced partition that needed no swaps hints at sorted input
+            return;
+        }
+
+        // recurse into the left part, loop on the right one
+        _pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template <std::random_access_iterator Iter, class Compare> void _sort(Iter first, Iter last, Compare &comp) {
+    const std::ptrdiff_t n = last - first;
+    if (n < 2)
+        return;
+    const int bad_allowed = std::bit_width(static_cast<std::size_t>(n)) - 1; // log2(n)
+    _pdqsort_loop<_branchless_compare<std::iter_value_t<Iter>, Compare>>(first, last, comp, bad_allowed, true);
+}
+
+// --- sorting networks ---
+
+// Bitonic network on N elements (N a power of two): stage k merges bitonic runs of length k, and step j of it
+// compares every element i with its partner i ^ j, ascending where i & k is 0.
+template <std::size_t N, std::random_access_iterator Iter, class Compare>
+void _bitonic_network(Iter first, Compare &comp) {
+    for (std::size_t k = 2; k <= N; k <<= 1) {
+        for (std::size_t j = k >> 1; j > 0; j >>= 1) {
+            for (std::size_t i = 0; i < N; ++i) {
+                const std::size_t partner = i ^ j;
+                if (partner <= i)
+                    continue;
+                const auto lo = static_cast<std::ptrdiff_t>((i & k) == 0 ? i : partner);
+                const auto hi = static_cast<std::ptrdiff_t>((i & k) == 0 ? partner : i);
+                _sort2(first + lo, first + hi, comp);
+            }
+        }
+    }
+}
+
+#if defined(__AVX2__)
+// 32-bit keys, eight to an AVX2 register; every operation works on the integer view of the register
+template <class T> struct _avx2_lanes;
+
+template <> struct _avx2_lanes<std::int32_t> {
+    static __m256i min(__m256i a, __m256i b) noexcept {
+        return _mm256_min_epi32(a, b);
+    }
+    static __m256i max(__m256i a, __m256i b) noexcept {
+        return _mm256_max_epi32(a, b);
+    }
+};
+
+template <> struct _avx2_lanes<std::uint32_t> {
+    static __m256i min(__m256i a, __m256i b) noexcept {
+        return _mm256_min_epu32(a, b);
+    }
+    static __m256i max(__m256i a, __m256i b) noexcept {
+        return _mm256_max_epu32(a, b);
+    }
+};
+
+template <> struct _avx2_lanes<float> {
+    static __m256i min(__m256i a, __m256i b) noexcept {
+        return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+    static __m256i max(__m256i a, __m256i b) noexcept {
+        return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+};
+
+// lanes of register r that keep the larger value in step (k, j) of the bitonic network
+constexpr int _bitonic_blend_mask(std::size_t k, std::size_t j, std::size_t r, bool descending) noexcept {
+    int mask = 0;
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+        const std::size_t i = 8 * r + lane;
+        const bool upper = (i & j) != 0;
+        const bool ascending = (i & k) == 0;
+        if ((upper == ascending) != descending)
+            mask |= 1 << lane;
+    }
+    return mask;
+}
+
+// the bitonic network on R registers: steps with j < 8 pair lanes inside a register, the others whole registers
+template <class T, bool Descending, std::size_t R> struct _avx2_bitonic {
+    using lanes = _avx2_lanes<T>;
+
+    template <std::size_t J> static __m256i _partner(__m256i v) noexcept {
+        if constexpr (J == 1)
+            return _mm256_shuffle_epi32(v, 0xB1);
+        else if constexpr (J == 2)
+            return _mm256_shuffle_epi32(v, 0x4E);
+        else
+            return _mm256_permute2x128_si256(v, v, 0x01);
+    }
+
+    template <std::size_t K, std::size_t J, std::size_t Reg> static __m256i _in_register(__m256i v) noexcept {
+        constexpr int mask = _bitonic_blend_mask(K, J, Reg, Descending);
+        const __m256i partner = _partner<J>(v);
+        return _mm256_blend_epi32(lanes::min(v, partner), lanes::max(v, partner), mask);
+    }
+
+    template <std::size_t K, std::size_t J> static void _step(__m256i *v) noexcept {
+        if constexpr (J >= 8) {
+            constexpr std::size_t stride = J / 8;
+            for (std::size_t r = 0; r < R; ++r) {
+                if ((r & stride) != 0)
+                    continue;
+                const __m256i lo = lanes::min(v[r], v[r | stride]);
+                const __m256i hi = lanes::max(v[r], v[r | stride]);
+                const bool ascending = ((8 * r) & K) == 0;
+                v[r] = ascending != Descending ? lo : hi;
+                v[r | stride] = ascending != Descending ? hi : lo;
+            }
+        } else {
+            [&]<std::size_t... Regs>(std::index_sequence<Regs...>) {
+                ((v[Regs] = _in_register<K, J, Regs>(v[Regs])), ...);
+            }(std::make_index_sequence<R>());
+        }
+    }
+
+    template <std::size_t K, std::size_t J> static void _stage(__m256i *v) noexcept {
+        _step<K, J>(v);
+        if constexpr (J > 1)
+            _stage<K, J / 2>(v);
+    }
+
+    template <std::size_t K> static void _stages(__m256i *v) noexcept {
+        _stage<K, K / 2>(v);
+        if constexpr (K < 8 * R)
+            _stages<K * 2>(v);
+    }
+
+    static void sort(T *data) noexcept {
+        __m256i v[R];
+        for (std::size_t r = 0; r < R; ++r) {
+            v[r] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 8 * r));
+        }
+        _stages<2>(v);
+        for (std::size_t r = 0; r < R; ++r) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + 8 * r), v[r]);
+        }
+    }
+};
+
+template <class Compare>
+inline constexpr bool _ascending_compare = std::same_as<Compare, std::less<>> ||
+                                           std::same_as<Compare, std::ranges::less>;
+template <class Compare>
+inline constexpr bool _descending_compare = std::same_as<Compare, std::greater<>> ||
+                                            std::same_as<Compare, std::ranges::greater>;
+#endif
+
+template <std::size_t N, std::random_access_iterator Iter, class Compare>
+void _network_sort(Iter first, Compare &comp) {
+    static_assert(std::has_single_bit(N), "sorting network size must be a power of two");
+#if defined(__AVX2__)
+    using T = std::iter_value_t<Iter>;
+    if constexpr (std::contiguous_iterator<Iter> && (N == 8 || N == 16 || N == 32) &&
+                  (std::same_as<T, std::int32_t> || std::same_as<T, std::uint32_t> || std::same_as<T, float>)) {
+        constexpr bool ascending = _ascending_compare<Compare> || std::same_as<Compare, std::less<T>>;
+        constexpr bool descending = _descending_compare<Compare> || std::same_as<Compare, std::greater<T>>;
+        if constexpr (ascending || descending) {
+            _avx2_bitonic<T, descending, N / 8>::sort(std::to_address(first));
+            return;
+        }
+    }
+#endif
+    _bitonic_network<N>(first, comp);
+}
+
+// --- radix sort ---
+
+template <class Key>
+concept _radix_key_type = (std::integral<Key> && !std::same_as<Key, bool>) ||
+                     (std::floating_point<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8));
+
+// maps a key to an unsigned integer with the same order: the sign bit of signed integers is flipped, negative
+// floats have all bits flipped and the others their sign bit (so -0.0 sorts before 0.0, NaNs to the ends)
+template <_radix_key_type Key> auto _radix_bits(Key key) noexcept {
+    if constexpr (std::floating_point<Key>) {
+        using U = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+        const U bits = std::bit_cast<U>(key);
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return (bits & sign) != 0 ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+    } else if constexpr (std::signed_integral<Key>) {
+        using U = std::make_unsigned_t<Key>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return static_cast<U>(static_cast<U>(key) ^ sign);
+    } else {
+        return key;
+    }
+}
+
+// below this length a (stable) insertion sort beats the counting passes
+inline constexpr std::ptrdiff_t _radix_sort_threshold = 64;
+
+// LSD radix sort with DigitBits-bit digits. One pass over the input counts the digits of every pass; passes whose
+// digit is the same for all elements are skipped. The elements move back and forth between the range and a scratch
+// j::vector, so key is called once per element for the counts and once per element and executed pass.
+template <std::size_t DigitBits, std::random_access_iterator Iter, class KeyFn>
+void _radix_sort(Iter first, Iter last, KeyFn &key) {
+    static_assert(DigitBits >= 1 && DigitBits <= 16, "radix digits must have 1 to 16 bits");
+    using T = std::iter_value_t<Iter>;
+    using Key = std::remove_cvref_t<std::invoke_result_t<KeyFn &, const T &>>;
+    static_assert(_radix_key_type<Key>, "radix_sort keys must be integers or float/double");
+    using U = decltype(_radix_bits(std::declval<Key>()));
+
+    constexpr std::size_t key_bits = sizeof(U) * 8;
+    constexpr std::size_t passes = (key_bits + DigitBits - 1) / DigitBits;
+    constexpr std::size_t radix = std::size_t(1) << DigitBits;
+    constexpr std::size_t digit_mask = radix - 1;
+    auto digit = [&](const T &x, std::size_t pass) {
+        return static_cast<std::size_t>(_radix_bits(key(x)) >> (pass * DigitBits)) & digit_mask;
+    };
+
+    const std::ptrdiff_t n = last - first;
+    if (n < _radix_sort_threshold) {
+        auto by_key = [&](const T &a, const T &b) { return _radix_bits(key(a)) < _radix_bits(key(b)); };
+        _insertion_sort(first, last, by_key);
+        return;
+    }
+
+    vector<std::size_t> counts(passes * radix, std::size_t(0));
+    for (Iter it = first; it != last; ++it) {
+        const U bits = _radix_bits(key(*it));
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            ++counts[pass * radix + (static_cast<std::size_t>(bits >> (pass * DigitBits)) & digit_mask)];
+        }
+    }
+
+    // turn the counts of every pass that moves anything into start offsets
+    bool trivial[passes];
+    bool any_pass = false;
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        std::size_t *count = counts.data() + pass * radix;
+        trivial[pass] = std::find(count, count + radix, static_cast<std::size_t>(n)) != count + radix;
+        if (trivial[pass])
+            continue;
+        any_pass = true;
+        std::size_t offset = 0;
+        for (std::size_t d = 0; d < radix; ++d) {
+            offset += std::exchange(count[d], offset);
+        }
+    }
+    if (!any_pass)
+        return;
+
+    vector<T> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    bool in_buffer = true;
+    auto scatter = [&](auto src, auto src_last, auto dst, std::size_t pass) {
+        std::size_t *count = counts.data() + pass * radix;
+        for (; src != src_last; ++src) {
+            dst[static_cast<std::ptrdiff_t>(count[digit(*src, pass)]++)] = std::move(*src);
+        }
+    };
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        if (trivial[pass])
+            continue;
+        if (in_buffer)
+            scatter(buffer.begin(), buffer.end(), first, pass);
+        else
+            scatter(first, last, buffer.begin(), pass);
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer)
+        std::move(buffer.begin(), buffer.end(), first);
+}
+} // namespace j
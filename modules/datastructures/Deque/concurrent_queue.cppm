@@ -0,0 +1,640 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+export module j:concurrent_queue;
+
+import :vector;
+import :queue;
+import :algorithm;
+
+namespace j {
+// Fixed instead of std::hardware_destructive_interference_size, which is not provided by every standard library.
+inline constexpr std::size_t _cache_line_size = 64;
+
+// Bounded single-producer/single-consumer ring buffer.
+// Exactly one thread may call the producer side (push, emplace, try_push, try_emplace, push_n) and exactly one
+// thread may call the consumer side (front, pop, try_pop, pop_n) at the same time.
+export template <class T, std::size_t Capacity, class Allocator = std::allocator<T>>
+class alignas(_cache_line_size) spsc_queue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "spsc_queue capacity must be a power of two");
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using pointer = typename std::allocator_traits<Allocator>::pointer;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+
+  private:
+    static constexpr size_type _mask = Capacity - 1;
+
+    // Indices grow monotonically and are masked on access, so head == tail means empty and
+    // tail - head == Capacity means full without sacrificing a slot.
+    alignas(_cache_line_size) std::atomic<size_type> _head; // next slot to read, written by the consumer
+    size_type _tail_cache;                                  // consumer's last observed _tail
+    alignas(_cache_line_size) std::atomic<size_type> _tail; // next slot to write, written by the producer
+    size_type _head_cache;                                  // producer's last observed _head
+    alignas(_cache_line_size) pointer _buffer;
+    allocator_type _alloc;
+
+    pointer _slot(size_type index) const noexcept {
+        return _buffer + (index & _mask);
+    }
+
+    // producer side: number of free slots, refreshing the cached head only when the cache says full
+    size_type _free_slots(size_type tail, size_type wanted) noexcept {
+        size_type free = Capacity - (tail - _head_cache);
+        if (free < wanted) {
+            _head_cache = _head.load(std::memory_order_acquire);
+            free = Capacity - (tail - _head_cache);
+        }
+        return free;
+    }
+
+    // consumer side: number of readable slots, refreshing the cached tail only when the cache says empty
+    size_type _ready_slots(size_type head, size_type wanted) noexcept {
+        size_type ready = _tail_cache - head;
+        if (ready < wanted) {
+            _tail_cache = _tail.load(std::memory_order_acquire);
+            ready = _tail_cache - head;
+        }
+        return ready;
+    }
+
+  public:
+    spsc_queue() : spsc_queue(Allocator()) {}
+    explicit spsc_queue(const Allocator &alloc);
+    spsc_queue(const spsc_queue &) = delete;
+    spsc_queue &operator=(const spsc_queue &) = delete;
+    ~spsc_queue();
+
+    // capacity (approximate while the other side is running)
+    [[nodiscard]] bool empty() const noexcept {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        const size_type head = _head.load(std::memory_order_acquire);
+        return _tail.load(std::memory_order_acquire) - head;
+    }
+    [[nodiscard]] static constexpr size_type capacity() noexcept {
+        return Capacity;
+    }
+    allocator_type get_allocator() const noexcept {
+        return _alloc;
+    }
+
+    // producer: push/emplace wait (spinning with yield) while the queue is full
+    void push(const value_type &x) {
+        emplace(x);
+    }
+    void push(value_type &&x) {
+        emplace(std::move(x));
+    }
+    template <class... Args> void emplace(Args &&...args);
+    [[nodiscard]] bool try_push(const value_type &x) {
+        return try_emplace(x);
+    }
+    [[nodiscard]] bool try_push(value_type &&x) {
+        return try_emplace(std::move(x));
+    }
+    template <class... Args> [[nodiscard]] bool try_emplace(Args &&...args);
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    size_type push_n(InputIter first, size_type count);
+
+    // consumer: front/pop require a non-empty queue
+    reference front() noexcept;
+    const_reference front() const noexcept;
+    void pop() noexcept;
+    [[nodiscard]] bool try_pop(value_type &out);
+    template <class OutputIter> size_type pop_n(OutputIter out, size_type count);
+};
+
+template <class T, std::size_t Capacity, class Allocator>
+spsc_queue<T, Capacity, Allocator>::spsc_queue(const Allocator &alloc)
+    : _head(0), _tail_cache(0), _tail(0), _head_cache(0), _buffer(nullptr), _alloc(alloc) {
+    _buffer = std::allocator_traits<Allocator>::allocate(_alloc, Capacity);
+}
+
+template <class T, std::size_t Capacity, class Allocator> spsc_queue<T, Capacity, Allocator>::~spsc_queue() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        const size_type tail = _tail.load(std::memory_order_acquire);
+        for (size_type i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+            std::allocator_traits<Allocator>::destroy(_alloc, std::to_address(_slot(i)));
+        }
+    }
+    std::allocator_traits<Allocator>::deallocate(_alloc, _buffer, Capacity);
+}
+
+template <class T, std::size_t Capacity, class Allocator>
+template <class... Args>
+void spsc_queue<T, Capacity, Allocator>::emplace(Args &&...args) {
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    while (_free_slots(tail, 1) == 0) {
+        std::this_thread::yield();
+    }
+    std::allocator_traits<Allocator>::construct(_alloc, std::to_address(_slot(tail)), std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+}
+
+template <class T, std::size_t Capacity, class Allocator>
+template <class... Args>
+bool spsc_queue<T, Capacity, Allocator>::try_emplace(Args &&...args) {
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    if (_free_slots(tail, 1) == 0)
+        return false;
+    std::allocator_traits<Allocator>::construct(_alloc, std::to_address(_slot(tail)), std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Constructs up to count elements and publishes them with a single release store.
+// Returns the number of elements actually pushed (less than count if the queue fills up).
+template <class T, std::size_t Capacity, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+auto spsc_queue<T, Capacity, Allocator>::push_n(InputIter first, size_type count) -> size_type {
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    const size_type n = std::min(count, _free_slots(tail, count));
+    size_type i = 0;
+    try {
+        for (; i < n; ++i, ++first) {
+            std::allocator_traits<Allocator>::construct(_alloc, std::to_address(_slot(tail + i)), *first);
+        }
+    } catch (...) {
+        for (size_type k = 0; k < i; ++k) {
+            std::allocator_traits<Allocator>::destroy(_alloc, std::to_address(_slot(tail + k)));
+        }
+        throw;
+    }
+    _tail.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+template <class T, std::size_t Capacity, class Allocator>
+auto spsc_queue<T, Capacity, Allocator>::front() noexcept -> reference {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    _ready_slots(head, 1);
+    return *_slot(head);
+}
+
+template <class T, std::size_t Capacity, class Allocator>
+auto spsc_queue<T, Capacity, Allocator>::front() const noexcept -> const_reference {
+    // the acquire load pairs with the producer's release store, so the slot is fully constructed
+    const size_type head = _head.load(std::memory_order_relaxed);
+    (void)_tail.load(std::memory_order_acquire);
+    return *_slot(head);
+}
+
+template <class T, std::size_t Capacity, class Allocator> void spsc_queue<T, Capacity, Allocator>::pop() noexcept {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    _ready_slots(head, 1);
+    std::allocator_traits<Allocator>::destroy(_alloc, std::to_address(_slot(head)));
+    _head.store(head + 1, std::memory_order_release);
+}
+
+template <class T, std::size_t Capacity, class Allocator>
+bool spsc_queue<T, Capacity, Allocator>::try_pop(value_type &out) {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    if (_ready_slots(head, 1) == 0)
+        return false;
+    pointer slot = _slot(head);
+    out = std::move(*slot);
+    std::allocator_traits<Allocator>::destroy(_alloc, std::to_address(slot));
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// Moves up to count elements to out and releases their slots with a single release store.
+// Returns the number of elements actually popped (less than count if the queue runs empty).
+template <class T, std::size_t Capacity, class Allocator>
+template <class OutputIter>
+auto spsc_queue<T, Capacity, Allocator>::pop_n(OutputIter out, size_type count) -> size_type {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    const size_type n = std::min(count, _ready_slots(head, count));
+    size_type i = 0;
+    try {
+        for (; i < n; ++i, ++out) {
+            pointer slot = _slot(head + i);
+            *out = std::move(*slot);
+            std::allocator_traits<Allocator>::destroy(_alloc, std::to_address(slot));
+        }
+    } catch (...) {
+        _head.store(head + i, std::memory_order_release); // the failed element stays queued
+        throw;
+    }
+    _head.store(head + n, std::memory_order_release);
+    return n;
+}
+
+// Bounded multi-producer/multi-consumer queue (D. Vyukov's array queue with per-slot sequence numbers).
+// A slot at index i is writable for position p when its sequence equals p and readable when it equals p + 1;
+// a consumer hands it to the next lap by storing p + capacity. The try_ operations claim a position with CAS and fail
+// instead of waiting, while push/emplace/pop claim one with fetch_add and wait for their slot's turn, spinning with
+// yield, or, when Sleep is true, blocking on the slot sequence with std::atomic::wait.
+// A position is claimed before the element is built, so a producer whose constructor throws still publishes its slot,
+// marked as a hole that consumers step over; a consumer whose move assignment throws drops the element and frees
+// the slot before rethrowing. Either way the sequence keeps moving for the other threads.
+// The requested capacity is rounded up to a power of two.
+export template <class T, bool Sleep = false, class Allocator = std::allocator<T>> class mpmc_queue {
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+
+  private:
+    struct _cell {
+        std::atomic<size_type> _seq;
+        bool _hole = false; // published without a value; written and read under the _seq handoff
+        alignas(T) unsigned char _storage[sizeof(T)];
+    };
+    using cell_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_cell>;
+    using cell_pointer = typename std::allocator_traits<cell_allocator>::pointer;
+
+    static constexpr int _spin_limit = 64;
+
+    alignas(_cache_line_size) std::atomic<size_type> _enqueue_pos;
+    alignas(_cache_line_size) std::atomic<size_type> _dequeue_pos;
+    alignas(_cache_line_size) cell_pointer _buffer;
+    size_type _capacity;
+    size_type _mask;
+    cell_allocator _cell_alloc;
+    allocator_type _alloc;
+
+    static size_type _round_up_pow2(size_type n) noexcept {
+        size_type capacity = 2;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    _cell &_cell_at(size_type pos) const noexcept {
+        return _buffer[pos & _mask];
+    }
+
+    static T *_value(_cell &cell) noexcept {
+        return std::launder(reinterpret_cast<T *>(cell._storage));
+    }
+
+    // waits until cell._seq == expected
+    static void _wait_turn(_cell &cell, size_type expected) noexcept {
+        int spins = 0;
+        size_type seq;
+        while ((seq = cell._seq.load(std::memory_order_acquire)) != expected) {
+            if constexpr (Sleep) {
+                if (++spins > _spin_limit) {
+                    cell._seq.wait(seq, std::memory_order_acquire);
+                    continue;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    static void _publish(_cell &cell, size_type seq) noexcept {
+        cell._seq.store(seq, std::memory_order_release);
+        if constexpr (Sleep) {
+            cell._seq.notify_all(); // a blocked producer and a blocked consumer can share a slot
+        }
+    }
+
+    // moves the value of the claimed slot at pos into out and hands the slot to the next lap, even if the move throws
+    void _take(_cell &cell, size_type pos, value_type &out) {
+        T *value = _value(cell);
+        try {
+            out = std::move(*value);
+        } catch (...) {
+            std::allocator_traits<Allocator>::destroy(_alloc, value);
+            _publish(cell, pos + _capacity);
+            throw;
+        }
+        std::allocator_traits<Allocator>::destroy(_alloc, value);
+        _publish(cell, pos + _capacity);
+    }
+
+  public:
+    explicit mpmc_queue(size_type capacity, const Allocator &alloc = Allocator());
+    mpmc_queue(const mpmc_queue &) = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+    ~mpmc_queue();
+
+    // capacity (approximate while other threads are running)
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        const auto tail = static_cast<std::ptrdiff_t>(_enqueue_pos.load(std::memory_order_acquire));
+        const auto head = static_cast<std::ptrdiff_t>(_dequeue_pos.load(std::memory_order_acquire));
+        return tail > head ? static_cast<size_type>(tail - head) : 0; // blocked pops can run ahead of pushes
+    }
+    [[nodiscard]] size_type capacity() const noexcept {
+        return _capacity;
+    }
+    allocator_type get_allocator() const noexcept {
+        return _alloc;
+    }
+
+    // blocking
+    void push(const value_type &x) {
+        emplace(x);
+    }
+    void push(value_type &&x) {
+        emplace(std::move(x));
+    }
+    template <class... Args> void emplace(Args &&...args);
+    void pop(value_type &out);
+
+    // non-blocking
+    [[nodiscard]] bool try_push(const value_type &x) {
+        return try_emplace(x);
+    }
+    [[nodiscard]] bool try_push(value_type &&x) {
+        return try_emplace(std::move(x));
+    }
+    template <class... Args> [[nodiscard]] bool try_emplace(Args &&...args);
+    [[nodiscard]] bool try_pop(value_type &out);
+};
+
+template <class T, bool Sleep, class Allocator>
+mpmc_queue<T, Sleep, Allocator>::mpmc_queue(size_type capacity, const Allocator &alloc)
+    : _enqueue_pos(0), _dequeue_pos(0), _buffer(nullptr), _capacity(_round_up_pow2(capacity)), _mask(_capacity - 1),
+      _cell_alloc(alloc), _alloc(alloc) {
+    _buffer = std::allocator_traits<cell_allocator>::allocate(_cell_alloc, _capacity);
+    for (size_type i = 0; i < _capacity; ++i) {
+        std::allocator_traits<cell_allocator>::construct(_cell_alloc, std::to_address(_buffer + i));
+        _buffer[i]._seq.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <class T, bool Sleep, class Allocator> mpmc_queue<T, Sleep, Allocator>::~mpmc_queue() {
+    for (size_type i = 0; i < _capacity; ++i) {
+        // a slot holds a value when its sequence is one past a position mapping to it
+        if (((_buffer[i]._seq.load(std::memory_order_acquire) - 1) & _mask) == i && !_buffer[i]._hole) {
+            std::allocator_traits<Allocator>::destroy(_alloc, _value(_buffer[i]));
+        }
+        std::allocator_traits<cell_allocator>::destroy(_cell_alloc, std::to_address(_buffer + i));
+    }
+    std::allocator_traits<cell_allocator>::deallocate(_cell_alloc, _buffer, _capacity);
+}
+
+template <class T, bool Sleep, class Allocator>
+template <class... Args>
+void mpmc_queue<T, Sleep, Allocator>::emplace(Args &&...args) {
+    const size_type pos = _enqueue_pos.fetch_add(1, std::memory_order_relaxed);
+    _cell &cell = _cell_at(pos);
+    _wait_turn(cell, pos);
+    try {
+        std::allocator_traits<Allocator>::construct(_alloc, reinterpret_cast<T *>(cell._storage),
+                                                    std::forward<Args>(args)...);
+    } catch (...) {
+        cell._hole = true;
+        _publish(cell, pos + 1);
+        throw;
+    }
+    _publish(cell, pos + 1);
+}
+
+template <class T, bool Sleep, class Allocator> void mpmc_queue<T, Sleep, Allocator>::pop(value_type &out) {
+    while (true) {
+        const size_type pos = _dequeue_pos.fetch_add(1, std::memory_order_relaxed);
+        _cell &cell = _cell_at(pos);
+        _wait_turn(cell, pos + 1);
+        if (cell._hole) {
+            cell._hole = false;
+            _publish(cell, pos + _capacity);
+            continue;
+        }
+        _take(cell, pos, out);
+        return;
+    }
+}
+
+template <class T, bool Sleep, class Allocator>
+template <class... Args>
+bool mpmc_queue<T, Sleep, Allocator>::try_emplace(Args &&...args) {
+    size_type pos = _enqueue_pos.load(std::memory_order_relaxed);
+    _cell *cell;
+    while (true) {
+        cell = &_cell_at(pos);
+        const size_type seq = cell->_seq.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if (diff == 0) {
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // full
+        } else {
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    try {
+        std::allocator_traits<Allocator>::construct(_alloc, reinterpret_cast<T *>(cell->_storage),
+                                                    std::forward<Args>(args)...);
+    } catch (...) {
+        cell->_hole = true;
+        _publish(*cell, pos + 1);
+        throw;
+    }
+    _publish(*cell, pos + 1);
+    return true;
+}
+
+template <class T, bool Sleep, class Allocator> bool mpmc_queue<T, Sleep, Allocator>::try_pop(value_type &out) {
+    size_type pos = _dequeue_pos.load(std::memory_order_relaxed);
+    _cell *cell;
+    while (true) {
+        cell = &_cell_at(pos);
+        const size_type seq = cell->_seq.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0) {
+            if (!_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                continue;
+            if (!cell->_hole)
+                break;
+            cell->_hole = false;
+            _publish(*cell, pos + _capacity);
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        } else if (diff < 0) {
+            return false; // empty
+        } else {
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    _take(*cell, pos, out);
+    return true;
+}
+
+// Relaxed concurrent priority queue (MultiQueue): elements are spread over several j::priority_queue lanes, each
+// guarded by its own spin lock. push inserts into a random lane; pop looks at the tops of two random lanes and takes
+// the better one. top is therefore not globally exact, but the expected rank of a popped element stays within
+// O(lanes) of the true top, and the contention on any lane stays low as threads are added.
+// Use roughly twice as many lanes as threads; with a single lane the queue is exact.
+export template <class T, class Container = vector<T>, class Compare = std::less<typename Container::value_type>>
+class concurrent_priority_queue {
+  public:
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using container_type = Container;
+    using value_compare = Compare;
+
+  private:
+    // priority_queue that can move its top out instead of copying it
+    struct _lane_queue : priority_queue<T, Container, Compare> {
+        void set_compare(const Compare &compare) {
+            this->_comp = compare;
+        }
+        void pop_into(value_type &out) {
+            pop_heap(this->_c.begin(), this->_c.end(), this->_comp);
+            out = std::move(this->_c.back());
+            this->_c.pop_back();
+        }
+    };
+
+    struct alignas(_cache_line_size) _lane {
+        std::atomic<bool> _locked{false};
+        _lane_queue _pq;
+
+        bool try_lock() noexcept {
+            return !_locked.load(std::memory_order_relaxed) && !_locked.exchange(true, std::memory_order_acquire);
+        }
+        void unlock() noexcept {
+            _locked.store(false, std::memory_order_release);
+        }
+    };
+
+    static constexpr int _pop_attempts = 8;
+
+    std::unique_ptr<_lane[]> _lanes;
+    size_type _lane_count;
+    std::atomic<size_type> _size;
+    Compare _comp;
+
+    size_type _random_lane() const {
+        thread_local std::minstd_rand rng(std::random_device{}());
+        return std::uniform_int_distribution<size_type>(0, _lane_count - 1)(rng);
+    }
+
+    // locks a random lane, re-drawing while the drawn lane is busy
+    _lane &_lock_random_lane() const {
+        while (true) {
+            _lane &lane = _lanes[_random_lane()];
+            if (lane.try_lock())
+                return lane;
+        }
+    }
+
+    void _pop_locked(_lane &lane, value_type &out) {
+        lane._pq.pop_into(out);
+        _size.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+  public:
+    explicit concurrent_priority_queue(size_type lanes = 2 * std::max(1u, std::thread::hardware_concurrency()),
+                                       const Compare &compare = Compare());
+    concurrent_priority_queue(const concurrent_priority_queue &) = delete;
+    concurrent_priority_queue &operator=(const concurrent_priority_queue &) = delete;
+    ~concurrent_priority_queue() = default;
+
+    // capacity (approximate while other threads are running)
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        return _size.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] size_type lanes() const noexcept {
+        return _lane_count;
+    }
+
+    void push(const value_type &x) {
+        emplace(x);
+    }
+    void push(value_type &&x) {
+        emplace(std::move(x));
+    }
+    template <class... Args> void emplace(Args &&...args);
+    // Pops an element close to the top. Returns false only if every lane was observed empty.
+    [[nodiscard]] bool try_pop(value_type &out);
+};
+
+template <class T, class Container, class Compare>
+concurrent_priority_queue<T, Container, Compare>::concurrent_priority_queue(size_type lanes, const Compare &compare)
+    : _lanes(nullptr), _lane_count(std::max<size_type>(lanes, 1)), _size(0), _comp(compare) {
+    _lanes = std::make_unique<_lane[]>(_lane_count);
+    for (size_type i = 0; i < _lane_count; ++i) {
+        _lanes[i]._pq.set_compare(compare);
+    }
+}
+
+template <class T, class Container, class Compare>
+template <class... Args>
+void concurrent_priority_queue<T, Container, Compare>::emplace(Args &&...args) {
+    _lane &lane = _lock_random_lane();
+    try {
+        lane._pq.emplace(std::forward<Args>(args)...);
+    } catch (...) {
+        lane.unlock();
+        throw;
+    }
+    _size.fetch_add(1, std::memory_order_relaxed);
+    lane.unlock();
+}
+
+template <class T, class Container, class Compare>
+bool concurrent_priority_queue<T, Container, Compare>::try_pop(value_type &out) {
+    // two-choice: lock two random lanes and pop from the one with the better top
+    for (int attempt = 0; attempt < _pop_attempts && !empty(); ++attempt) {
+        _lane &first = _lock_random_lane();
+        _lane *second = &_lanes[_random_lane()];
+        if (second == &first || !second->try_lock())
+            second = nullptr;
+
+        _lane *best = first._pq.empty() ? nullptr : &first;
+        if (second && !second->_pq.empty() && (!best || _comp(best->_pq.top(), second->_pq.top())))
+            best = second;
+        if (best)
+            _pop_locked(*best, out);
+
+        if (second)
+            second->unlock();
+        first.unlock();
+        if (best)
+            return true;
+    }
+
+    // the random probes kept hitting empty lanes: sweep all of them before reporting empty
+    for (size_type i = 0; i < _lane_count; ++i) {
+        _lane &lane = _lanes[i];
+        while (!lane.try_lock()) {
+            std::this_thread::yield();
+        }
+        if (!lane._pq.empty()) {
+            _pop_locked(lane, out);
+            lane.unlock();
+            return true;
+        }
+        lane.unlock();
+    }
+    return false;
+}
+} // namespace j
@@ -411,6 +411,12 @@ template <class T, class Allocator> class deque<T, Allocator>::iterator {
         return _current;
     }
 
+    // block hooks for the parallel algorithms: [operator->(), _segment_end()) is contiguous
+    static constexpr difference_type _segment_size = _buffer_size();
+    pointer _segment_end() const noexcept {
+        return _last;
+    }
+
     iterator &operator++() noexcept {
         if (++_current == _last) {
             _set_node(_node + 1);
@@ -533,6 +539,12 @@ template <class T, class Allocator> class deque<T, Allocator>::const_iterator {
         return _current;
     }
 
+    // block hooks for the parallel algorithms: [operator->(), _segment_end()) is contiguous
+    static constexpr difference_type _segment_size = _buffer_size();
+    pointer _segment_end() const noexcept {
+        return _last;
+    }
+
     const_iterator &operator++() noexcept {
         if (++_current == _last) {
             _set_node(_node + 1);
@@ -0,0 +1,391 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+export module j:indexed_priority_queue;
+
+import :vector;
+import :heap_algo;
+
+namespace j {
+// key -> slot map shared by the indexed queues.
+// Keys go through a hash map unless the queue was given a key bound: integral keys in [0, key_bound) are then dense
+// ids looked up in a vector, and keys outside the bound are rejected.
+template <class Key, class Hash, class KeyEqual> class _key_index {
+  public:
+    using size_type = std::size_t;
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  private:
+    vector<size_type> _dense;
+    std::unordered_map<Key, size_type, Hash, KeyEqual> _map;
+    bool _bounded;
+
+    // position of key in _dense, npos if it lies outside the bound
+    size_type _id(const Key &key) const noexcept {
+        if constexpr (std::is_integral_v<Key>) {
+            if (std::in_range<size_type>(key) && static_cast<size_type>(key) < _dense.size())
+                return static_cast<size_type>(key);
+        }
+        return npos;
+    }
+
+  public:
+    _key_index() : _dense(), _map(), _bounded(false) {}
+    explicit _key_index(size_type key_bound)
+        requires std::is_integral_v<Key>
+        : _dense(key_bound, npos), _map(), _bounded(true) {}
+
+    // throws unless key can be stored; called before a new key touches the heap
+    void check(const Key &key) const {
+        if (_bounded && _id(key) == npos)
+            throw std::out_of_range("indexed queue : key is outside the declared key bound");
+    }
+
+    [[nodiscard]] size_type find(const Key &key) const {
+        if (_bounded) {
+            const size_type id = _id(key);
+            return id == npos ? npos : _dense[id];
+        }
+        auto it = _map.find(key);
+        return it == _map.end() ? npos : it->second;
+    }
+
+    void set(const Key &key, size_type slot) {
+        if (_bounded) {
+            _dense[_id(key)] = slot;
+        } else {
+            _map.insert_or_assign(key, slot);
+        }
+    }
+
+    void erase(const Key &key) {
+        if (_bounded) {
+            _dense[_id(key)] = npos;
+        } else {
+            _map.erase(key);
+        }
+    }
+
+    void clear() noexcept {
+        std::fill(_dense.begin(), _dense.end(), npos);
+        _map.clear();
+    }
+};
+
+// Addressable priority queue: a d-ary heap of (key, priority) pairs plus a key -> heap position index, so the
+// priority of a queued key can be changed or the key removed in O(log n) without duplicate entries.
+// Like j::priority_queue, top() is the element with the greatest priority under Compare
+// (use std::greater<Priority> for a min-queue, e.g. Dijkstra). Integral keys known to lie in [0, key_bound), such as
+// vertex ids, can skip the hash map by passing key_bound to the constructor.
+export template <class Key, class Priority, class Compare = std::less<Priority>, std::size_t Arity = 4,
+                 class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class indexed_priority_queue {
+  public:
+    using key_type = Key;
+    using priority_type = Priority;
+    using value_type = std::pair<Key, Priority>;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+    using priority_compare = Compare;
+
+  private:
+    struct _value_compare {
+        Compare _comp;
+        bool operator()(const value_type &a, const value_type &b) const {
+            return _comp(a.second, b.second);
+        }
+    };
+    struct _track {
+        _key_index<Key, Hash, KeyEqual> &_index;
+        void operator()(const value_type &v, std::ptrdiff_t slot) const {
+            _index.set(v.first, static_cast<size_type>(slot));
+        }
+    };
+
+    vector<value_type> _heap;
+    _key_index<Key, Hash, KeyEqual> _index;
+    _value_compare _comp;
+
+    void _sift_up(size_type slot) {
+        _track track{_index};
+        _sift_up_tracked<Arity>(_heap.begin(), static_cast<std::ptrdiff_t>(slot), _comp, track);
+    }
+    void _sift_down(size_type slot) {
+        _track track{_index};
+        _sift_down_tracked<Arity>(_heap.begin(), static_cast<std::ptrdiff_t>(slot),
+                                  static_cast<std::ptrdiff_t>(_heap.size()), _comp, track);
+    }
+    void _remove_at(size_type slot);
+
+  public:
+    indexed_priority_queue() : indexed_priority_queue(Compare()) {}
+    explicit indexed_priority_queue(const Compare &compare) : _heap(), _index(), _comp{compare} {}
+    explicit indexed_priority_queue(size_type key_bound, const Compare &compare = Compare())
+        requires std::is_integral_v<Key>
+        : _heap(), _index(key_bound), _comp{compare} {}
+
+    [[nodiscard]] bool empty() const noexcept {
+        return _heap.empty();
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        return _heap.size();
+    }
+    void reserve(size_type n) {
+        _heap.reserve(n);
+    }
+    void clear() noexcept {
+        _heap.clear();
+        _index.clear();
+    }
+
+    const_reference top() const {
+        return _heap.front();
+    }
+    [[nodiscard]] bool contains(const Key &key) const {
+        return _index.find(key) != _index.npos;
+    }
+    const Priority &priority(const Key &key) const;
+
+    // inserts key if it is not queued yet; returns false (and changes nothing) otherwise
+    bool push(const Key &key, const Priority &priority);
+    // sets the priority of key, inserting it if it is not queued (covers decrease-key and increase-key)
+    void update(const Key &key, const Priority &priority);
+    // removes key if it is queued; returns whether it was
+    bool erase(const Key &key);
+    void pop();
+};
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+const Priority &indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::priority(const Key &key) const {
+    const size_type slot = _index.find(key);
+    if (slot == _index.npos)
+        throw std::out_of_range("indexed_priority_queue::priority() : key is not queued");
+    return _heap[slot].second;
+}
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+bool indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::push(const Key &key,
+                                                                               const Priority &priority) {
+    if (contains(key))
+        return false;
+    _index.check(key);
+    _heap.emplace_back(key, priority);
+    _sift_up(_heap.size() - 1);
+    return true;
+}
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+void indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::update(const Key &key,
+                                                                                 const Priority &priority) {
+    const size_type slot = _index.find(key);
+    if (slot == _index.npos) {
+        _index.check(key);
+        _heap.emplace_back(key, priority);
+        _sift_up(_heap.size() - 1);
+        return;
+    }
+    const bool raised = _comp._comp(_heap[slot].second, priority);
+    _heap[slot].second = priority;
+    if (raised) {
+        _sift_up(slot);
+    } else {
+        _sift_down(slot);
+    }
+}
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+void indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::_remove_at(size_type slot) {
+    _index.erase(_heap[slot].first);
+    const size_type last = _heap.size() - 1;
+    if (slot != last) {
+        _heap[slot] = std::move(_heap[last]);
+        _heap.pop_back();
+        // the former last element may belong above or below its new slot
+        if (slot > 0 && _comp(_heap[(slot - 1) / Arity], _heap[slot])) {
+            _sift_up(slot);
+        } else {
+            _sift_down(slot);
+        }
+    } else {
+        _heap.pop_back();
+    }
+}
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+bool indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::erase(const Key &key) {
+    const size_type slot = _index.find(key);
+    if (slot == _index.npos)
+        return false;
+    _remove_at(slot);
+    return true;
+}
+
+template <class Key, class Priority, class Compare, std::size_t Arity, class Hash, class KeyEqual>
+void indexed_priority_queue<Key, Priority, Compare, Arity, Hash, KeyEqual>::pop() {
+    _remove_at(0);
+}
+
+// Indexed radix heap for monotone unsigned priorities: a min-queue where every pushed or updated priority is at
+// least the last minimum returned by top() or pop() (as in Dijkstra with non-negative weights). Keys live in
+// bit-width buckets relative to that minimum; push and update are O(1) and pop is amortized O(log C) for
+// priorities below C. As with indexed_priority_queue, a key_bound makes integral keys dense ids.
+export template <class Key, std::unsigned_integral Priority, class Hash = std::hash<Key>,
+                 class KeyEqual = std::equal_to<Key>>
+class indexed_radix_heap {
+  public:
+    using key_type = Key;
+    using priority_type = Priority;
+    using value_type = std::pair<Key, Priority>;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+
+  private:
+    // bucket 0 holds priority == _last, bucket b > 0 holds priorities whose highest bit differing from _last is b - 1
+    static constexpr size_type _bucket_count = std::numeric_limits<Priority>::digits + 1;
+
+    // top() redistributes lazily, so the buckets and their index are mutable
+    mutable vector<value_type> _buckets[_bucket_count];
+    mutable _key_index<Key, Hash, KeyEqual> _index; // slot = position * _bucket_count + bucket
+    mutable Priority _last;
+    size_type _size;
+
+    size_type _bucket_of(Priority priority) const noexcept {
+        return priority == _last ? 0 : static_cast<size_type>(std::bit_width(static_cast<Priority>(priority ^ _last)));
+    }
+
+    void _insert(const Key &key, Priority priority) const {
+        const size_type b = _bucket_of(priority);
+        _buckets[b].emplace_back(key, priority);
+        _index.set(key, (_buckets[b].size() - 1) * _bucket_count + b);
+    }
+
+    // swap-with-last removal from a bucket
+    void _unlink(size_type slot) {
+        const size_type b = slot % _bucket_count;
+        const size_type pos = slot / _bucket_count;
+        auto &bucket = _buckets[b];
+        if (pos != bucket.size() - 1) {
+            bucket[pos] = std::move(bucket.back());
+            _index.set(bucket[pos].first, slot);
+        }
+        bucket.pop_back();
+    }
+
+    // makes bucket 0 non-empty: moves _last up to the smallest priority of the first non-empty bucket and
+    // redistributes that bucket, whose elements all land in lower buckets. Done only when the minimum is asked for,
+    // so pushes between a pop and the next top() may still go as low as the popped priority.
+    void _refill() const {
+        if (!_buckets[0].empty())
+            return;
+        size_type b = 1;
+        while (_buckets[b].empty()) {
+            ++b;
+        }
+        auto &bucket = _buckets[b];
+        Priority minimum = bucket[0].second;
+        for (const auto &v : bucket) {
+            minimum = std::min(minimum, v.second);
+        }
+        _last = minimum;
+        for (auto &v : bucket) {
+            _insert(v.first, v.second);
+        }
+        bucket.clear();
+    }
+
+    void _check_monotone(Priority priority) const {
+        if (priority < _last)
+            throw std::invalid_argument("indexed_radix_heap: priority is below the last extracted minimum");
+    }
+
+  public:
+    indexed_radix_heap() : _index(), _last(0), _size(0) {}
+    explicit indexed_radix_heap(size_type key_bound)
+        requires std::is_integral_v<Key>
+        : _index(key_bound), _last(0), _size(0) {}
+
+    [[nodiscard]] bool empty() const noexcept {
+        return _size == 0;
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        return _size;
+    }
+    void clear() noexcept {
+        for (auto &bucket : _buckets) {
+            bucket.clear();
+        }
+        _index.clear();
+        _last = 0;
+        _size = 0;
+    }
+
+    // smallest (key, priority); requires a non-empty heap
+    const_reference top() const {
+        _refill();
+        return _buckets[0].back();
+    }
+    [[nodiscard]] bool contains(const Key &key) const {
+        return _index.find(key) != _index.npos;
+    }
+    Priority priority(const Key &key) const {
+        const size_type slot = _index.find(key);
+        if (slot == _index.npos)
+            throw std::out_of_range("indexed_radix_heap::priority() : key is not queued");
+        return _buckets[slot % _bucket_count][slot / _bucket_count].second;
+    }
+
+    bool push(const Key &key, Priority priority) {
+        if (contains(key))
+            return false;
+        _index.check(key);
+        _check_monotone(priority);
+        _insert(key, priority);
+        ++_size;
+        return true;
+    }
+
+    void update(const Key &key, Priority priority) {
+        const size_type slot = _index.find(key);
+        if (slot == _index.npos) {
+            push(key, priority);
+            return;
+        }
+        _check_monotone(priority);
+        _unlink(slot);
+        _insert(key, priority);
+    }
+
+    bool erase(const Key &key) {
+        const size_type slot = _index.find(key);
+        if (slot == _index.npos)
+            return false;
+        _unlink(slot);
+        _index.erase(key);
+        --_size;
+        return true;
+    }
+
+    void pop() {
+        _refill();
+        _index.erase(_buckets[0].back().first);
+        _buckets[0].pop_back();
+        --_size;
+    }
+};
+} // namespace j
@@ -5,7 +5,10 @@
  */
 
 module;
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <ranges>
 #include <type_traits>
 #include <utility>
 
@@ -176,7 +179,9 @@ queue<T, Container>::queue(InputIter first, InputIter last, const Alloc &alloc)
 } // namespace j
 
 namespace j {
-export template <class T, class Container = vector<T>, class Compare = std::less<typename Container::value_type>>
+// Arity selects the heap layout of the underlying container (2 = binary heap, 4 or 8 = shallower d-ary heaps).
+export template <class T, class Container = vector<T>, class Compare = std::less<typename Container::value_type>,
+                 std::size_t Arity = 2>
 class priority_queue {
   public:
     using value_type = typename Container::value_type;
@@ -249,7 +254,11 @@ class priority_queue {
     void push(const value_type &x);
     void push(value_type &&x);
     template <class... Args> void emplace(Args &&...args);
+    template <class R>
+        requires std::ranges::input_range<R>
+    void push_range(R &&rg);
     void pop();
+    template <class OutputIter> OutputIter pop_n(OutputIter out, size_type n);
     void swap(priority_queue &pq) noexcept(std::is_nothrow_swappable_v<Container> &&
                                            std::is_nothrow_swappable_v<Compare>) {
         using std::swap;
@@ -284,160 +293,200 @@ template <class InputIt, class Compare, class Container, class Alloc>
 priority_queue(InputIt, InputIt, Compare, Container, Alloc)
     -> priority_queue<typename Container::value_type, Container, Compare>;
 
-export template <class T, class Container>
-void swap(priority_queue<T, Container> &x, priority_queue<T, Container> &y) noexcept(noexcept(x.swap(y))) {
+export template <class T, class Container, class Compare, std::size_t Arity>
+void swap(priority_queue<T, Container, Compare, Arity> &x, priority_queue<T, Container, Compare, Arity> &y) noexcept(
+    noexcept(x.swap(y))) {
     x.swap(y);
 }
 } // namespace j
 
-template <class T, class Container, class Compare, class Alloc>
-struct std::uses_allocator<j::priority_queue<T, Container, Compare>, Alloc>
+template <class T, class Container, class Compare, std::size_t Arity, class Alloc>
+struct std::uses_allocator<j::priority_queue<T, Container, Compare, Arity>, Alloc>
     : std::uses_allocator<Container, Alloc>::type {};
 
 namespace j {
-template <class T, class Container, class Compare>
-priority_queue<T, Container, Compare>::priority_queue(const Compare &compare, const Container &cont)
+template <class T, class Container, class Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare, const Container &cont)
     : _c(cont), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
-priority_queue<T, Container, Compare>::priority_queue(const Compare &compare, Container &&cont)
+template <class T, class Container, class Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare, Container &&cont)
     : _c(std::move(cont)), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
-priority_queue<T, Container, Compare>::priority_queue(const priority_queue &pq) : _c(pq._c), _comp(pq._comp) {}
+template <class T, class Container, class Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(const priority_queue &pq) : _c(pq._c), _comp(pq._comp) {}
 
-template <class T, class Container, class Compare>
-priority_queue<T, Container, Compare>::priority_queue(priority_queue &&pq)
+template <class T, class Container, class Compare, std::size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(priority_queue &&pq)
     : _c(std::move(pq._c)), _comp(std::move(pq._comp)) {}
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter>
     requires std::input_iterator<InputIter>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare)
     : _c(first, last), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter>
     requires std::input_iterator<InputIter>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare,
-                                                      const Container &cont)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare,
+                                                             const Container &cont)
     : _c(cont), _comp(compare) {
     _c.insert(_c.end(), first, last);
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter>
     requires std::input_iterator<InputIter>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare,
-                                                      Container &&cont)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare,
+                                                             Container &&cont)
     : _c(std::move(cont)), _comp(compare) {
     _c.insert(_c.end(), first, last);
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(const Alloc &alloc) : _c(alloc), _comp() {}
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Alloc &alloc) : _c(alloc), _comp() {}
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(const Compare &compare, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare, const Alloc &alloc)
     : _c(alloc), _comp(compare) {}
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(const Compare &compare, const Container &cont, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare, const Container &cont,
+                                                             const Alloc &alloc)
     : _c(cont, alloc), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(const Compare &compare, Container &&cont, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare, Container &&cont,
+                                                             const Alloc &alloc)
     : _c(std::move(cont), alloc), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(const priority_queue &pq, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(const priority_queue &pq, const Alloc &alloc)
     : _c(pq._c, alloc), _comp(pq._comp) {}
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class Alloc>
     requires std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(priority_queue &&pq, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(priority_queue &&pq, const Alloc &alloc)
     : _c(std::move(pq._c), alloc), _comp(std::move(pq._comp)) {}
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter, class Alloc>
     requires std::input_iterator<InputIter> && std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Alloc &alloc)
     : _c(first, last, alloc), _comp() {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter, class Alloc>
     requires std::input_iterator<InputIter> && std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare,
-                                                      const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare,
+                                                             const Alloc &alloc)
     : _c(first, last, alloc), _comp(compare) {
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter, class Alloc>
     requires std::input_iterator<InputIter> && std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare,
-                                                      const Container &cont, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare,
+                                                             const Container &cont, const Alloc &alloc)
     : _c(cont, alloc), _comp(compare) {
     _c.insert(_c.end(), first, last);
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class InputIter, class Alloc>
     requires std::input_iterator<InputIter> && std::uses_allocator_v<Container, Alloc>
-priority_queue<T, Container, Compare>::priority_queue(InputIter first, InputIter last, const Compare &compare,
-                                                      Container &&cont, const Alloc &alloc)
+priority_queue<T, Container, Compare, Arity>::priority_queue(InputIter first, InputIter last, const Compare &compare,
+                                                             Container &&cont, const Alloc &alloc)
     : _c(std::move(cont), alloc), _comp(compare) {
     _c.insert(_c.end(), first, last);
-    make_heap(_c.begin(), _c.end(), _comp);
+    make_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
-void priority_queue<T, Container, Compare>::push(const value_type &x) {
+template <class T, class Container, class Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(const value_type &x) {
     _c.push_back(x);
-    push_heap(_c.begin(), _c.end(), _comp);
+    push_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare> void priority_queue<T, Container, Compare>::push(value_type &&x) {
+template <class T, class Container, class Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type &&x) {
     _c.push_back(std::move(x));
-    push_heap(_c.begin(), _c.end(), _comp);
+    push_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare>
+template <class T, class Container, class Compare, std::size_t Arity>
 template <class... Args>
-void priority_queue<T, Container, Compare>::emplace(Args &&...args) {
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
     _c.emplace_back(std::forward<Args>(args)...);
-    push_heap(_c.begin(), _c.end(), _comp);
+    push_heap<Arity>(_c.begin(), _c.end(), _comp);
 }
 
-template <class T, class Container, class Compare> void priority_queue<T, Container, Compare>::pop() {
-    pop_heap(_c.begin(), _c.end(), _comp);
+template <class T, class Container, class Compare, std::size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+    pop_heap<Arity>(_c.begin(), _c.end(), _comp);
     _c.pop_back();
 }
+
+// appends the whole range and restores the heap in one batch (see push_heap_range). If reading or appending an
+// element throws, the elements appended so far are removed again, so the heap is left as it was.
+template <class T, class Container, class Compare, std::size_t Arity>
+template <class R>
+    requires std::ranges::input_range<R>
+void priority_queue<T, Container, Compare, Arity>::push_range(R &&rg) {
+    const size_type old_size = _c.size();
+    try {
+        for (auto &&x : rg) {
+            _c.push_back(std::forward<decltype(x)>(x));
+        }
+    } catch (...) {
+        while (_c.size() > old_size) {
+            _c.pop_back();
+        }
+        throw;
+    }
+    push_heap_range<Arity>(_c.begin(), _c.begin() + static_cast<typename Container::difference_type>(old_size),
+                           _c.end(), _comp);
+}
+
+// moves the top min(n, size()) elements to out in priority order and removes them
+template <class T, class Container, class Compare, std::size_t Arity>
+template <class OutputIter>
+OutputIter priority_queue<T, Container, Compare, Arity>::pop_n(OutputIter out, size_type n) {
+    n = std::min(n, _c.size());
+    pop_heap_n<Arity>(_c.begin(), _c.end(), static_cast<typename Container::difference_type>(n), _comp);
+    for (size_type i = 0; i < n; ++i) {
+        *out = std::move(_c.back());
+        ++out;
+        _c.pop_back();
+    }
+    return out;
+}
 } // namespace j
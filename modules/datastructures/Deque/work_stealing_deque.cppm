@@ -0,0 +1,179 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+export module j:work_stealing_deque;
+
+import :vector;
+import :concurrent_queue;
+
+namespace j {
+// Lock-free Chase-Lev work-stealing deque (with the memory orderings of Le, Pop, Cohen and Zappa Nardelli, 2013).
+// One owner thread pushes and pops at the bottom, like a stack; any number of thieves take the oldest element from the
+// top. Owner and thieves only contend for the last element. The ring doubles when full; the retired rings are kept
+// until destruction, since a slow thief may still be reading one.
+// T is copied in and out of the ring with relaxed atomics, so it must be trivially copyable (typically a pointer).
+export template <class T, class Allocator = std::allocator<T>> class work_stealing_deque {
+    static_assert(std::is_trivially_copyable_v<T>, "work_stealing_deque elements must be trivially copyable");
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+
+  private:
+    using index_type = std::int64_t;
+
+    struct _ring {
+        index_type _mask;
+        std::atomic<T> *_slots;
+
+        T load(index_type i) const noexcept {
+            return _slots[i & _mask].load(std::memory_order_relaxed);
+        }
+        void store(index_type i, T x) noexcept {
+            _slots[i & _mask].store(x, std::memory_order_relaxed);
+        }
+    };
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::atomic<T>>;
+
+    alignas(_cache_line_size) std::atomic<index_type> _top;    // next element to steal
+    alignas(_cache_line_size) std::atomic<index_type> _bottom; // next free slot, written by the owner only
+    alignas(_cache_line_size) std::atomic<_ring *> _ring_ptr;
+    vector<_ring *> _rings; // every ring ever allocated, the current one last; owner only
+    slot_allocator _slot_alloc;
+
+    _ring *_allocate_ring(index_type capacity);
+    _ring *_grow(_ring *ring, index_type bottom, index_type top);
+
+  public:
+    explicit work_stealing_deque(size_type capacity = 256, const Allocator &alloc = Allocator());
+    work_stealing_deque(const work_stealing_deque &) = delete;
+    work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+    ~work_stealing_deque();
+
+    // approximate while other threads are running
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        const index_type bottom = _bottom.load(std::memory_order_relaxed);
+        const index_type top = _top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+    [[nodiscard]] size_type capacity() const noexcept {
+        return static_cast<size_type>(_ring_ptr.load(std::memory_order_relaxed)->_mask + 1);
+    }
+
+    // owner only
+    void push(T x);
+    [[nodiscard]] bool try_pop(T &out) noexcept;
+
+    // any thread; fails when the deque is empty or another thread won the race for the top element
+    [[nodiscard]] bool try_steal(T &out) noexcept;
+};
+
+template <class T, class Allocator>
+work_stealing_deque<T, Allocator>::work_stealing_deque(size_type capacity, const Allocator &alloc)
+    : _top(0), _bottom(0), _ring_ptr(nullptr), _slot_alloc(alloc) {
+    index_type rounded = 2;
+    while (rounded < static_cast<index_type>(capacity)) {
+        rounded <<= 1;
+    }
+    _rings.reserve(8);
+    _ring_ptr.store(_allocate_ring(rounded), std::memory_order_relaxed);
+}
+
+template <class T, class Allocator> work_stealing_deque<T, Allocator>::~work_stealing_deque() {
+    for (_ring *ring : _rings) {
+        std::allocator_traits<slot_allocator>::deallocate(_slot_alloc, ring->_slots,
+                                                          static_cast<size_type>(ring->_mask + 1));
+        delete ring;
+    }
+}
+
+template <class T, class Allocator>
+typename work_stealing_deque<T, Allocator>::_ring *work_stealing_deque<T, Allocator>::_allocate_ring(
+    index_type capacity) {
+    auto ring = std::make_unique<_ring>();
+    ring->_mask = capacity - 1;
+    ring->_slots = std::allocator_traits<slot_allocator>::allocate(_slot_alloc, static_cast<size_type>(capacity));
+    for (index_type i = 0; i < capacity; ++i) {
+        std::construct_at(ring->_slots + i); // std::atomic<T> is trivially destructible, never destroyed
+    }
+    try {
+        _rings.push_back(ring.get());
+    } catch (...) {
+        std::allocator_traits<slot_allocator>::deallocate(_slot_alloc, ring->_slots, static_cast<size_type>(capacity));
+        throw;
+    }
+    return ring.release();
+}
+
+template <class T, class Allocator>
+typename work_stealing_deque<T, Allocator>::_ring *work_stealing_deque<T, Allocator>::_grow(_ring *ring,
+                                                                                            index_type bottom,
+                                                                                            index_type top) {
+    _ring *bigger = _allocate_ring(2 * (ring->_mask + 1));
+    for (index_type i = top; i < bottom; ++i) {
+        bigger->store(i, ring->load(i));
+    }
+    _ring_ptr.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+template <class T, class Allocator> void work_stealing_deque<T, Allocator>::push(T x) {
+    const index_type bottom = _bottom.load(std::memory_order_relaxed);
+    const index_type top = _top.load(std::memory_order_acquire);
+    _ring *ring = _ring_ptr.load(std::memory_order_relaxed);
+    if (bottom - top > ring->_mask)
+        ring = _grow(ring, bottom, top);
+    ring->store(bottom, x);
+    // a release store rather than Le et al.'s release fence: the same ordering, and visible to ThreadSanitizer
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template <class T, class Allocator> bool work_stealing_deque<T, Allocator>::try_pop(T &out) noexcept {
+    const index_type bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _ring *ring = _ring_ptr.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    index_type top = _top.load(std::memory_order_relaxed);
+    if (top > bottom) { // empty
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    out = ring->load(bottom);
+    if (top == bottom) {
+        // the last element: race the thieves for it
+        const bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+template <class T, class Allocator> bool work_stealing_deque<T, Allocator>::try_steal(T &out) noexcept {
+    index_type top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const index_type bottom = _bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+        return false;
+    _ring *ring = _ring_ptr.load(std::memory_order_acquire);
+    const T x = ring->load(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+    out = x;
+    return true;
+}
+} // namespace j
@@ -8,11 +8,19 @@ module;
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 export module j:forward_list;
 
+import :list_algo;
+
 namespace j {
-export template <class T, class Allocator = std::allocator<T>> class forward_list {
+// bookkeeping policies for forward_list
+export struct forward_list_plain {};   // the layout of std::forward_list: one pointer, no size
+export struct forward_list_tracked {}; // also keeps the size and a tail pointer: O(1) size, back, push_back and
+                                       // splice_after of a whole list
+
+export template <class T, class Allocator = std::allocator<T>, class Policy = forward_list_plain> class forward_list {
   public:
     using value_type = T;
     using allocator_type = std::allocator<T>;
@@ -29,13 +37,57 @@ export template <class T, class Allocator = std::allocator<T>> class forward_lis
     struct _forward_list_node;
     using Node = _forward_list_node;
 
+    static constexpr bool _tracked = std::is_same_v<Policy, forward_list_tracked>;
+    struct _plain_state {};
+    struct _tracked_state {
+        size_type _size;
+        Node *_tail; // last node, or the before-head node when empty
+    };
+
     using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
     Node *_before_head;
     node_allocator _node_alloc;
-    // size_type size; didn't use for faster performance
+    // the plain policy keeps no size for the smallest footprint and the cheapest splices
+    [[no_unique_address]] std::conditional_t<_tracked, _tracked_state, _plain_state> _state;
 
-    // helper function (sort)
-    template <class Compare> void _sort_impl(forward_list &x, Compare comp);
+    // node -> element projection for the shared list algorithms
+    struct _node_value {
+        T &operator()(Node *node) const noexcept {
+            return node->_value;
+        }
+    };
+
+    // bookkeeping hooks; no-ops under the plain policy
+    void _reset_state() noexcept {
+        if constexpr (_tracked) {
+            _state._size = 0;
+            _state._tail = _before_head;
+        }
+    }
+    void _linked_after(Node *position, Node *node) noexcept {
+        if constexpr (_tracked) {
+            ++_state._size;
+            if (position == _state._tail)
+                _state._tail = node;
+        }
+    }
+    void _unlinked_after(Node *position, Node *node) noexcept {
+        if constexpr (_tracked) {
+            --_state._size;
+            if (node == _state._tail)
+                _state._tail = position;
+        }
+    }
+    // finds the tail again after an operation that reorders the whole list
+    void _find_tail() noexcept {
+        if constexpr (_tracked) {
+            Node *tail = _before_head;
+            while (tail->_next != nullptr) {
+                tail = tail->_next;
+            }
+            _state._tail = tail;
+        }
+    }
 
   public:
     // constructor and destructor
@@ -79,13 +131,40 @@ export template <class T, class Allocator = std::allocator<T>> class forward_lis
     const_iterator cbefore_begin() const noexcept;
     const_iterator cend() const noexcept;
 
+    // the last element, or before_begin() when empty: insert_after and splice_after there append in O(1)
+    iterator before_end() noexcept
+        requires _tracked
+    {
+        return iterator(_state._tail);
+    }
+    const_iterator before_end() const noexcept
+        requires _tracked
+    {
+        return const_iterator(_state._tail);
+    }
+
     // capacity
     bool empty() const noexcept;
     size_type max_size() const noexcept;
+    size_type size() const noexcept
+        requires _tracked
+    {
+        return _state._size;
+    }
 
     // element access
     reference front();
     const_reference front() const;
+    reference back()
+        requires _tracked
+    {
+        return _state._tail->_value;
+    }
+    const_reference back() const
+        requires _tracked
+    {
+        return _state._tail->_value;
+    }
 
     // modifiers -> need to modify method impl order
     template <class... Args> reference emplace_front(Args &&...args);
@@ -93,6 +172,23 @@ export template <class T, class Allocator = std::allocator<T>> class forward_lis
     void push_front(T &&value);
     void pop_front();
 
+    template <class... Args>
+    reference emplace_back(Args &&...args)
+        requires _tracked
+    {
+        return *emplace_after(before_end(), std::forward<Args>(args)...);
+    }
+    void push_back(const T &value)
+        requires _tracked
+    {
+        emplace_back(value);
+    }
+    void push_back(T &&value)
+        requires _tracked
+    {
+        emplace_back(std::move(value));
+    }
+
     template <class... Args> iterator emplace_after(const_iterator position, Args &&...args);
     iterator insert_after(const_iterator position, const T &value);
     iterator insert_after(const_iterator position, T &&value);
@@ -146,43 +242,47 @@ template <class InputIter, class Allocator = std::allocator<typename std::iterat
 forward_list(InputIter first, InputIter last, const Allocator & = Allocator())
     -> forward_list<typename std::iterator_traits<InputIter>::value_type, Allocator>;
 
-export template <class T, class Allocator>
-constexpr bool operator==(const forward_list<T, Allocator> &lhs, const forward_list<T, Allocator> &rhs) {
+export template <class T, class Allocator, class Policy>
+constexpr bool operator==(const forward_list<T, Allocator, Policy> &lhs,
+                          const forward_list<T, Allocator, Policy> &rhs) {
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-export template <class T, class Allocator>
-constexpr auto operator<=>(const forward_list<T, Allocator> &lhs, const forward_list<T, Allocator> &rhs) {
+export template <class T, class Allocator, class Policy>
+constexpr auto operator<=>(const forward_list<T, Allocator, Policy> &lhs,
+                           const forward_list<T, Allocator, Policy> &rhs) {
     return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
                                                   std::compare_three_way{});
 }
 
-export template <class T, class Allocator>
-constexpr void swap(forward_list<T, Allocator> &x, forward_list<T, Allocator> &y) noexcept(noexcept(x.swap(y))) {
+export template <class T, class Allocator, class Policy>
+constexpr void swap(forward_list<T, Allocator, Policy> &x,
+                    forward_list<T, Allocator, Policy> &y) noexcept(noexcept(x.swap(y))) {
     x.swap(y);
 }
 
-export template <class T, class Allocator, class U>
-constexpr typename forward_list<T, Allocator>::size_type erase(forward_list<T, Allocator> &c, const U &value) {
+export template <class T, class Allocator, class Policy, class U>
+constexpr typename forward_list<T, Allocator, Policy>::size_type erase(forward_list<T, Allocator, Policy> &c,
+                                                                       const U &value) {
     return c.remove(value);
 }
 
-export template <class T, class Allocator, class Predicate>
-constexpr typename forward_list<T, Allocator>::size_type erase_if(forward_list<T, Allocator> &c, Predicate pred) {
+export template <class T, class Allocator, class Policy, class Predicate>
+constexpr typename forward_list<T, Allocator, Policy>::size_type erase_if(forward_list<T, Allocator, Policy> &c,
+                                                                          Predicate pred) {
     return c.remove_if(pred);
 }
 
-template <class T, class Allocator> struct forward_list<T, Allocator>::_forward_list_node {
+template <class T, class Allocator, class Policy> struct forward_list<T, Allocator, Policy>::_forward_list_node {
     friend forward_list;
     friend iterator;
     friend const_iterator;
 
-  private:
     value_type _value;
     _forward_list_node *_next;
 };
 
-template <class T, class Allocator> class forward_list<T, Allocator>::iterator {
+template <class T, class Allocator, class Policy> class forward_list<T, Allocator, Policy>::iterator {
     friend forward_list;
 
   public:
@@ -230,7 +330,7 @@ template <class T, class Allocator> class forward_list<T, Allocator>::iterator {
     }
 };
 
-template <class T, class Allocator> class forward_list<T, Allocator>::const_iterator {
+template <class T, class Allocator, class Policy> class forward_list<T, Allocator, Policy>::const_iterator {
     friend forward_list;
 
   public:
@@ -278,30 +378,31 @@ template <class T, class Allocator> class forward_list<T, Allocator>::const_iter
 } // namespace j
 
 namespace j {
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(const Allocator &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(const Allocator &alloc)
     : _node_alloc(std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {
     _before_head = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
     std::construct_at(&_before_head->_value);
     _before_head->_next = nullptr; // Initialize the next pointer to nullptr
+    _reset_state();
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(const size_type n, const Allocator &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(const size_type n, const Allocator &alloc)
     : forward_list(n, T(), std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {}
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(const size_type n, const T &value, const Allocator &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(const size_type n, const T &value, const Allocator &alloc)
     : forward_list(std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {
     for (size_type i = 0; i < n; ++i) {
         emplace_front(value);
     }
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class InputIter>
     requires std::input_iterator<InputIter>
-forward_list<T, Allocator>::forward_list(InputIter first, InputIter last, const Allocator &alloc)
+forward_list<T, Allocator, Policy>::forward_list(InputIter first, InputIter last, const Allocator &alloc)
     : forward_list(std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {
     auto it = before_begin();
     for (; first != last; ++first) {
@@ -309,46 +410,48 @@ forward_list<T, Allocator>::forward_list(InputIter first, InputIter last, const
     }
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(const forward_list &x)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(const forward_list &x)
     : forward_list(x.begin(), x.end(),
                    std::allocator_traits<Allocator>::select_on_container_copy_construction(x._node_alloc)) {}
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(forward_list &&x) noexcept
-    : _before_head(x._before_head), _node_alloc(x._node_alloc) {
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(forward_list &&x) noexcept
+    : _before_head(x._before_head), _node_alloc(x._node_alloc), _state(x._state) {
     x._before_head = std::allocator_traits<node_allocator>::allocate(x._node_alloc, 1);
     std::construct_at(&x._before_head->_value);
     x._before_head->_next = nullptr; // Initialize the next pointer to nullptr
+    x._reset_state();
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(const forward_list &x, const std::type_identity_t<Allocator> &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(const forward_list &x, const std::type_identity_t<Allocator> &alloc)
     : forward_list(x.begin(), x.end(), std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(forward_list &&x, const std::type_identity_t<Allocator> &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(forward_list &&x, const std::type_identity_t<Allocator> &alloc)
     : _before_head(x._before_head),
-      _node_alloc(std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {
+      _node_alloc(std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)), _state(x._state) {
     x._before_head = std::allocator_traits<node_allocator>::allocate(x._node_alloc, 1);
     std::construct_at(&x._before_head->_value);
     x._before_head->_next = nullptr; // Initialize the next pointer to nullptr
+    x._reset_state();
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator>::forward_list(std::initializer_list<T> il, const Allocator &alloc)
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy>::forward_list(std::initializer_list<T> il, const Allocator &alloc)
     : forward_list(il.begin(), il.end(),
                    std::allocator_traits<Allocator>::select_on_container_copy_construction(alloc)) {}
 
-template <class T, class Allocator> forward_list<T, Allocator>::~forward_list() {
+template <class T, class Allocator, class Policy> forward_list<T, Allocator, Policy>::~forward_list() {
     clear();
     std::destroy_at(&_before_head->_value);
     std::allocator_traits<node_allocator>::deallocate(_node_alloc, _before_head, 1);
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(const forward_list &x) {
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy> &forward_list<T, Allocator, Policy>::operator=(const forward_list &x) {
     if (this != std::addressof(x)) {
         clear();
         auto it = before_begin();
@@ -359,8 +462,8 @@ forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(const forward_
     return *this;
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(forward_list &&x) noexcept(
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy> &forward_list<T, Allocator, Policy>::operator=(forward_list &&x) noexcept(
     std::allocator_traits<Allocator>::is_always_equal::value) {
     if (this != std::addressof(x)) {
         clear();
@@ -368,16 +471,18 @@ forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(forward_list &
         std::allocator_traits<node_allocator>::deallocate(_node_alloc, _before_head, 1);
         _before_head = x._before_head;
         _node_alloc = x._node_alloc;
+        _state = x._state;
 
         x._before_head = std::allocator_traits<node_allocator>::allocate(x._node_alloc, 1);
         std::construct_at(&x._before_head->_value);
         x._before_head->_next = nullptr; // Initialize the next pointer to nullptr
+        x._reset_state();
     }
     return *this;
 }
 
-template <class T, class Allocator>
-forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(std::initializer_list<T> il) {
+template <class T, class Allocator, class Policy>
+forward_list<T, Allocator, Policy> &forward_list<T, Allocator, Policy>::operator=(std::initializer_list<T> il) {
     clear();
     auto it = before_begin();
     for (const T &t : il) {
@@ -386,10 +491,10 @@ forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(std::initializ
     return *this;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class InputIt>
     requires std::input_iterator<InputIt>
-void forward_list<T, Allocator>::assign(InputIt first, InputIt last) {
+void forward_list<T, Allocator, Policy>::assign(InputIt first, InputIt last) {
     clear();
     auto it = before_begin();
     for (; first != last; ++first) {
@@ -397,189 +502,181 @@ void forward_list<T, Allocator>::assign(InputIt first, InputIt last) {
     }
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::assign(size_type count, const T &value) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::assign(size_type count, const T &value) {
     clear();
-    for (int i = 0; i < count; i++) {
+    for (size_type i = 0; i < count; i++) {
         emplace_front(value);
     }
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::assign(std::initializer_list<T> il) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::assign(std::initializer_list<T> il) {
     assign(il.begin(), il.end());
 }
 
-template <class T, class Allocator> std::allocator<T> forward_list<T, Allocator>::get_allocator() const noexcept {
+template <class T, class Allocator, class Policy>
+std::allocator<T> forward_list<T, Allocator, Policy>::get_allocator() const noexcept {
     return std::allocator<T>(_node_alloc);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::before_begin() noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator forward_list<T, Allocator, Policy>::before_begin() noexcept {
     return iterator(_before_head);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::before_begin() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator
+forward_list<T, Allocator, Policy>::before_begin() const noexcept {
     return const_iterator(_before_head);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::begin() noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator forward_list<T, Allocator, Policy>::begin() noexcept {
     return iterator(_before_head->_next);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::begin() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator forward_list<T, Allocator, Policy>::begin() const noexcept {
     return const_iterator(_before_head->_next);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::end() noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator forward_list<T, Allocator, Policy>::end() noexcept {
     return iterator(nullptr);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::end() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator forward_list<T, Allocator, Policy>::end() const noexcept {
     return const_iterator(nullptr);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cbegin() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator
+forward_list<T, Allocator, Policy>::cbegin() const noexcept {
     return const_iterator(_before_head->_next);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cbefore_begin() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator
+forward_list<T, Allocator, Policy>::cbefore_begin() const noexcept {
     return iterator(_before_head);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cend() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::const_iterator forward_list<T, Allocator, Policy>::cend() const noexcept {
     return const_iterator(nullptr);
 }
 
-template <class T, class Allocator> bool forward_list<T, Allocator>::empty() const noexcept {
+template <class T, class Allocator, class Policy> bool forward_list<T, Allocator, Policy>::empty() const noexcept {
     return _before_head->_next == nullptr;
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::max_size() const noexcept {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::size_type forward_list<T, Allocator, Policy>::max_size() const noexcept {
     return std::allocator_traits<node_allocator>::max_size(_node_alloc);
 }
 
-template <class T, class Allocator> T &forward_list<T, Allocator>::front() {
+template <class T, class Allocator, class Policy> T &forward_list<T, Allocator, Policy>::front() {
     return _before_head->_next->_value;
 }
 
-template <class T, class Allocator> const T &forward_list<T, Allocator>::front() const {
+template <class T, class Allocator, class Policy> const T &forward_list<T, Allocator, Policy>::front() const {
     return _before_head->_next->_value;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class... Args>
-T &forward_list<T, Allocator>::emplace_front(Args &&...args) {
-    Node *new_node = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
-    std::construct_at(&new_node->_value, std::forward<Args>(args)...);
-    new_node->_next = _before_head->_next;
-    _before_head->_next = new_node;
-    return new_node->_value;
+T &forward_list<T, Allocator, Policy>::emplace_front(Args &&...args) {
+    return *emplace_after(before_begin(), std::forward<Args>(args)...);
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::push_front(const T &value) {
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::push_front(const T &value) {
     emplace_front(value);
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::push_front(T &&value) {
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::push_front(T &&value) {
     emplace_front(std::move(value));
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::pop_front() {
-    Node *del_node = _before_head->_next;
-    if (!del_node)
-        return;
-
-    _before_head->_next = del_node->_next;
-    std::destroy_at(&del_node->_value);
-    std::allocator_traits<node_allocator>::deallocate(_node_alloc, del_node, 1);
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::pop_front() {
+    erase_after(before_begin());
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class... Args>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::emplace_after(const_iterator position,
-                                                                                        Args &&...args) {
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::emplace_after(const_iterator position, Args &&...args) {
     Node *new_node = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
-    std::construct_at(&new_node->_value, std::forward<Args>(args)...);
+    try {
+        std::construct_at(&new_node->_value, std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<node_allocator>::deallocate(_node_alloc, new_node, 1);
+        throw;
+    }
 
     new_node->_next = position._ptr->_next;
     position._ptr->_next = new_node;
+    _linked_after(position._ptr, new_node);
 
     return iterator(new_node);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator position,
-                                                                                       const T &value) {
-    Node *new_node = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
-    std::construct_at(&new_node->_value, value);
-
-    new_node->_next = position._ptr->_next;
-    position._ptr->_next = new_node;
-
-    return iterator(new_node);
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::insert_after(const_iterator position, const T &value) {
+    return emplace_after(position, value);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator position,
-                                                                                       T &&value) {
-    Node *new_node = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
-    std::construct_at(&new_node->_value, value);
-
-    new_node->_next = position._ptr->_next;
-    position._ptr->_next = new_node;
-
-    return iterator(new_node);
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::insert_after(const_iterator position, T &&value) {
+    return emplace_after(position, std::move(value));
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert_after(const_iterator position, size_type count, const T &value) {
-    for (int i = 0; i < count; i++) {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::insert_after(const_iterator position, size_type count, const T &value) {
+    for (size_type i = 0; i < count; i++) {
         position = insert_after(position, value);
     }
     return iterator(position._ptr);
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class InputIter>
     requires std::input_iterator<InputIter>
-typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert_after(const_iterator position, InputIter first, InputIter last) {
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::insert_after(const_iterator position, InputIter first, InputIter last) {
     for (; first != last; ++first) {
         position = emplace_after(position, *first);
     }
     return iterator(position._ptr);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(const_iterator position,
-                                                                                       std::initializer_list<T> il) {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::insert_after(const_iterator position, std::initializer_list<T> il) {
     return insert_after(position, il.begin(), il.end());
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::erase_after(const_iterator position) {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::erase_after(const_iterator position) {
     Node *del_node = position._ptr->_next;
     if (!del_node)
         return end();
 
     position._ptr->_next = del_node->_next;
+    _unlinked_after(position._ptr, del_node);
     std::destroy_at(&del_node->_value);
     std::allocator_traits<node_allocator>::deallocate(_node_alloc, del_node, 1);
     return iterator(position._ptr->_next);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::erase_after(const_iterator position,
-                                                                                      const_iterator last) {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::iterator
+forward_list<T, Allocator, Policy>::erase_after(const_iterator position, const_iterator last) {
     const_iterator del_pos = std::next(position);
     while (del_pos != last) {
         del_pos = erase_after(position);
@@ -587,19 +684,30 @@ typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::erase_
     return iterator(last._ptr);
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::swap(forward_list &x) noexcept(
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::swap(forward_list &x) noexcept(
     noexcept(std::allocator_traits<node_allocator>::is_always_equal::value)) {
     using std::swap;
     swap(_before_head, x._before_head);
     swap(_node_alloc, x._node_alloc);
+    swap(_state, x._state); // the tails point into the swapped node chains, so they follow them
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::resize(size_type nsz) {
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::resize(size_type nsz) {
     resize(nsz, T());
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::resize(size_type nsz, const T &value) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::resize(size_type nsz, const T &value) {
+    if constexpr (_tracked) {
+        // growing appends at the tail without a walk
+        if (nsz >= _state._size) {
+            while (_state._size < nsz) {
+                emplace_back(value);
+            }
+            return;
+        }
+    }
     size_type size = 0;
     auto prev = before_begin();
     auto it = begin();
@@ -623,7 +731,7 @@ template <class T, class Allocator> void forward_list<T, Allocator>::resize(size
     }
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::clear() noexcept {
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::clear() noexcept {
     for (auto it = begin(); it != end();) {
         auto temp = it;
         ++it;
@@ -631,63 +739,78 @@ template <class T, class Allocator> void forward_list<T, Allocator>::clear() noe
         std::allocator_traits<node_allocator>::deallocate(_node_alloc, temp._ptr, 1);
     }
     _before_head->_next = nullptr;
+    _reset_state();
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &x) {
-    if (!x.empty()) {
-        iterator last = x.before_begin();
-        while (std::next(last) != x.end()) {
-            ++last;
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &x) {
+    if (x.empty())
+        return;
+    Node *last;
+    if constexpr (_tracked) {
+        last = x._state._tail;
+        _state._size += x._state._size;
+        if (position._ptr == _state._tail)
+            _state._tail = last;
+    } else {
+        last = x._before_head;
+        while (last->_next != nullptr) {
+            last = last->_next;
         }
-        last._ptr->_next = position._ptr->_next;
-        position._ptr->_next = x._before_head->_next;
-        x._before_head->_next = nullptr;
     }
+    last->_next = position._ptr->_next;
+    position._ptr->_next = x._before_head->_next;
+    x._before_head->_next = nullptr;
+    x._reset_state();
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &&x) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &&x) {
     splice_after(position, x);
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &x, const_iterator i) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &x, const_iterator i) {
     Node *moved = i._ptr->_next;
-    if (!moved)
+    if (!moved || position._ptr == i._ptr || position._ptr == moved)
         return;
-    i._ptr->_next = i._ptr->_next->_next;
+    i._ptr->_next = moved->_next;
+    x._unlinked_after(i._ptr, moved);
     moved->_next = position._ptr->_next;
     position._ptr->_next = moved;
+    _linked_after(position._ptr, moved);
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &&x, const_iterator i) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &&x, const_iterator i) {
     splice_after(position, x, i);
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &x, const_iterator first,
-                                              const_iterator last) {
-    if (first == last)
-        return;
-    const_iterator last_before = first;
-    while (std::next(last_before) != last) {
-        ++last_before;
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &x, const_iterator first,
+                                                      const_iterator last) {
+    auto [last_moved, moved] = _slist_transfer_after(position._ptr, first._ptr, last._ptr);
+    if constexpr (_tracked) {
+        if (moved == 0)
+            return;
+        // the range ended x's list, so first is its new tail; position was the tail, so the range ends this list
+        if (last._ptr == nullptr)
+            x._state._tail = first._ptr;
+        if (position._ptr == _state._tail)
+            _state._tail = last_moved;
+        x._state._size -= moved;
+        _state._size += moved;
     }
-    last_before._ptr->_next = position._ptr->_next;
-    position._ptr->_next = first._ptr->_next;
-    first._ptr->_next = last._ptr;
 }
 
-template <class T, class Allocator>
-void forward_list<T, Allocator>::splice_after(const_iterator position, forward_list &&other, const_iterator first,
-                                              const_iterator last) {
+template <class T, class Allocator, class Policy>
+void forward_list<T, Allocator, Policy>::splice_after(const_iterator position, forward_list &&other,
+                                                      const_iterator first, const_iterator last) {
     splice_after(position, other, first, last);
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::remove(const T &value) {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::size_type forward_list<T, Allocator, Policy>::remove(const T &value) {
     size_type count = 0;
     auto it = before_begin();
 
@@ -703,10 +826,10 @@ typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::remov
     return count;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class Predicate>
     requires std::predicate<Predicate, T>
-typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::remove_if(Predicate pred) {
+typename forward_list<T, Allocator, Policy>::size_type forward_list<T, Allocator, Policy>::remove_if(Predicate pred) {
     size_type count = 0;
 
     auto it = before_begin();
@@ -723,107 +846,93 @@ typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::remov
     return count;
 }
 
-template <class T, class Allocator>
-typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::unique() {
+template <class T, class Allocator, class Policy>
+typename forward_list<T, Allocator, Policy>::size_type forward_list<T, Allocator, Policy>::unique() {
     return unique(std::equal_to<T>());
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class BinaryPredicate>
     requires std::predicate<BinaryPredicate, T, T>
-typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::unique(BinaryPredicate binary_pred) {
-    size_type count = 0;
-
-    auto it = before_begin();
-
-    while (std::next(it) != end() && std::next(std::next(it)) != end()) {
-        if (binary_pred(*std::next(it), *std::next(std::next(it)))) {
-            erase_after(it);
-            ++count;
-        } else {
-            ++it;
-        }
-    }
-    return count;
-}
-
-template <class T, class Allocator> void forward_list<T, Allocator>::merge(forward_list &x) {
+typename forward_list<T, Allocator, Policy>::size_type
+forward_list<T, Allocator, Policy>::unique(BinaryPredicate binary_pred) {
+    size_type removed = 0;
+    try {
+        removed = _slist_unique(_before_head, _node_value(), binary_pred, [this](Node *node) {
+            std::destroy_at(&node->_value);
+            std::allocator_traits<node_allocator>::deallocate(_node_alloc, node, 1);
+            if constexpr (_tracked)
+                --_state._size;
+        });
+    } catch (...) {
+        _find_tail();
+        throw;
+    }
+    if (removed != 0)
+        _find_tail();
+    return removed;
+}
+
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::merge(forward_list &x) {
     merge(x, std::less<T>());
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::merge(forward_list &&x) {
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::merge(forward_list &&x) {
     merge(x, std::less<T>());
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class Compare>
-void forward_list<T, Allocator>::merge(forward_list &x, Compare comp) {
+void forward_list<T, Allocator, Policy>::merge(forward_list &x, Compare comp) {
     if (this == std::addressof(x) || x.empty())
         return;
-
-    iterator it = before_begin();
-    iterator xit = x.before_begin();
-    while (std::next(it) != end() && std::next(xit) != x.end()) {
-        if (!comp(*std::next(xit), *std::next(it))) {
-            ++it;
-        } else {
-            splice_after(it, x, xit);
-            ++it;
+    if constexpr (_tracked) {
+        // every node of x ends up in *this, even if comp throws, and the last node is one of the two tails
+        Node *tail = _state._tail;
+        Node *x_tail = x._state._tail;
+        _state._size += x._state._size;
+        x._reset_state();
+        auto fix_tail = [&] { _state._tail = tail == _before_head || tail->_next != nullptr ? x_tail : tail; };
+        try {
+            _slist_merge(_before_head, x._before_head, _node_value(), comp);
+        } catch (...) {
+            fix_tail();
+            throw;
         }
-    }
-    if (std::next(xit) != x.end()) {
-        splice_after(it, x, xit, x.end());
+        fix_tail();
+    } else {
+        _slist_merge(_before_head, x._before_head, _node_value(), comp);
     }
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class Compare>
-void forward_list<T, Allocator>::merge(forward_list &&x, Compare comp) {
+void forward_list<T, Allocator, Policy>::merge(forward_list &&x, Compare comp) {
     merge(static_cast<forward_list &>(x), comp);
 }
 
-template <class T, class Allocator> void forward_list<T, Allocator>::sort() {
-    _sort_impl(*this, std::less<T>());
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::sort() {
+    sort(std::less<T>());
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Policy>
 template <class Compare>
     requires std::strict_weak_order<Compare, T, T>
-void forward_list<T, Allocator>::sort(Compare comp) {
-    _sort_impl(*this, comp);
-}
-
-template <class T, class Allocator> void forward_list<T, Allocator>::reverse() noexcept {
-    if (empty())
-        return;
-    Node *prev = nullptr;
-    Node *current = _before_head->_next;
-    while (current != nullptr) {
-        Node *next = current->_next;
-        current->_next = prev;
-        prev = current;
-        current = next;
+void forward_list<T, Allocator, Policy>::sort(Compare comp) {
+    try {
+        _slist_sort(_before_head, _node_value(), comp);
+    } catch (...) {
+        _find_tail();
+        throw;
     }
-    _before_head->_next = prev;
+    _find_tail();
 }
 
-template <class T, class Allocator>
-template <class Compare>
-void forward_list<T, Allocator>::_sort_impl(forward_list &x, Compare comp) {
-    if (x.empty() || std::next(x.begin()) == x.end()) {
-        return;
+template <class T, class Allocator, class Policy> void forward_list<T, Allocator, Policy>::reverse() noexcept {
+    if constexpr (_tracked) {
+        if (_before_head->_next != nullptr)
+            _state._tail = _before_head->_next;
     }
-    auto slow = x.begin();
-    auto fast = x.begin();
-    while (std::next(fast) != x.end() && std::next(fast, 2) != x.end()) {
-        std::advance(slow, 1);
-        std::advance(fast, 2);
-    }
-
-    forward_list<T, Allocator> temp;
-    temp.splice_after(temp.before_begin(), x, slow, x.end());
-    _sort_impl(x, comp);
-    _sort_impl(temp, comp);
-    x.merge(temp, comp);
+    _slist_reverse(_before_head);
 }
 } // namespace j
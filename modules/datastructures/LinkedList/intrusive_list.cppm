@@ -0,0 +1,816 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+export module j:intrusive_list;
+
+import :list_algo;
+
+namespace j {
+// Hook members for the intrusive containers. An object can sit on as many intrusive lists at once as it has
+// hooks, e.g. `list_hook lru; list_hook dirty;`. The pointers are managed by the container.
+// The owning type must be standard-layout, so that the hook sits at a fixed offset the container can step back by.
+export struct list_hook {
+    list_hook *_next = nullptr;
+    list_hook *_prev = nullptr;
+
+    list_hook() noexcept = default;
+    // copying an object does not copy its list membership
+    list_hook(const list_hook &) noexcept {}
+    list_hook &operator=(const list_hook &) noexcept {
+        return *this;
+    }
+
+    [[nodiscard]] bool is_linked() const noexcept {
+        return _next != nullptr;
+    }
+};
+
+export struct forward_list_hook {
+    forward_list_hook *_next = nullptr;
+
+    forward_list_hook() noexcept = default;
+    forward_list_hook(const forward_list_hook &) noexcept {}
+    forward_list_hook &operator=(const forward_list_hook &) noexcept {
+        return *this;
+    }
+};
+
+// hook <-> owning object, through the hook's offset inside T
+template <class T, class Hook, Hook T::*Member> struct _hook_traits {
+    static_assert(std::is_standard_layout_v<T>, "intrusive containers need a standard-layout element type");
+
+    // GCC and Clang (Itanium C++ ABI) and MSVC all represent a pointer to a data member of a standard-layout class
+    // as the member's byte offset, so the offset is read from Member itself rather than from a T that does not exist
+    static std::ptrdiff_t offset() noexcept {
+        static const std::ptrdiff_t value = [] {
+            if constexpr (sizeof(Member) == sizeof(std::ptrdiff_t)) {
+                return std::bit_cast<std::ptrdiff_t>(Member);
+            } else {
+                static_assert(sizeof(Member) == sizeof(std::int32_t), "unknown pointer to member layout");
+                return static_cast<std::ptrdiff_t>(std::bit_cast<std::int32_t>(Member));
+            }
+        }();
+        return value;
+    }
+    static T *owner(Hook *hook) noexcept {
+        return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) - offset());
+    }
+    static Hook *hook(T &object) noexcept {
+        return &(object.*Member);
+    }
+    struct value {
+        T &operator()(Hook *hook) const noexcept {
+            return *owner(hook);
+        }
+    };
+};
+
+// Doubly linked list threaded through a list_hook member of T. It never allocates and never owns its elements:
+// insert links the given object, erase and clear only unlink. Sorting, merging and splicing share their
+// implementation with j::list.
+export template <class T, list_hook T::*Hook> class intrusive_list {
+  public:
+    using value_type = T;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  private:
+    using Node = list_hook;
+    using traits = _hook_traits<T, list_hook, Hook>;
+
+    Node _sentinel;
+    size_type _size;
+
+    void _reset() noexcept {
+        _sentinel._next = &_sentinel;
+        _sentinel._prev = &_sentinel;
+        _size = 0;
+    }
+    // takes over x's nodes; *this must be empty
+    void _adopt(intrusive_list &x) noexcept;
+    static void _unlink(Node *node) noexcept {
+        node->_prev->_next = node->_next;
+        node->_next->_prev = node->_prev;
+        node->_next = nullptr;
+        node->_prev = nullptr;
+    }
+
+  public:
+    intrusive_list() noexcept {
+        _reset();
+    }
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    intrusive_list(InputIter first, InputIter last) : intrusive_list() {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+    intrusive_list(const intrusive_list &) = delete;
+    intrusive_list(intrusive_list &&x) noexcept : intrusive_list() {
+        _adopt(x);
+    }
+    ~intrusive_list() {
+        clear();
+    }
+
+    intrusive_list &operator=(const intrusive_list &) = delete;
+    intrusive_list &operator=(intrusive_list &&x) noexcept {
+        if (this != std::addressof(x)) {
+            clear();
+            _adopt(x);
+        }
+        return *this;
+    }
+
+    // iterators
+    iterator begin() noexcept {
+        return iterator(_sentinel._next);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(_sentinel._next);
+    }
+    iterator end() noexcept {
+        return iterator(&_sentinel);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(const_cast<Node *>(&_sentinel));
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // iterator to an object that is on this list, in O(1)
+    iterator iterator_to(reference value) noexcept {
+        return iterator(traits::hook(value));
+    }
+    const_iterator iterator_to(const_reference value) const noexcept {
+        return const_iterator(traits::hook(const_cast<reference>(value)));
+    }
+
+    // capacity
+    [[nodiscard]] bool empty() const noexcept {
+        return _size == 0;
+    }
+    size_type size() const noexcept {
+        return _size;
+    }
+
+    // element access
+    reference front() {
+        return *begin();
+    }
+    const_reference front() const {
+        return *begin();
+    }
+    reference back() {
+        return *std::prev(end());
+    }
+    const_reference back() const {
+        return *std::prev(end());
+    }
+
+    // modifiers; the object must not be on another list through the same hook
+    void push_front(reference value) noexcept {
+        insert(begin(), value);
+    }
+    void push_back(reference value) noexcept {
+        insert(end(), value);
+    }
+    void pop_front() noexcept {
+        erase(begin());
+    }
+    void pop_back() noexcept {
+        erase(std::prev(end()));
+    }
+    iterator insert(const_iterator position, reference value) noexcept;
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    iterator insert(const_iterator position, InputIter first, InputIter last);
+
+    // unlink the elements; the objects themselves are untouched
+    iterator erase(const_iterator position) noexcept;
+    iterator erase(const_iterator first, const_iterator last) noexcept;
+    void swap(intrusive_list &x) noexcept;
+    void clear() noexcept;
+
+    // list operations
+    void splice(const_iterator position, intrusive_list &x) noexcept;
+    void splice(const_iterator position, intrusive_list &x, const_iterator i) noexcept;
+    void splice(const_iterator position, intrusive_list &x, const_iterator first, const_iterator last) noexcept;
+
+    size_type remove(const T &value);
+    template <class Predicate>
+        requires std::predicate<Predicate, T>
+    size_type remove_if(Predicate pred);
+
+    size_type unique();
+    template <class BinaryPredicate>
+        requires std::predicate<BinaryPredicate, T, T>
+    size_type unique(BinaryPredicate binary_pred);
+
+    void merge(intrusive_list &x);
+    template <class Compare> void merge(intrusive_list &x, Compare comp);
+
+    void sort();
+    template <class Compare>
+        requires std::strict_weak_order<Compare, T, T>
+    void sort(Compare comp);
+
+    void reverse() noexcept;
+};
+
+export template <class T, list_hook T::*Hook>
+void swap(intrusive_list<T, Hook> &x, intrusive_list<T, Hook> &y) noexcept {
+    x.swap(y);
+}
+
+template <class T, list_hook T::*Hook> class intrusive_list<T, Hook>::iterator {
+    friend intrusive_list;
+
+  public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+  private:
+    Node *_ptr;
+
+  public:
+    explicit iterator(Node *ptr = nullptr) noexcept : _ptr(ptr) {}
+
+    reference operator*() const noexcept {
+        return *traits::owner(_ptr);
+    }
+    pointer operator->() const noexcept {
+        return traits::owner(_ptr);
+    }
+
+    iterator &operator++() noexcept {
+        _ptr = _ptr->_next;
+        return *this;
+    }
+    iterator operator++(int) noexcept {
+        iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    iterator &operator--() noexcept {
+        _ptr = _ptr->_prev;
+        return *this;
+    }
+    iterator operator--(int) noexcept {
+        iterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+        return _ptr == other._ptr;
+    }
+    operator const_iterator() const noexcept {
+        return const_iterator(_ptr);
+    }
+};
+
+template <class T, list_hook T::*Hook> class intrusive_list<T, Hook>::const_iterator {
+    friend intrusive_list;
+
+  public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+  private:
+    Node *_ptr;
+
+  public:
+    explicit const_iterator(Node *ptr = nullptr) noexcept : _ptr(ptr) {}
+
+    reference operator*() const noexcept {
+        return *traits::owner(_ptr);
+    }
+    pointer operator->() const noexcept {
+        return traits::owner(_ptr);
+    }
+
+    const_iterator &operator++() noexcept {
+        _ptr = _ptr->_next;
+        return *this;
+    }
+    const_iterator operator++(int) noexcept {
+        const_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    const_iterator &operator--() noexcept {
+        _ptr = _ptr->_prev;
+        return *this;
+    }
+    const_iterator operator--(int) noexcept {
+        const_iterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept {
+        return _ptr == other._ptr;
+    }
+};
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::_adopt(intrusive_list &x) noexcept {
+    if (x.empty())
+        return;
+    _dlist_transfer(&_sentinel, x._sentinel._next, &x._sentinel);
+    _size = x._size;
+    x._size = 0;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator position,
+                                                                           reference value) noexcept {
+    Node *node = traits::hook(value);
+    node->_prev = position._ptr->_prev;
+    node->_next = position._ptr;
+    position._ptr->_prev->_next = node;
+    position._ptr->_prev = node;
+    ++_size;
+    return iterator(node);
+}
+
+template <class T, list_hook T::*Hook>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator position, InputIter first,
+                                                                           InputIter last) {
+    iterator result(position._ptr);
+    bool first_inserted = true;
+    for (; first != last; ++first) {
+        iterator it = insert(position, *first);
+        if (first_inserted) {
+            result = it;
+            first_inserted = false;
+        }
+    }
+    return result;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator position) noexcept {
+    Node *next = position._ptr->_next;
+    _unlink(position._ptr);
+    --_size;
+    return iterator(next);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator first,
+                                                                          const_iterator last) noexcept {
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last._ptr);
+}
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::swap(intrusive_list &x) noexcept {
+    intrusive_list temp(std::move(x));
+    x._adopt(*this);
+    _adopt(temp);
+}
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::clear() noexcept {
+    for (Node *node = _sentinel._next; node != &_sentinel;) {
+        Node *next = node->_next;
+        node->_next = nullptr;
+        node->_prev = nullptr;
+        node = next;
+    }
+    _reset();
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator position, intrusive_list &x) noexcept {
+    if (this == std::addressof(x) || x.empty())
+        return;
+    _dlist_transfer(position._ptr, x._sentinel._next, &x._sentinel);
+    _size += x._size;
+    x._size = 0;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator position, intrusive_list &x, const_iterator i) noexcept {
+    if (position == i || position._ptr == i._ptr->_next)
+        return;
+    _dlist_transfer(position._ptr, i._ptr, i._ptr->_next);
+    --x._size;
+    ++_size;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator position, intrusive_list &x, const_iterator first,
+                                     const_iterator last) noexcept {
+    if (first == last)
+        return;
+    if (this != std::addressof(x)) {
+        const auto distance = static_cast<size_type>(std::distance(first, last));
+        x._size -= distance;
+        _size += distance;
+    }
+    _dlist_transfer(position._ptr, first._ptr, last._ptr);
+}
+
+template <class T, list_hook T::*Hook> typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::remove(
+    const T &value) {
+    return remove_if([&](const T &x) { return x == value; });
+}
+
+template <class T, list_hook T::*Hook>
+template <class Predicate>
+    requires std::predicate<Predicate, T>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::remove_if(Predicate pred) {
+    size_type original_size = size();
+    for (auto it = begin(); it != end();) {
+        if (pred(*it)) {
+            it = erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return original_size - size();
+}
+
+template <class T, list_hook T::*Hook> typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <class T, list_hook T::*Hook>
+template <class BinaryPredicate>
+    requires std::predicate<BinaryPredicate, T, T>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::unique(BinaryPredicate binary_pred) {
+    return _dlist_unique(&_sentinel, typename traits::value(), binary_pred, [this](Node *node) {
+        node->_next = nullptr;
+        node->_prev = nullptr;
+        --_size;
+    });
+}
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::merge(intrusive_list &x) {
+    merge(x, std::less<T>());
+}
+
+template <class T, list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list &x, Compare comp) {
+    if (this == std::addressof(x) || x.empty())
+        return;
+    _size += x._size;
+    x._size = 0;
+    _dlist_merge(&_sentinel, &x._sentinel, typename traits::value(), comp);
+}
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::sort() {
+    sort(std::less<T>());
+}
+
+template <class T, list_hook T::*Hook>
+template <class Compare>
+    requires std::strict_weak_order<Compare, T, T>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+    _dlist_sort(&_sentinel, typename traits::value(), comp);
+}
+
+template <class T, list_hook T::*Hook> void intrusive_list<T, Hook>::reverse() noexcept {
+    _dlist_reverse(&_sentinel);
+}
+
+// Singly linked counterpart threaded through a forward_list_hook member of T; like j::forward_list it keeps
+// no size and works after a before-begin position.
+export template <class T, forward_list_hook T::*Hook> class intrusive_forward_list {
+  public:
+    using value_type = T;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    class iterator;
+    class const_iterator;
+
+  private:
+    using Node = forward_list_hook;
+    using traits = _hook_traits<T, forward_list_hook, Hook>;
+
+    Node _before_head;
+
+  public:
+    intrusive_forward_list() noexcept = default;
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    intrusive_forward_list(InputIter first, InputIter last) {
+        insert_after(before_begin(), first, last);
+    }
+    intrusive_forward_list(const intrusive_forward_list &) = delete;
+    intrusive_forward_list(intrusive_forward_list &&x) noexcept {
+        _before_head._next = x._before_head._next;
+        x._before_head._next = nullptr;
+    }
+    ~intrusive_forward_list() {
+        clear();
+    }
+
+    intrusive_forward_list &operator=(const intrusive_forward_list &) = delete;
+    intrusive_forward_list &operator=(intrusive_forward_list &&x) noexcept {
+        if (this != std::addressof(x)) {
+            clear();
+            _before_head._next = x._before_head._next;
+            x._before_head._next = nullptr;
+        }
+        return *this;
+    }
+
+    // iterators
+    iterator before_begin() noexcept {
+        return iterator(&_before_head);
+    }
+    const_iterator before_begin() const noexcept {
+        return const_iterator(const_cast<Node *>(&_before_head));
+    }
+    iterator begin() noexcept {
+        return iterator(_before_head._next);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(_before_head._next);
+    }
+    iterator end() noexcept {
+        return iterator(nullptr);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(nullptr);
+    }
+    const_iterator cbefore_begin() const noexcept {
+        return before_begin();
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // iterator to an object that is on this list, in O(1)
+    iterator iterator_to(reference value) noexcept {
+        return iterator(traits::hook(value));
+    }
+    const_iterator iterator_to(const_reference value) const noexcept {
+        return const_iterator(traits::hook(const_cast<reference>(value)));
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return _before_head._next == nullptr;
+    }
+
+    reference front() {
+        return *begin();
+    }
+    const_reference front() const {
+        return *begin();
+    }
+
+    // modifiers; the object must not be on another list through the same hook
+    void push_front(reference value) noexcept {
+        insert_after(before_begin(), value);
+    }
+    void pop_front() noexcept {
+        erase_after(before_begin());
+    }
+    iterator insert_after(const_iterator position, reference value) noexcept {
+        Node *node = traits::hook(value);
+        node->_next = position._ptr->_next;
+        position._ptr->_next = node;
+        return iterator(node);
+    }
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    iterator insert_after(const_iterator position, InputIter first, InputIter last) {
+        iterator it(position._ptr);
+        for (; first != last; ++first) {
+            it = insert_after(it, *first);
+        }
+        return it;
+    }
+
+    // unlink the elements; the objects themselves are untouched
+    iterator erase_after(const_iterator position) noexcept {
+        Node *node = position._ptr->_next;
+        position._ptr->_next = node->_next;
+        node->_next = nullptr;
+        return iterator(position._ptr->_next);
+    }
+    iterator erase_after(const_iterator position, const_iterator last) noexcept {
+        while (position._ptr->_next != last._ptr) {
+            erase_after(position);
+        }
+        return iterator(last._ptr);
+    }
+    void swap(intrusive_forward_list &x) noexcept {
+        std::swap(_before_head._next, x._before_head._next);
+    }
+    void clear() noexcept {
+        erase_after(before_begin(), end());
+    }
+
+    // forward_list operations
+    void splice_after(const_iterator position, intrusive_forward_list &x) noexcept {
+        splice_after(position, x, x.before_begin(), x.end());
+    }
+    void splice_after(const_iterator position, intrusive_forward_list &, const_iterator i) noexcept {
+        if (position == i || i._ptr->_next == nullptr || position._ptr == i._ptr->_next)
+            return;
+        _slist_transfer_after(position._ptr, i._ptr, i._ptr->_next->_next);
+    }
+    void splice_after(const_iterator position, intrusive_forward_list &, const_iterator first,
+                      const_iterator last) noexcept {
+        _slist_transfer_after(position._ptr, first._ptr, last._ptr);
+    }
+
+    size_type remove(const T &value) {
+        return remove_if([&](const T &x) { return x == value; });
+    }
+    template <class Predicate>
+        requires std::predicate<Predicate, T>
+    size_type remove_if(Predicate pred) {
+        size_type count = 0;
+        for (Node *prev = &_before_head; prev->_next != nullptr;) {
+            if (pred(*traits::owner(prev->_next))) {
+                erase_after(const_iterator(prev));
+                ++count;
+            } else {
+                prev = prev->_next;
+            }
+        }
+        return count;
+    }
+
+    size_type unique() {
+        return unique(std::equal_to<T>());
+    }
+    template <class BinaryPredicate>
+        requires std::predicate<BinaryPredicate, T, T>
+    size_type unique(BinaryPredicate binary_pred) {
+        return _slist_unique(&_before_head, typename traits::value(), binary_pred,
+                             [](Node *node) { node->_next = nullptr; });
+    }
+
+    void merge(intrusive_forward_list &x) {
+        merge(x, std::less<T>());
+    }
+    template <class Compare> void merge(intrusive_forward_list &x, Compare comp) {
+        if (this == std::addressof(x))
+            return;
+        _slist_merge(&_before_head, &x._before_head, typename traits::value(), comp);
+    }
+
+    void sort() {
+        sort(std::less<T>());
+    }
+    template <class Compare>
+        requires std::strict_weak_order<Compare, T, T>
+    void sort(Compare comp) {
+        _slist_sort(&_before_head, typename traits::value(), comp);
+    }
+
+    void reverse() noexcept {
+        _slist_reverse(&_before_head);
+    }
+};
+
+export template <class T, forward_list_hook T::*Hook>
+void swap(intrusive_forward_list<T, Hook> &x, intrusive_forward_list<T, Hook> &y) noexcept {
+    x.swap(y);
+}
+
+template <class T, forward_list_hook T::*Hook> class intrusive_forward_list<T, Hook>::iterator {
+    friend intrusive_forward_list;
+
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+  private:
+    Node *_ptr;
+
+  public:
+    explicit iterator(Node *ptr = nullptr) noexcept : _ptr(ptr) {}
+
+    reference operator*() const noexcept {
+        return *traits::owner(_ptr);
+    }
+    pointer operator->() const noexcept {
+        return traits::owner(_ptr);
+    }
+
+    iterator &operator++() noexcept {
+        _ptr = _ptr->_next;
+        return *this;
+    }
+    iterator operator++(int) noexcept {
+        iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+        return _ptr == other._ptr;
+    }
+    operator const_iterator() const noexcept {
+        return const_iterator(_ptr);
+    }
+};
+
+template <class T, forward_list_hook T::*Hook> class intrusive_forward_list<T, Hook>::const_iterator {
+    friend intrusive_forward_list;
+
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+  private:
+    Node *_ptr;
+
+  public:
+    explicit const_iterator(Node *ptr = nullptr) noexcept : _ptr(ptr) {}
+
+    reference operator*() const noexcept {
+        return *traits::owner(_ptr);
+    }
+    pointer operator->() const noexcept {
+        return traits::owner(_ptr);
+    }
+
+    const_iterator &operator++() noexcept {
+        _ptr = _ptr->_next;
+        return *this;
+    }
+    const_iterator operator++(int) noexcept {
+        const_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept {
+        return _ptr == other._ptr;
+    }
+};
+} // namespace j
@@ -11,6 +11,8 @@ module;
 
 export module j:list;
 
+import :list_algo;
+
 namespace j {
 export template <class T, class Allocator = std::allocator<T>> class list {
   public:
@@ -36,8 +38,12 @@ export template <class T, class Allocator = std::allocator<T>> class list {
     node_allocator _node_alloc;
     size_type _size;
 
-    // helper function (sort)
-    template <class Compare> void _sort_impl(list &x, Compare comp);
+    // node -> element projection for the shared list algorithms
+    struct _node_value {
+        T &operator()(Node *node) const noexcept {
+            return node->_value;
+        }
+    };
 
   public:
     // constructor and destructor
@@ -187,7 +193,6 @@ template <class T, class Allocator> struct list<T, Allocator>::_list_node {
     friend iterator;
     friend const_iterator;
 
-  private:
     value_type _value;
     _list_node *_next;
     _list_node *_prev;
@@ -699,14 +704,8 @@ template <class T, class Allocator> void list<T, Allocator>::clear() noexcept {
 
 template <class T, class Allocator> void list<T, Allocator>::splice(const_iterator position, list &x) {
     if (!x.empty()) {
-        x._sentinel->_next->_prev = position._ptr->_prev;
-        position._ptr->_prev->_next = x._sentinel->_next;
-        x._sentinel->_prev->_next = position._ptr;
-        position._ptr->_prev = x._sentinel->_prev;
-
+        _dlist_transfer(position._ptr, x._sentinel->_next, x._sentinel);
         _size += x._size;
-        x._sentinel->_prev = x._sentinel;
-        x._sentinel->_next = x._sentinel;
         x._size = 0;
     }
 }
@@ -717,14 +716,10 @@ template <class T, class Allocator> void list<T, Allocator>::splice(const_iterat
 
 template <class T, class Allocator>
 void list<T, Allocator>::splice(const_iterator position, list &x, const_iterator i) {
-    i._ptr->_prev->_next = i._ptr->_next;
-    i._ptr->_next->_prev = i._ptr->_prev;
+    if (position == i || position._ptr == i._ptr->_next)
+        return;
+    _dlist_transfer(position._ptr, i._ptr, i._ptr->_next);
     --x._size;
-
-    i._ptr->_prev = position._ptr->_prev;
-    position._ptr->_prev->_next = i._ptr;
-    i._ptr->_next = position._ptr;
-    position._ptr->_prev = i._ptr;
     ++_size;
 }
 
@@ -739,15 +734,8 @@ void list<T, Allocator>::splice(const_iterator position, list &x, const_iterator
     if (distance == 0)
         return;
 
-    Node *last_range_node = last._ptr->_prev;
-    first._ptr->_prev->_next = last._ptr;
-    last._ptr->_prev = first._ptr->_prev;
+    _dlist_transfer(position._ptr, first._ptr, last._ptr);
     x._size -= distance;
-
-    first._ptr->_prev = position._ptr->_prev;
-    position._ptr->_prev->_next = first._ptr;
-    last_range_node->_next = position._ptr;
-    position._ptr->_prev = last_range_node;
     _size += distance;
 }
 
@@ -791,21 +779,11 @@ template <class T, class Allocator>
 template <class BinaryPredicate>
     requires std::predicate<BinaryPredicate, T, T>
 typename list<T, Allocator>::size_type list<T, Allocator>::unique(BinaryPredicate binary_pred) {
-    if (empty()) {
-        return 0;
-    }
-    size_type original_size = size();
-    auto it = begin();
-    auto next = std::next(it);
-    while (next != end()) {
-        if (binary_pred(*it, *next)) {
-            next = erase(next);
-        } else {
-            it = next;
-            ++next;
-        }
-    }
-    return original_size - size();
+    return _dlist_unique(_sentinel, _node_value(), binary_pred, [this](Node *node) {
+        std::destroy_at(&node->_value);
+        std::allocator_traits<node_allocator>::deallocate(_node_alloc, node, 1);
+        --_size;
+    });
 }
 
 template <class T, class Allocator> void list<T, Allocator>::merge(list &x) {
@@ -820,62 +798,32 @@ template <class T, class Allocator> template <class Compare> void list<T, Alloca
     if (this == std::addressof(x) || x.empty())
         return;
 
-    auto it = begin();
-    auto xit = x.begin();
-    while (it != end() && xit != x.end()) {
-        if (!comp(*xit, *it)) {
-            ++it;
-        } else {
-            auto xit_next = std::next(xit);
-            splice(it, x, xit);
-            xit = xit_next;
-        }
-    }
-    if (xit != x.end()) {
-        splice(end(), x, xit, x.end());
-    }
+    // every node of x ends up in *this, even if comp throws
+    _size += x._size;
+    x._size = 0;
+    _dlist_merge(_sentinel, x._sentinel, _node_value(), comp);
 }
 
 template <class T, class Allocator> template <class Compare> void list<T, Allocator>::merge(list &&x, Compare comp) {
     merge(static_cast<list &>(x), comp);
 }
 
-template <class T, class Allocator>
-template <class Compare>
-void list<T, Allocator>::_sort_impl(list &x, Compare comp) { // merge sort
-    if (x.size() <= 1) {
-        return;
-    }
-    auto mid = x.begin();
-    std::advance(mid, x.size() / 2);
-
-    list<T, Allocator> temp;
-    temp.splice(temp.begin(), x, mid, x.end());
-    _sort_impl(x, comp);
-    _sort_impl(temp, comp);
-    x.merge(temp, comp);
-}
-
 template <class T, class Allocator> void list<T, Allocator>::sort() {
-    _sort_impl(*this, std::less<T>());
+    sort(std::less<T>());
 }
 
 template <class T, class Allocator>
 template <class Compare>
     requires std::strict_weak_order<Compare, T, T>
 void list<T, Allocator>::sort(Compare comp) {
-    _sort_impl(*this, comp);
+    if constexpr (_gather_sortable<T>) {
+        if (_size >= _gather_sort_threshold && _dlist_gather_sort(_sentinel, _size, _node_value(), comp))
+            return;
+    }
+    _dlist_sort(_sentinel, _node_value(), comp);
 }
 
 template <class T, class Allocator> void list<T, Allocator>::reverse() noexcept {
-    if (empty()) {
-        return;
-    }
-    auto next = std::next(begin());
-    while (next != end()) {
-        auto temp = next;
-        next = std::next(next);
-        splice(begin(), *this, temp);
-    }
+    _dlist_reverse(_sentinel);
 }
 } // namespace j
@@ -0,0 +1,388 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+
+export module j:timer_wheel;
+
+import :vector;
+
+namespace j {
+// Hierarchical hashed timer wheel (Varghese & Lauck). Level L has 2^SlotBits slots of 2^(L * SlotBits) ticks each;
+// a timer sits on the lowest level where its deadline and the current tick agree on every higher digit, and is
+// cascaded one level down when the wheel reaches its slot. Insert and cancel are O(1); advance() costs O(1) per
+// expired or cascaded timer and skips empty slots through per-level occupancy masks.
+// Deadlines beyond the top level wait in an overflow list that is redistributed once per full turn.
+export template <class T, std::size_t SlotBits = 6, std::size_t Levels = 4, class Allocator = std::allocator<T>>
+class timer_wheel {
+    static_assert(SlotBits >= 1 && SlotBits <= 6, "timer_wheel: a level's occupancy mask is one 64-bit word");
+    static_assert(Levels >= 1 && SlotBits * Levels < 64, "timer_wheel: levels must not cover the whole tick range");
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using tick_type = std::uint64_t;
+    class handle;
+
+  private:
+    struct _timer_link {
+        _timer_link *_prev;
+        _timer_link *_next;
+    };
+    struct _timer_node : _timer_link {
+        tick_type _deadline;
+        std::uint64_t _id; // 0 once fired or cancelled, so stale handles are detected
+        size_type _slot;
+        alignas(T) unsigned char _storage[sizeof(T)];
+
+        T &value() noexcept {
+            return *std::launder(reinterpret_cast<T *>(_storage));
+        }
+    };
+    using Node = _timer_node;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+    static constexpr size_type _slot_count = size_type{1} << SlotBits;
+    static constexpr size_type _slot_mask = _slot_count - 1;
+    static constexpr size_type _total_bits = SlotBits * Levels;
+    static constexpr size_type _due_slot = Levels * _slot_count; // deadline already reached
+    static constexpr size_type _overflow_slot = _due_slot + 1;   // deadline beyond the top level
+    static constexpr size_type _detached = _due_slot + 2;        // taken out of its slot for cascading or firing
+
+    vector<_timer_link> _slots; // Levels * _slot_count wheel slots, then the due and overflow lists
+    std::uint64_t _occupied[Levels];
+    vector<std::pair<Node *, size_type>> _blocks; // node pool; nodes are recycled, never returned until destruction
+    Node *_free;
+    node_allocator _node_alloc;
+    tick_type _now;
+    size_type _size;
+    std::uint64_t _next_id;
+
+    static void _link_back(_timer_link &list, _timer_link *n) noexcept {
+        n->_prev = list._prev;
+        n->_next = &list;
+        list._prev->_next = n;
+        list._prev = n;
+    }
+    static void _unlink(_timer_link *n) noexcept {
+        n->_prev->_next = n->_next;
+        n->_next->_prev = n->_prev;
+    }
+    // moves every node of list into the empty list out and marks them detached
+    static void _take(_timer_link &list, _timer_link &out) noexcept;
+
+    Node *_acquire();
+    void _release(Node *n) noexcept;
+    void _place(Node *n) noexcept;
+    void _remove(Node *n) noexcept;
+    tick_type _next_event() const noexcept;
+    void _cascade() noexcept;
+    template <class Callback> size_type _fire(_timer_link &list, Callback &callback);
+    void _destroy_all() noexcept;
+
+  public:
+    // cancellation handle returned by insert; stays safe to use after the timer fired or was cancelled
+    class handle {
+        friend class timer_wheel;
+        Node *_node = nullptr;
+        std::uint64_t _id = 0;
+
+        handle(Node *node, std::uint64_t id) noexcept : _node(node), _id(id) {}
+
+      public:
+        handle() noexcept = default;
+    };
+
+    timer_wheel() : timer_wheel(0) {}
+    explicit timer_wheel(tick_type now, const Allocator &alloc = Allocator());
+    timer_wheel(const timer_wheel &) = delete;
+    timer_wheel &operator=(const timer_wheel &) = delete;
+    ~timer_wheel();
+
+    [[nodiscard]] bool empty() const noexcept {
+        return _size == 0;
+    }
+    [[nodiscard]] size_type size() const noexcept {
+        return _size;
+    }
+    tick_type now() const noexcept {
+        return _now;
+    }
+
+    // schedules value to expire at deadline; a deadline not after now() expires on the next advance()
+    template <class... Args> handle emplace(tick_type deadline, Args &&...args);
+    handle insert(tick_type deadline, const T &value) {
+        return emplace(deadline, value);
+    }
+    handle insert(tick_type deadline, T &&value) {
+        return emplace(deadline, std::move(value));
+    }
+
+    [[nodiscard]] bool pending(const handle &h) const noexcept {
+        return h._node != nullptr && h._node->_id == h._id;
+    }
+    // removes the timer if it has neither fired nor been cancelled; returns whether it did
+    bool cancel(const handle &h) noexcept;
+    void clear() noexcept;
+
+    // moves the wheel to now and calls callback(T &) for every timer with deadline <= now, slot by slot in
+    // deadline order; returns the number of expired timers. Timers scheduled by callback at or before the
+    // current tick expire on the next call.
+    template <class Callback> size_type advance(tick_type now, Callback callback);
+};
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+timer_wheel<T, SlotBits, Levels, Allocator>::timer_wheel(tick_type now, const Allocator &alloc)
+    : _slots(_detached), _occupied{}, _blocks(), _free(nullptr), _node_alloc(alloc), _now(now), _size(0),
+      _next_id(1) {
+    for (size_type i = 0; i < _slots.size(); ++i) {
+        _slots[i]._prev = &_slots[i];
+        _slots[i]._next = &_slots[i];
+    }
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+timer_wheel<T, SlotBits, Levels, Allocator>::~timer_wheel() {
+    _destroy_all();
+    for (auto &[block, count] : _blocks) {
+        std::allocator_traits<node_allocator>::deallocate(_node_alloc, block, count);
+    }
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_take(_timer_link &list, _timer_link &out) noexcept {
+    out._prev = &out;
+    out._next = &out;
+    if (list._next == &list)
+        return;
+    for (_timer_link *p = list._next; p != &list; p = p->_next) {
+        static_cast<Node *>(p)->_slot = _detached;
+    }
+    out._next = list._next;
+    out._prev = list._prev;
+    out._next->_prev = &out;
+    out._prev->_next = &out;
+    list._prev = &list;
+    list._next = &list;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+typename timer_wheel<T, SlotBits, Levels, Allocator>::Node *timer_wheel<T, SlotBits, Levels, Allocator>::_acquire() {
+    if (_free == nullptr) {
+        size_type count = 64;
+        for (const auto &block : _blocks) {
+            count += block.second;
+        }
+        Node *block = std::allocator_traits<node_allocator>::allocate(_node_alloc, count);
+        try {
+            _blocks.emplace_back(block, count);
+        } catch (...) {
+            std::allocator_traits<node_allocator>::deallocate(_node_alloc, block, count);
+            throw;
+        }
+        for (size_type i = 0; i < count; ++i) {
+            Node *n = ::new (static_cast<void *>(block + i)) Node;
+            n->_id = 0;
+            n->_next = _free;
+            _free = n;
+        }
+    }
+    Node *n = _free;
+    _free = static_cast<Node *>(n->_next);
+    return n;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_release(Node *n) noexcept {
+    n->_id = 0;
+    std::destroy_at(&n->value());
+    n->_next = _free;
+    _free = n;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_place(Node *n) noexcept {
+    if (n->_deadline <= _now) {
+        n->_slot = _due_slot;
+    } else if (const tick_type diff = n->_deadline ^ _now; (diff >> _total_bits) != 0) {
+        n->_slot = _overflow_slot;
+    } else {
+        // lowest level whose higher digits match the current tick; the slot digit is then ahead of the wheel
+        const size_type level = static_cast<size_type>(std::bit_width(diff) - 1) / SlotBits;
+        const size_type digit = static_cast<size_type>(n->_deadline >> (level * SlotBits)) & _slot_mask;
+        n->_slot = level * _slot_count + digit;
+        _occupied[level] |= std::uint64_t{1} << digit;
+    }
+    _link_back(_slots[n->_slot], n);
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_remove(Node *n) noexcept {
+    _unlink(n);
+    if (n->_slot < _due_slot && _slots[n->_slot]._next == &_slots[n->_slot]) {
+        _occupied[n->_slot / _slot_count] &= ~(std::uint64_t{1} << (n->_slot & _slot_mask));
+    }
+}
+
+// earliest tick after _now at which a level-0 slot expires, a higher slot cascades or the overflow list is
+// redistributed; max() if the wheel holds nothing
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+typename timer_wheel<T, SlotBits, Levels, Allocator>::tick_type
+timer_wheel<T, SlotBits, Levels, Allocator>::_next_event() const noexcept {
+    for (size_type level = 0; level < Levels; ++level) {
+        const size_type shift = level * SlotBits;
+        const size_type digit = static_cast<size_type>(_now >> shift) & _slot_mask;
+        const std::uint64_t ahead = _occupied[level] & ~((std::uint64_t{2} << digit) - 1);
+        if (ahead != 0) {
+            const tick_type base = (_now >> (shift + SlotBits)) << (shift + SlotBits);
+            return base | (static_cast<tick_type>(std::countr_zero(ahead)) << shift);
+        }
+    }
+    if (_slots[_overflow_slot]._next != &_slots[_overflow_slot])
+        return ((_now >> _total_bits) + 1) << _total_bits;
+    return std::numeric_limits<tick_type>::max();
+}
+
+// called when _now enters a new slot: pulls the matching higher-level slots (and, once per turn, the overflow
+// list) down to the levels they now belong to. Timers due exactly now join the level-0 slot about to fire.
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_cascade() noexcept {
+    _timer_link batch;
+    auto redistribute = [&] {
+        while (batch._next != &batch) {
+            Node *n = static_cast<Node *>(batch._next);
+            _unlink(n);
+            if (n->_deadline == _now) {
+                n->_slot = static_cast<size_type>(_now) & _slot_mask;
+                _link_back(_slots[n->_slot], n);
+            } else {
+                _place(n);
+            }
+        }
+    };
+    for (size_type level = 1; level < Levels; ++level) {
+        const size_type shift = level * SlotBits;
+        if ((_now & ((tick_type{1} << shift) - 1)) != 0)
+            return;
+        const size_type digit = static_cast<size_type>(_now >> shift) & _slot_mask;
+        _take(_slots[level * _slot_count + digit], batch);
+        _occupied[level] &= ~(std::uint64_t{1} << digit);
+        redistribute();
+    }
+    if ((_now & ((tick_type{1} << _total_bits) - 1)) == 0) {
+        _take(_slots[_overflow_slot], batch);
+        redistribute();
+    }
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+template <class Callback>
+typename timer_wheel<T, SlotBits, Levels, Allocator>::size_type
+timer_wheel<T, SlotBits, Levels, Allocator>::_fire(_timer_link &list, Callback &callback) {
+    _timer_link batch;
+    _take(list, batch);
+    size_type fired = 0;
+    // the callback may cancel timers of the same batch, so nodes are unlinked one at a time
+    while (batch._next != &batch) {
+        Node *n = static_cast<Node *>(batch._next);
+        _unlink(n);
+        n->_id = 0;
+        --_size;
+        try {
+            std::invoke(callback, n->value());
+        } catch (...) {
+            _release(n);
+            while (batch._next != &batch) { // the rest of the batch stays due
+                Node *rest = static_cast<Node *>(batch._next);
+                _unlink(rest);
+                rest->_slot = _due_slot;
+                _link_back(_slots[_due_slot], rest);
+            }
+            throw;
+        }
+        _release(n);
+        ++fired;
+    }
+    return fired;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::_destroy_all() noexcept {
+    for (auto &list : _slots) {
+        while (list._next != &list) {
+            Node *n = static_cast<Node *>(list._next);
+            _unlink(n);
+            _release(n);
+        }
+    }
+    for (auto &mask : _occupied) {
+        mask = 0;
+    }
+    _size = 0;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+template <class... Args>
+typename timer_wheel<T, SlotBits, Levels, Allocator>::handle
+timer_wheel<T, SlotBits, Levels, Allocator>::emplace(tick_type deadline, Args &&...args) {
+    Node *n = _acquire();
+    try {
+        ::new (static_cast<void *>(n->_storage)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        n->_next = _free;
+        _free = n;
+        throw;
+    }
+    n->_deadline = deadline;
+    n->_id = _next_id++;
+    _place(n);
+    ++_size;
+    return handle(n, n->_id);
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+bool timer_wheel<T, SlotBits, Levels, Allocator>::cancel(const handle &h) noexcept {
+    if (!pending(h))
+        return false;
+    _remove(h._node);
+    _release(h._node);
+    --_size;
+    return true;
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+void timer_wheel<T, SlotBits, Levels, Allocator>::clear() noexcept {
+    _destroy_all();
+}
+
+template <class T, std::size_t SlotBits, std::size_t Levels, class Allocator>
+template <class Callback>
+typename timer_wheel<T, SlotBits, Levels, Allocator>::size_type
+timer_wheel<T, SlotBits, Levels, Allocator>::advance(tick_type now, Callback callback) {
+    size_type fired = _fire(_slots[_due_slot], callback);
+    while (_now < now) {
+        const tick_type event = _next_event();
+        if (event > now) {
+            _now = now;
+            break;
+        }
+        _now = event;
+        _cascade();
+        const size_type digit = static_cast<size_type>(_now) & _slot_mask;
+        _occupied[0] &= ~(std::uint64_t{1} << digit);
+        fired += _fire(_slots[digit], callback);
+    }
+    return fired;
+}
+} // namespace j
@@ -0,0 +1,1045 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+export module j:unrolled_list;
+
+import :vector;
+
+namespace j {
+// Unrolled doubly linked list: every node stores up to node_capacity elements in an inline array, so a traversal
+// touches one node per several elements instead of one per element. Inserting into a full node splits it in half;
+// a node that falls below a quarter full after an erase is merged with its neighbour or refilled from it.
+// Elements move within and between nodes, so unlike list, insert, emplace, erase, splice and the list operations
+// invalidate iterators and references. push_back, emplace_back and pop_back keep references to the other elements
+// valid. Elements moved between nodes are copied instead when their move constructor may throw; if a copy or move
+// still throws, the list stays consistent and leaks nothing, though elements being shifted may be left moved-from.
+export template <class T, std::size_t NodeBytes = 256, class Allocator = std::allocator<T>> class unrolled_list {
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using pointer = typename std::allocator_traits<Allocator>::pointer;
+    using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  private:
+    struct _node_link {
+        _node_link *_prev;
+        _node_link *_next;
+        size_type _count; // always 0 for the sentinel
+    };
+    using Link = _node_link;
+
+  public:
+    // elements per node: as many as fit into NodeBytes next to the links, but at least four
+    static constexpr size_type node_capacity =
+        NodeBytes >= sizeof(Link) + 4 * sizeof(T) ? (NodeBytes - sizeof(Link)) / sizeof(T) : 4;
+
+  private:
+    struct _unrolled_node : _node_link {
+        alignas(T) unsigned char _storage[sizeof(T) * node_capacity];
+
+        T *slot(size_type i) noexcept {
+            return std::launder(reinterpret_cast<T *>(_storage)) + i;
+        }
+    };
+    using Node = _unrolled_node;
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+    static constexpr size_type _min_fill = node_capacity / 4;
+
+    Link _sentinel;
+    node_allocator _node_alloc;
+    size_type _size;
+
+    static Node *_as_node(Link *link) noexcept {
+        return static_cast<Node *>(link);
+    }
+    static void _link_before(Link *position, Link *link) noexcept {
+        link->_prev = position->_prev;
+        link->_next = position;
+        position->_prev->_next = link;
+        position->_prev = link;
+    }
+    static void _unlink(Link *link) noexcept {
+        link->_prev->_next = link->_next;
+        link->_next->_prev = link->_prev;
+    }
+    // constructs n elements at the raw slots dst from src, moving them if that cannot throw and copying otherwise.
+    // If a construction throws, the ones built so far are destroyed again and every source is still in place.
+    static void _uninitialized_move(T *src, size_type n, T *dst) {
+        size_type built = 0;
+        try {
+            for (; built < n; ++built) {
+                std::construct_at(dst + built, std::move_if_noexcept(src[built]));
+            }
+        } catch (...) {
+            std::destroy(dst, dst + built);
+            throw;
+        }
+    }
+    // _uninitialized_move, then destroys the sources; src and dst must not overlap
+    static void _relocate(T *src, size_type n, T *dst) {
+        _uninitialized_move(src, n, dst);
+        std::destroy(src, src + n);
+    }
+
+    void _reset() noexcept {
+        _sentinel._prev = &_sentinel;
+        _sentinel._next = &_sentinel;
+        _sentinel._count = 0;
+        _size = 0;
+    }
+    // takes over x's nodes; *this must be empty
+    void _adopt(unrolled_list &x) noexcept;
+    Node *_allocate_node();
+    void _free_node(Link *link) noexcept;
+    void _destroy_node(Link *link) noexcept;
+    template <class... Args> void _construct_in_node(Node *node, size_type index, Args &&...args);
+    // splits the node at index so that a node starts with the element at (link, index); returns that node
+    Link *_split_at(Link *link, size_type index);
+    // restores the fill of a node that lost elements; (node, index) is the position after the erased ones
+    iterator _rebalance(Node *node, size_type index);
+
+  public:
+    // constructor and destructor
+    unrolled_list() : unrolled_list(Allocator()) {}
+    explicit unrolled_list(const Allocator &alloc) noexcept : _node_alloc(alloc) {
+        _reset();
+    }
+    explicit unrolled_list(size_type n, const Allocator &alloc = Allocator());
+    unrolled_list(size_type n, const T &value, const Allocator &alloc = Allocator());
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    unrolled_list(InputIter first, InputIter last, const Allocator &alloc = Allocator());
+    unrolled_list(std::initializer_list<T> il, const Allocator &alloc = Allocator());
+    unrolled_list(const unrolled_list &x);
+    unrolled_list(unrolled_list &&x) noexcept;
+    ~unrolled_list();
+
+    // assignment
+    unrolled_list &operator=(const unrolled_list &x);
+    unrolled_list &operator=(unrolled_list &&x) noexcept;
+    unrolled_list &operator=(std::initializer_list<T> il);
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(size_type n, const T &t);
+    void assign(std::initializer_list<T> il);
+    allocator_type get_allocator() const noexcept {
+        return allocator_type(_node_alloc);
+    }
+
+    // iterators
+    iterator begin() noexcept {
+        return iterator(_sentinel._next, 0);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(_sentinel._next, 0);
+    }
+    iterator end() noexcept {
+        return iterator(&_sentinel, 0);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(const_cast<Link *>(&_sentinel), 0);
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+
+    // capacity
+    [[nodiscard]] bool empty() const noexcept {
+        return _size == 0;
+    }
+    size_type size() const noexcept {
+        return _size;
+    }
+    size_type max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() / sizeof(T);
+    }
+    void resize(size_type sz);
+    void resize(size_type sz, const T &c);
+
+    // element access
+    reference front() {
+        return *_as_node(_sentinel._next)->slot(0);
+    }
+    const_reference front() const {
+        return *_as_node(_sentinel._next)->slot(0);
+    }
+    reference back() {
+        return *_as_node(_sentinel._prev)->slot(_sentinel._prev->_count - 1);
+    }
+    const_reference back() const {
+        return *_as_node(_sentinel._prev)->slot(_sentinel._prev->_count - 1);
+    }
+
+    // modifiers
+    template <class... Args> reference emplace_front(Args &&...args);
+    template <class... Args> reference emplace_back(Args &&...args);
+    void push_front(const T &x) {
+        emplace_front(x);
+    }
+    void push_front(T &&x) {
+        emplace_front(std::move(x));
+    }
+    void pop_front() {
+        erase(begin());
+    }
+    void push_back(const T &x) {
+        emplace_back(x);
+    }
+    void push_back(T &&x) {
+        emplace_back(std::move(x));
+    }
+    void pop_back() noexcept;
+
+    template <class... Args> iterator emplace(const_iterator position, Args &&...args);
+    iterator insert(const_iterator position, const T &x) {
+        return emplace(position, x);
+    }
+    iterator insert(const_iterator position, T &&x) {
+        return emplace(position, std::move(x));
+    }
+    iterator insert(const_iterator position, size_type n, const T &x);
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    iterator insert(const_iterator position, InputIter first, InputIter last);
+    iterator insert(const_iterator position, std::initializer_list<T> il) {
+        return insert(position, il.begin(), il.end());
+    }
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+    void swap(unrolled_list &x) noexcept;
+    void clear() noexcept;
+
+    // list operations
+    // splicing moves whole nodes; only the nodes at position, first and last are split
+    void splice(const_iterator position, unrolled_list &x);
+    void splice(const_iterator position, unrolled_list &&x) {
+        splice(position, static_cast<unrolled_list &>(x));
+    }
+    void splice(const_iterator position, unrolled_list &x, const_iterator i);
+    void splice(const_iterator position, unrolled_list &&x, const_iterator i) {
+        splice(position, static_cast<unrolled_list &>(x), i);
+    }
+    void splice(const_iterator position, unrolled_list &x, const_iterator first, const_iterator last);
+    void splice(const_iterator position, unrolled_list &&x, const_iterator first, const_iterator last) {
+        splice(position, static_cast<unrolled_list &>(x), first, last);
+    }
+
+    size_type remove(const T &value) {
+        return remove_if([&value](const T &v) { return v == value; });
+    }
+    template <class Predicate>
+        requires std::predicate<Predicate, T>
+    size_type remove_if(Predicate pred);
+
+    size_type unique() {
+        return unique(std::equal_to<T>());
+    }
+    template <class BinaryPredicate>
+        requires std::predicate<BinaryPredicate, T, T>
+    size_type unique(BinaryPredicate binary_pred);
+
+    void merge(unrolled_list &x) {
+        merge(x, std::less<T>());
+    }
+    void merge(unrolled_list &&x) {
+        merge(x, std::less<T>());
+    }
+    template <class Compare> void merge(unrolled_list &x, Compare comp);
+    template <class Compare> void merge(unrolled_list &&x, Compare comp) {
+        merge(static_cast<unrolled_list &>(x), comp);
+    }
+
+    void sort() {
+        sort(std::less<T>());
+    }
+    template <class Compare>
+        requires std::strict_weak_order<Compare, T, T>
+    void sort(Compare comp);
+
+    void reverse() noexcept(std::is_nothrow_swappable_v<T>) {
+        std::reverse(begin(), end());
+    }
+};
+
+template <class InputIter, class Allocator = std::allocator<typename std::iterator_traits<InputIter>::value_type>>
+    requires std::input_iterator<InputIter>
+unrolled_list(InputIter, InputIter, Allocator = Allocator())
+    -> unrolled_list<typename std::iterator_traits<InputIter>::value_type, 256, Allocator>;
+
+export template <class T, std::size_t NodeBytes, class Allocator>
+bool operator==(const unrolled_list<T, NodeBytes, Allocator> &lhs, const unrolled_list<T, NodeBytes, Allocator> &rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+export template <class T, std::size_t NodeBytes, class Allocator>
+auto operator<=>(const unrolled_list<T, NodeBytes, Allocator> &lhs, const unrolled_list<T, NodeBytes, Allocator> &rhs) {
+    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                  std::compare_three_way{});
+}
+
+export template <class T, std::size_t NodeBytes, class Allocator>
+void swap(unrolled_list<T, NodeBytes, Allocator> &x, unrolled_list<T, NodeBytes, Allocator> &y) noexcept {
+    x.swap(y);
+}
+
+export template <class T, std::size_t NodeBytes, class Allocator, class U>
+typename unrolled_list<T, NodeBytes, Allocator>::size_type erase(unrolled_list<T, NodeBytes, Allocator> &c,
+                                                                 const U &value) {
+    return c.remove_if([&value](const T &v) { return v == value; });
+}
+
+export template <class T, std::size_t NodeBytes, class Allocator, class Predicate>
+typename unrolled_list<T, NodeBytes, Allocator>::size_type erase_if(unrolled_list<T, NodeBytes, Allocator> &c,
+                                                                    Predicate pred) {
+    return c.remove_if(pred);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator> class unrolled_list<T, NodeBytes, Allocator>::iterator {
+    friend unrolled_list;
+
+  public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+
+  private:
+    Link *_node;
+    size_type _index;
+
+  public:
+    iterator() noexcept : _node(nullptr), _index(0) {}
+    iterator(Link *node, size_type index) noexcept : _node(node), _index(index) {}
+
+    reference operator*() const noexcept {
+        return *_as_node(_node)->slot(_index);
+    }
+    pointer operator->() const noexcept {
+        return _as_node(_node)->slot(_index);
+    }
+
+    iterator &operator++() noexcept {
+        if (++_index == _node->_count) {
+            _node = _node->_next;
+            _index = 0;
+        }
+        return *this;
+    }
+    iterator operator++(int) noexcept {
+        iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    iterator &operator--() noexcept {
+        if (_index == 0) {
+            _node = _node->_prev;
+            _index = _node->_count;
+        }
+        --_index;
+        return *this;
+    }
+    iterator operator--(int) noexcept {
+        iterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+        return _node == other._node && _index == other._index;
+    }
+    operator const_iterator() const noexcept {
+        return const_iterator(_node, _index);
+    }
+};
+
+template <class T, std::size_t NodeBytes, class Allocator>
+class unrolled_list<T, NodeBytes, Allocator>::const_iterator {
+    friend unrolled_list;
+
+  public:
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+  private:
+    Link *_node;
+    size_type _index;
+
+  public:
+    const_iterator() noexcept : _node(nullptr), _index(0) {}
+    const_iterator(Link *node, size_type index) noexcept : _node(node), _index(index) {}
+
+    reference operator*() const noexcept {
+        return *_as_node(_node)->slot(_index);
+    }
+    pointer operator->() const noexcept {
+        return _as_node(_node)->slot(_index);
+    }
+
+    const_iterator &operator++() noexcept {
+        if (++_index == _node->_count) {
+            _node = _node->_next;
+            _index = 0;
+        }
+        return *this;
+    }
+    const_iterator operator++(int) noexcept {
+        const_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+    const_iterator &operator--() noexcept {
+        if (_index == 0) {
+            _node = _node->_prev;
+            _index = _node->_count;
+        }
+        --_index;
+        return *this;
+    }
+    const_iterator operator--(int) noexcept {
+        const_iterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept {
+        return _node == other._node && _index == other._index;
+    }
+};
+} // namespace j
+
+namespace j {
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::_adopt(unrolled_list &x) noexcept {
+    if (x.empty())
+        return;
+    _sentinel._next = x._sentinel._next;
+    _sentinel._prev = x._sentinel._prev;
+    _sentinel._next->_prev = &_sentinel;
+    _sentinel._prev->_next = &_sentinel;
+    _size = x._size;
+    x._reset();
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::Node *unrolled_list<T, NodeBytes, Allocator>::_allocate_node() {
+    Node *node = std::allocator_traits<node_allocator>::allocate(_node_alloc, 1);
+    ::new (static_cast<void *>(node)) Node; // default-initialized: the element storage stays untouched
+    node->_count = 0;
+    return node;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::_free_node(Link *link) noexcept {
+    std::allocator_traits<node_allocator>::deallocate(_node_alloc, _as_node(link), 1);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::_destroy_node(Link *link) noexcept {
+    Node *node = _as_node(link);
+    std::destroy(node->slot(0), node->slot(node->_count));
+    _size -= node->_count;
+    _unlink(node);
+    _free_node(node);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class... Args>
+void unrolled_list<T, NodeBytes, Allocator>::_construct_in_node(Node *node, size_type index, Args &&...args) {
+    if (index == node->_count) {
+        std::construct_at(node->slot(index), std::forward<Args>(args)...);
+    } else {
+        // build the value first: args may refer to an element that is about to be shifted
+        T value(std::forward<Args>(args)...);
+        T *last = node->slot(node->_count - 1);
+        std::construct_at(last + 1, std::move(*last));
+        // counted at once: if a move assignment below throws, the node still owns every constructed slot
+        ++node->_count;
+        ++_size;
+        std::move_backward(node->slot(index), last, last + 1);
+        *node->slot(index) = std::move(value);
+        return;
+    }
+    ++node->_count;
+    ++_size;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::Link *
+unrolled_list<T, NodeBytes, Allocator>::_split_at(Link *link, size_type index) {
+    if (index == 0)
+        return link;
+    Node *node = _as_node(link);
+    Node *tail = _allocate_node();
+    try {
+        _relocate(node->slot(index), node->_count - index, tail->slot(0));
+    } catch (...) {
+        _free_node(tail);
+        throw;
+    }
+    tail->_count = node->_count - index;
+    node->_count = index;
+    _link_before(node->_next, tail);
+    return tail;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::_rebalance(Node *node, size_type index) {
+    if (node->_count == 0) {
+        Link *next = node->_next;
+        _unlink(node);
+        _free_node(node);
+        return iterator(next, 0);
+    }
+    if (node->_count < _min_fill) {
+        if (node->_next != &_sentinel) {
+            Node *next = _as_node(node->_next);
+            if (node->_count + next->_count <= node_capacity) {
+                _relocate(next->slot(0), next->_count, node->slot(node->_count));
+                node->_count += next->_count;
+                _unlink(next);
+                _free_node(next);
+            } else {
+                // take half of the difference from the front of the next node
+                const size_type moved = (next->_count - node->_count) / 2;
+                _uninitialized_move(next->slot(0), moved, node->slot(node->_count));
+                try {
+                    std::move(next->slot(moved), next->slot(next->_count), next->slot(0));
+                } catch (...) {
+                    std::destroy(node->slot(node->_count), node->slot(node->_count + moved));
+                    throw;
+                }
+                std::destroy(next->slot(next->_count - moved), next->slot(next->_count));
+                node->_count += moved;
+                next->_count -= moved;
+            }
+        } else if (node->_prev != &_sentinel && node->_prev->_count + node->_count <= node_capacity) {
+            Node *prev = _as_node(node->_prev);
+            _relocate(node->slot(0), node->_count, prev->slot(prev->_count));
+            index += prev->_count;
+            prev->_count += node->_count;
+            _unlink(node);
+            _free_node(node);
+            node = prev;
+        }
+    }
+    if (index == node->_count)
+        return iterator(node->_next, 0);
+    return iterator(node, index);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(size_type n, const Allocator &alloc) : unrolled_list(alloc) {
+    for (size_type i = 0; i < n; ++i) {
+        emplace_back();
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(size_type n, const T &value, const Allocator &alloc)
+    : unrolled_list(alloc) {
+    for (size_type i = 0; i < n; ++i) {
+        emplace_back(value);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(InputIter first, InputIter last, const Allocator &alloc)
+    : unrolled_list(alloc) {
+    try {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(std::initializer_list<T> il, const Allocator &alloc)
+    : unrolled_list(il.begin(), il.end(), alloc) {}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(const unrolled_list &x)
+    : unrolled_list(x.begin(), x.end(),
+                    std::allocator_traits<Allocator>::select_on_container_copy_construction(x.get_allocator())) {}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator>::unrolled_list(unrolled_list &&x) noexcept : _node_alloc(x._node_alloc) {
+    _reset();
+    _adopt(x);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator> unrolled_list<T, NodeBytes, Allocator>::~unrolled_list() {
+    clear();
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator> &unrolled_list<T, NodeBytes, Allocator>::operator=(const unrolled_list &x) {
+    if (this != std::addressof(x))
+        assign(x.begin(), x.end());
+    return *this;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator> &unrolled_list<T, NodeBytes, Allocator>::operator=(unrolled_list &&x) noexcept {
+    if (this != std::addressof(x)) {
+        clear();
+        _node_alloc = x._node_alloc;
+        _adopt(x);
+    }
+    return *this;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+unrolled_list<T, NodeBytes, Allocator> &unrolled_list<T, NodeBytes, Allocator>::operator=(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+    return *this;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void unrolled_list<T, NodeBytes, Allocator>::assign(InputIter first, InputIter last) {
+    // reuse the existing elements, then append or trim
+    iterator out = begin();
+    for (; out != end() && first != last; ++out, ++first) {
+        *out = *first;
+    }
+    if (out != end())
+        erase(out, end());
+    for (; first != last; ++first) {
+        emplace_back(*first);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::assign(size_type n, const T &t) {
+    clear();
+    for (size_type i = 0; i < n; ++i) {
+        emplace_back(t);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::resize(size_type sz) {
+    while (_size > sz) {
+        pop_back();
+    }
+    while (_size < sz) {
+        emplace_back();
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::resize(size_type sz, const T &c) {
+    while (_size > sz) {
+        pop_back();
+    }
+    while (_size < sz) {
+        emplace_back(c);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class... Args>
+typename unrolled_list<T, NodeBytes, Allocator>::reference
+unrolled_list<T, NodeBytes, Allocator>::emplace_front(Args &&...args) {
+    Link *first = _sentinel._next;
+    if (first == &_sentinel || first->_count == node_capacity) {
+        // start a fresh node; the following calls shift within it until it is full
+        Node *node = _allocate_node();
+        try {
+            _construct_in_node(node, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            _free_node(node);
+            throw;
+        }
+        _link_before(first, node);
+        return *node->slot(0);
+    }
+    _construct_in_node(_as_node(first), 0, std::forward<Args>(args)...);
+    return *_as_node(first)->slot(0);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class... Args>
+typename unrolled_list<T, NodeBytes, Allocator>::reference
+unrolled_list<T, NodeBytes, Allocator>::emplace_back(Args &&...args) {
+    Link *last = _sentinel._prev;
+    if (last == &_sentinel || last->_count == node_capacity) {
+        Node *node = _allocate_node();
+        try {
+            _construct_in_node(node, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            _free_node(node);
+            throw;
+        }
+        _link_before(&_sentinel, node);
+        return *node->slot(0);
+    }
+    Node *node = _as_node(last);
+    _construct_in_node(node, node->_count, std::forward<Args>(args)...);
+    return *node->slot(node->_count - 1);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::pop_back() noexcept {
+    Node *last = _as_node(_sentinel._prev);
+    std::destroy_at(last->slot(--last->_count));
+    --_size;
+    if (last->_count == 0) {
+        _unlink(last);
+        _free_node(last);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class... Args>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::emplace(const_iterator position, Args &&...args) {
+    Link *link = position._node;
+    size_type index = position._index;
+    if (index == 0 && link->_prev != &_sentinel && link->_prev->_count < node_capacity) {
+        // position starts a node: appending to the previous one needs no shifting
+        link = link->_prev;
+        index = link->_count;
+    } else if (link == &_sentinel) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(_sentinel._prev, _sentinel._prev->_count - 1);
+    }
+    Node *node = _as_node(link);
+    if (node->_count == node_capacity) {
+        // insert into a full node: split it in half and insert into the half that holds position.
+        // The value is built first since args may refer to an element the split relocates.
+        T value(std::forward<Args>(args)...);
+        constexpr size_type half = node_capacity / 2;
+        Node *tail = _as_node(_split_at(node, half));
+        if (index > half) {
+            node = tail;
+            index -= half;
+        }
+        _construct_in_node(node, index, std::move(value));
+        return iterator(node, index);
+    }
+    _construct_in_node(node, index, std::forward<Args>(args)...);
+    return iterator(node, index);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::insert(const_iterator position, size_type n, const T &x) {
+    if (n == 0)
+        return iterator(position._node, position._index);
+    iterator first = emplace(position, x);
+    iterator it = first;
+    for (size_type i = 1; i < n; ++i) {
+        it = emplace(std::next(it), x);
+    }
+    return std::prev(it, static_cast<difference_type>(n - 1));
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::insert(const_iterator position, InputIter first, InputIter last) {
+    if (first == last)
+        return iterator(position._node, position._index);
+    iterator it = emplace(position, *first);
+    size_type inserted = 1;
+    for (++first; first != last; ++first, ++inserted) {
+        it = emplace(std::next(it), *first);
+    }
+    return std::prev(it, static_cast<difference_type>(inserted - 1));
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::erase(const_iterator position) {
+    Node *node = _as_node(position._node);
+    const size_type index = position._index;
+    std::move(node->slot(index + 1), node->slot(node->_count), node->slot(index));
+    std::destroy_at(node->slot(--node->_count));
+    --_size;
+    return _rebalance(node, index);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+typename unrolled_list<T, NodeBytes, Allocator>::iterator
+unrolled_list<T, NodeBytes, Allocator>::erase(const_iterator first, const_iterator last) {
+    if (first == last)
+        return iterator(last._node, last._index);
+    Node *node = _as_node(first._node);
+    if (first._node == last._node) {
+        const size_type erased = last._index - first._index;
+        std::move(node->slot(last._index), node->slot(node->_count), node->slot(first._index));
+        std::destroy(node->slot(node->_count - erased), node->slot(node->_count));
+        node->_count -= erased;
+        _size -= erased;
+        return _rebalance(node, first._index);
+    }
+    // the head of the last node first, as the only step that moves elements and so may throw; then the tail of
+    // the first node and every node in between
+    if (last._index != 0) {
+        Node *tail = _as_node(last._node);
+        std::move(tail->slot(last._index), tail->slot(tail->_count), tail->slot(0));
+        std::destroy(tail->slot(tail->_count - last._index), tail->slot(tail->_count));
+        tail->_count -= last._index;
+        _size -= last._index;
+    }
+    std::destroy(node->slot(first._index), node->slot(node->_count));
+    _size -= node->_count - first._index;
+    node->_count = first._index;
+    while (node->_next != last._node) {
+        _destroy_node(node->_next);
+    }
+    return _rebalance(node, node->_count);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::swap(unrolled_list &x) noexcept {
+    unrolled_list temp(std::move(x));
+    x._adopt(*this);
+    _adopt(temp);
+    std::swap(_node_alloc, x._node_alloc);
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::clear() noexcept {
+    while (_sentinel._next != &_sentinel) {
+        _destroy_node(_sentinel._next);
+    }
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::splice(const_iterator position, unrolled_list &x) {
+    if (this == std::addressof(x) || x.empty())
+        return;
+    Link *at = _split_at(position._node, position._index);
+    Link *first = x._sentinel._next;
+    Link *last = x._sentinel._prev;
+    first->_prev = at->_prev;
+    at->_prev->_next = first;
+    last->_next = at;
+    at->_prev = last;
+    _size += x._size;
+    x._reset();
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::splice(const_iterator position, unrolled_list &x, const_iterator i) {
+    if (this != std::addressof(x)) {
+        emplace(position, std::move(const_cast<T &>(*i)));
+        x.erase(i);
+        return;
+    }
+    // within the list the element is rotated into place
+    iterator pos(position._node, position._index);
+    iterator it(i._node, i._index);
+    if (pos == it || pos == std::next(it))
+        return;
+    iterator probe = std::next(it);
+    while (probe != pos && probe != end()) {
+        ++probe;
+    }
+    if (probe == pos)
+        std::rotate(it, std::next(it), pos);
+    else
+        std::rotate(pos, it, std::next(it));
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+void unrolled_list<T, NodeBytes, Allocator>::splice(const_iterator position, unrolled_list &x, const_iterator first,
+                                                    const_iterator last) {
+    if (first == last)
+        return;
+    if (this == std::addressof(x)) {
+        // position lies outside [first, last); the range is rotated into place
+        iterator pos(position._node, position._index);
+        iterator begin_it(first._node, first._index);
+        iterator end_it(last._node, last._index);
+        if (pos == end_it)
+            return;
+        iterator probe = end_it;
+        while (probe != pos && probe != end()) {
+            ++probe;
+        }
+        if (probe == pos)
+            std::rotate(begin_it, end_it, pos);
+        else
+            std::rotate(pos, begin_it, end_it);
+        return;
+    }
+    // split at last before first: splitting first's node leaves the elements before last where they are
+    Link *stop = x._split_at(last._node, last._index);
+    Link *start = x._split_at(first._node, first._index);
+    Link *at = _split_at(position._node, position._index);
+    size_type moved = 0;
+    Link *back = start;
+    for (;; back = back->_next) {
+        moved += back->_count;
+        if (back->_next == stop)
+            break;
+    }
+    start->_prev->_next = stop;
+    stop->_prev = start->_prev;
+    x._size -= moved;
+
+    start->_prev = at->_prev;
+    at->_prev->_next = start;
+    back->_next = at;
+    at->_prev = back;
+    _size += moved;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class Predicate>
+    requires std::predicate<Predicate, T>
+typename unrolled_list<T, NodeBytes, Allocator>::size_type
+unrolled_list<T, NodeBytes, Allocator>::remove_if(Predicate pred) {
+    // compact the kept elements to the front and trim the tail, which keeps the nodes full
+    iterator out = std::remove_if(begin(), end(), pred);
+    const size_type original_size = _size;
+    erase(out, end());
+    return original_size - _size;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class BinaryPredicate>
+    requires std::predicate<BinaryPredicate, T, T>
+typename unrolled_list<T, NodeBytes, Allocator>::size_type
+unrolled_list<T, NodeBytes, Allocator>::unique(BinaryPredicate binary_pred) {
+    iterator out = std::unique(begin(), end(), binary_pred);
+    const size_type original_size = _size;
+    erase(out, end());
+    return original_size - _size;
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class Compare>
+void unrolled_list<T, NodeBytes, Allocator>::merge(unrolled_list &x, Compare comp) {
+    if (this == std::addressof(x) || x.empty())
+        return;
+    // elements are moved into a fresh chain of full nodes; if comp throws, the rest is appended unmerged
+    unrolled_list merged(get_allocator());
+    iterator a = begin();
+    iterator b = x.begin();
+    auto finish = [&] {
+        for (; a != end(); ++a) {
+            merged.emplace_back(std::move(*a));
+        }
+        for (; b != x.end(); ++b) {
+            merged.emplace_back(std::move(*b));
+        }
+        x.clear();
+        clear();
+        _adopt(merged);
+    };
+    try {
+        while (a != end() && b != x.end()) {
+            if (comp(*b, *a)) {
+                merged.emplace_back(std::move(*b));
+                ++b;
+            } else {
+                merged.emplace_back(std::move(*a));
+                ++a;
+            }
+        }
+    } catch (...) {
+        finish();
+        throw;
+    }
+    finish();
+}
+
+template <class T, std::size_t NodeBytes, class Allocator>
+template <class Compare>
+    requires std::strict_weak_order<Compare, T, T>
+void unrolled_list<T, NodeBytes, Allocator>::sort(Compare comp) {
+    if (_size < 2)
+        return;
+    // the elements are already nearly contiguous; sort them in a flat buffer and move them back in place
+    vector<T> buffer;
+    buffer.reserve(_size);
+    for (T &v : *this) {
+        buffer.push_back(std::move(v));
+    }
+    auto move_back = [&] {
+        T *src = buffer.data();
+        for (T &v : *this) {
+            v = std::move(*src++);
+        }
+    };
+    try {
+        std::stable_sort(buffer.data(), buffer.data() + _size, comp);
+    } catch (...) {
+        move_back();
+        throw;
+    }
+    move_back();
+}
+} // namespace j
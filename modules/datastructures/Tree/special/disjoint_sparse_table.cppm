@@ -0,0 +1,202 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+export module j:disjoint_sparse_table;
+
+import :basics;
+import :vector;
+
+namespace j {
+// level h splits the elements into blocks of 2^h around a middle m: entry i < m holds the aggregate of [i, m),
+// entry i >= m the aggregate of [m, i]. the highest bit where the ends of [l, r] differ names the one level whose
+// middle lies between them, so a query joins exactly two disjoint entries and needs only an associative operator
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>> // operator (monoid)
+class disjoint_sparse_table {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    [[no_unique_address]] Operator _op;
+    vector<T, Allocator> _table; // level h at [h * _size, (h + 1) * _size), level 0 holds the elements
+    size_type _size;
+    size_type _levels;
+
+    void _build(); // suffix and prefix scans out of every middle on every level, O(n log n)
+
+  public:
+    disjoint_sparse_table() : disjoint_sparse_table(Allocator()) {}
+    explicit disjoint_sparse_table(const Allocator &alloc) : _table(alloc), _size(0), _levels(0) {}
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    disjoint_sparse_table(InputIter first, InputIter last, const Operator &op = Operator(),
+                          const Allocator &alloc = Allocator());
+    disjoint_sparse_table(std::initializer_list<T> il, const Operator &op = Operator(),
+                          const Allocator &alloc = Allocator());
+
+    disjoint_sparse_table(const disjoint_sparse_table &other) = default;
+    disjoint_sparse_table(disjoint_sparse_table &&other) noexcept;
+    ~disjoint_sparse_table() = default;
+    disjoint_sparse_table &operator=(const disjoint_sparse_table &other) = default;
+    disjoint_sparse_table &operator=(disjoint_sparse_table &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+
+    bool empty() const;
+    size_type size() const;
+    value_type query(size_type pos) const;
+    value_type query(size_type left, size_type right) const; // [left, right)
+    void swap(disjoint_sparse_table &other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_op, other._op);
+        _table.swap(other._table);
+        swap(_size, other._size);
+        swap(_levels, other._levels);
+    }
+    void clear() noexcept;
+};
+
+template <class InputIter, class Sentinel>
+disjoint_sparse_table(InputIter, Sentinel) -> disjoint_sparse_table<std::iter_value_t<InputIter>>;
+
+template <class T> disjoint_sparse_table(std::initializer_list<T>) -> disjoint_sparse_table<T>;
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+disjoint_sparse_table<T, Allocator, Operator>::disjoint_sparse_table(InputIter first, InputIter last,
+                                                                     const Operator &op, const Allocator &alloc)
+    : _op(op), _table(alloc), _size(0), _levels(0) {
+    assign(first, last);
+}
+
+template <class T, class Allocator, class Operator>
+disjoint_sparse_table<T, Allocator, Operator>::disjoint_sparse_table(std::initializer_list<T> il, const Operator &op,
+                                                                     const Allocator &alloc)
+    : disjoint_sparse_table(il.begin(), il.end(), op, alloc) {}
+
+template <class T, class Allocator, class Operator>
+disjoint_sparse_table<T, Allocator, Operator>::disjoint_sparse_table(disjoint_sparse_table &&other) noexcept
+    : _op(std::move(other._op)), _table(std::move(other._table)), _size(std::exchange(other._size, 0)),
+      _levels(std::exchange(other._levels, 0)) {}
+
+template <class T, class Allocator, class Operator>
+disjoint_sparse_table<T, Allocator, Operator> &
+disjoint_sparse_table<T, Allocator, Operator>::operator=(disjoint_sparse_table &&other) noexcept {
+    if (this != &other) {
+        _op = std::move(other._op);
+        _table = std::move(other._table);
+        _size = std::exchange(other._size, 0);
+        _levels = std::exchange(other._levels, 0);
+    }
+    return *this;
+}
+
+template <class T, class Allocator, class Operator>
+typename disjoint_sparse_table<T, Allocator, Operator>::allocator_type
+disjoint_sparse_table<T, Allocator, Operator>::get_allocator() const noexcept {
+    return _table.get_allocator();
+}
+
+template <class T, class Allocator, class Operator> void disjoint_sparse_table<T, Allocator, Operator>::_build() {
+    _levels = _size <= 1 ? _size : static_cast<size_type>(std::bit_width(_size - 1)) + 1;
+    _table.resize(_levels * _size, _op.identity());
+    const T *elements = _table.data();
+    for (size_type level = 1; level < _levels; ++level) {
+        T *row = _table.data() + level * _size;
+        const size_type half = size_type{1} << (level - 1);
+        for (size_type middle = half; middle < _size; middle += 2 * half) {
+            row[middle - 1] = elements[middle - 1];
+            for (size_type i = middle - 1; i > middle - half; --i) {
+                row[i - 1] = _op(elements[i - 1], row[i]);
+            }
+            row[middle] = elements[middle];
+            for (size_type i = middle + 1; i < std::min(middle + half, _size); ++i) {
+                row[i] = _op(row[i - 1], elements[i]);
+            }
+        }
+    }
+}
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void disjoint_sparse_table<T, Allocator, Operator>::assign(InputIter first, InputIter last) {
+    _table.clear();
+    if constexpr (std::forward_iterator<InputIter>) {
+        const auto size = static_cast<size_type>(std::distance(first, last));
+        _table.reserve(size * (static_cast<size_type>(std::bit_width(size)) + 1));
+    }
+    for (; first != last; ++first) {
+        _table.push_back(*first);
+    }
+    _size = _table.size();
+    _build();
+}
+
+template <class T, class Allocator, class Operator>
+void disjoint_sparse_table<T, Allocator, Operator>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
+
+template <class T, class Allocator, class Operator> bool disjoint_sparse_table<T, Allocator, Operator>::empty() const {
+    return _size == 0;
+}
+
+template <class T, class Allocator, class Operator>
+typename disjoint_sparse_table<T, Allocator, Operator>::size_type
+disjoint_sparse_table<T, Allocator, Operator>::size() const {
+    return _size;
+}
+
+template <class T, class Allocator, class Operator>
+typename disjoint_sparse_table<T, Allocator, Operator>::value_type
+disjoint_sparse_table<T, Allocator, Operator>::query(size_type pos) const {
+    return _table[pos];
+}
+
+template <class T, class Allocator, class Operator>
+typename disjoint_sparse_table<T, Allocator, Operator>::value_type
+disjoint_sparse_table<T, Allocator, Operator>::query(size_type left, size_type right) const {
+    if (left >= right) {
+        return _op.identity();
+    }
+    const size_type last = right - 1;
+    if (left == last) {
+        return _table[left];
+    }
+    const T *row = _table.data() + static_cast<size_type>(std::bit_width(left ^ last)) * _size;
+    return _op(row[left], row[last]);
+}
+
+template <class T, class Allocator, class Operator>
+void disjoint_sparse_table<T, Allocator, Operator>::clear() noexcept {
+    _table.clear();
+    _size = 0;
+    _levels = 0;
+}
+} // namespace j
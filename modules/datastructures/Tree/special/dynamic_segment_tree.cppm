@@ -0,0 +1,325 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+export module j:dynamic_segment_tree;
+
+import :basics;
+import :sort_algo;
+import :vector;
+
+namespace j {
+// Lazy segment tree over the keys [first, last] of a 64-bit domain that materializes only the nodes an update
+// touches: an absent child stands for a subtree of identities, so memory grows with the updates, O(log(last - first))
+// nodes each, rather than with the domain. Operator, Action and Mapping are the monoids of lazy_segment_tree.
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>,      // operator (monoid)
+                 class Action = plus<T>,        // range tag (monoid)
+                 class Mapping = add_to_sum<T>> // tag x value x length -> value
+class dynamic_segment_tree {
+  public:
+    using value_type = T;
+    using tag_type = std::remove_cvref_t<decltype(std::declval<const Action &>().identity())>;
+    using key_type = std::int64_t;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    struct _node {
+        T _value;
+        tag_type _lazy;
+        size_type _left = 0;  // 0 is absent: the root is never a child
+        size_type _right = 0;
+    };
+    using _node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_node>;
+
+    key_type _first; // domain [_first, _last]
+    key_type _last;
+    Operator _op;
+    [[no_unique_address]] Action _action;
+    [[no_unique_address]] Mapping _mapping;
+    vector<_node, _node_allocator> _nodes; // the pool, _nodes[0] is the root once the first update creates it
+
+    static size_type _length(key_type lo, key_type hi) {
+        return static_cast<size_type>(static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo)) + 1;
+    }
+    static key_type _mid(key_type lo, key_type hi) {
+        return lo + static_cast<key_type>((static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo)) / 2);
+    }
+    size_type _new_node() {
+        _nodes.push_back(_node{_op.identity(), _action.identity()});
+        return _nodes.size() - 1;
+    }
+    void _apply(size_type node, const tag_type &tag, size_type length) {
+        _nodes[node]._value = _mapping(tag, _nodes[node]._value, length);
+        if (length > 1) {
+            _nodes[node]._lazy = _action(_nodes[node]._lazy, tag);
+        }
+    }
+    void _push(size_type node, key_type lo, key_type hi); // materializes both children when a tag is pending
+    void _pull(size_type node) {
+        const size_type left = _nodes[node]._left, right = _nodes[node]._right;
+        _nodes[node]._value = _op(left != 0 ? _nodes[left]._value : _op.identity(),
+                                  right != 0 ? _nodes[right]._value : _op.identity());
+    }
+    void _update(size_type node, key_type lo, key_type hi, key_type left, key_type right, const tag_type &tag);
+    T _query(size_type node, key_type lo, key_type hi, key_type left, key_type right);
+
+  public:
+    dynamic_segment_tree() : dynamic_segment_tree(0, 0) {}
+    dynamic_segment_tree(key_type first, key_type last, const Operator &op = Operator(),
+                         const Allocator &alloc = Allocator()); // last - first must fit below 2^64 - 1
+    dynamic_segment_tree(const dynamic_segment_tree &other) = default;
+    dynamic_segment_tree(dynamic_segment_tree &&other) noexcept;
+    ~dynamic_segment_tree() = default;
+    dynamic_segment_tree &operator=(const dynamic_segment_tree &other) = default;
+    dynamic_segment_tree &operator=(dynamic_segment_tree &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    key_type first() const; // smallest key of the domain
+    key_type last() const;  // largest key of the domain
+    size_type node_count() const;
+    void reserve(size_type nodes);
+
+    void update(key_type pos, const tag_type &tag);
+    void update(key_type left, key_type right, const tag_type &tag); // [left, right]
+    value_type query(key_type pos);
+    value_type query(key_type left, key_type right); // [left, right]
+    void swap(dynamic_segment_tree &x) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_first, x._first);
+        swap(_last, x._last);
+        swap(_op, x._op);
+        _nodes.swap(x._nodes);
+    }
+    void clear(); // every key back to the identity, the domain is kept
+};
+
+// Sorted, deduplicated keys: maps each key to its rank so a dense tree of size() elements can stand in for a sparse
+// domain whose keys are known up front.
+export template <class Key, class Allocator = std::allocator<Key>> class coordinate_compression {
+  public:
+    using key_type = Key;
+    using size_type = std::size_t;
+    using allocator_type = Allocator;
+
+  private:
+    vector<Key, Allocator> _keys;
+
+  public:
+    coordinate_compression() = default;
+    explicit coordinate_compression(vector<Key, Allocator> keys);
+
+    size_type size() const;
+    bool contains(const Key &key) const;
+    size_type index(const Key &key) const; // rank of the first key not less than key; size() if there is none
+    const Key &key(size_type index) const;
+    std::span<const Key> keys() const;
+};
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::dynamic_segment_tree(key_type first, key_type last,
+                                                                                    const Operator &op,
+                                                                                    const Allocator &alloc)
+    : _first(first), _last(last), _op(op), _nodes(_node_allocator(alloc)) {}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::dynamic_segment_tree(
+    dynamic_segment_tree &&other) noexcept
+    : _first(other._first), _last(other._last), _op(std::move(other._op)), _nodes(std::move(other._nodes)) {
+    other._nodes.clear();
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping> &
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::operator=(dynamic_segment_tree &&other) noexcept {
+    if (this != &other) {
+        _first = other._first;
+        _last = other._last;
+        _op = std::move(other._op);
+        _nodes = std::move(other._nodes);
+        other._nodes.clear();
+    }
+    return *this;
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::allocator_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::get_allocator() const noexcept {
+    return allocator_type(_nodes.get_allocator());
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::key_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::first() const {
+    return _first;
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::key_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::last() const {
+    return _last;
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::node_count() const {
+    return _nodes.size();
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::reserve(size_type nodes) {
+    _nodes.reserve(nodes);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::_push(size_type node, key_type lo, key_type hi) {
+    if constexpr (std::equality_comparable<tag_type>) {
+        if (_nodes[node]._lazy == _action.identity()) {
+            return;
+        }
+    }
+    if (_nodes[node]._left == 0) {
+        const size_type child = _new_node();
+        _nodes[node]._left = child;
+    }
+    if (_nodes[node]._right == 0) {
+        const size_type child = _new_node();
+        _nodes[node]._right = child;
+    }
+    const key_type mid = _mid(lo, hi);
+    const tag_type tag = _nodes[node]._lazy;
+    _apply(_nodes[node]._left, tag, _length(lo, mid));
+    _apply(_nodes[node]._right, tag, _length(mid + 1, hi));
+    _nodes[node]._lazy = _action.identity();
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::_update(size_type node, key_type lo, key_type hi,
+                                                                            key_type left, key_type right,
+                                                                            const tag_type &tag) {
+    if (left <= lo && hi <= right) {
+        _apply(node, tag, _length(lo, hi));
+        return;
+    }
+    _push(node, lo, hi);
+    const key_type mid = _mid(lo, hi);
+    if (left <= mid) {
+        if (_nodes[node]._left == 0) {
+            const size_type child = _new_node();
+            _nodes[node]._left = child;
+        }
+        _update(_nodes[node]._left, lo, mid, left, right, tag);
+    }
+    if (mid < right) {
+        if (_nodes[node]._right == 0) {
+            const size_type child = _new_node();
+            _nodes[node]._right = child;
+        }
+        _update(_nodes[node]._right, mid + 1, hi, left, right, tag);
+    }
+    _pull(node);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+T dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::_query(size_type node, key_type lo, key_type hi,
+                                                                       key_type left, key_type right) {
+    if (left <= lo && hi <= right) {
+        return _nodes[node]._value;
+    }
+    _push(node, lo, hi);
+    const key_type mid = _mid(lo, hi);
+    T prefix = _op.identity(), suffix = _op.identity();
+    if (left <= mid && _nodes[node]._left != 0) {
+        prefix = _query(_nodes[node]._left, lo, mid, left, right);
+    }
+    if (mid < right && _nodes[node]._right != 0) {
+        suffix = _query(_nodes[node]._right, mid + 1, hi, left, right);
+    }
+    return _op(prefix, suffix);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::update(key_type pos, const tag_type &tag) {
+    update(pos, pos, tag);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::update(key_type left, key_type right,
+                                                                           const tag_type &tag) {
+    if (_nodes.empty()) {
+        _new_node();
+    }
+    _update(0, _first, _last, left, right, tag);
+} // [left, right]
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::value_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::query(key_type pos) {
+    return query(pos, pos);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::value_type
+dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::query(key_type left, key_type right) {
+    if (_nodes.empty()) {
+        return _op.identity();
+    }
+    return _query(0, _first, _last, left, right);
+} // [left, right]
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void dynamic_segment_tree<T, Allocator, Operator, Action, Mapping>::clear() {
+    _nodes.clear();
+}
+
+template <class Key, class Allocator>
+coordinate_compression<Key, Allocator>::coordinate_compression(vector<Key, Allocator> keys) : _keys(std::move(keys)) {
+    std::less<> comp;
+    _sort(_keys.begin(), _keys.end(), comp);
+    _keys.erase(std::unique(_keys.begin(), _keys.end()), _keys.end());
+}
+
+template <class Key, class Allocator>
+typename coordinate_compression<Key, Allocator>::size_type coordinate_compression<Key, Allocator>::size() const {
+    return _keys.size();
+}
+
+template <class Key, class Allocator> bool coordinate_compression<Key, Allocator>::contains(const Key &key) const {
+    return std::binary_search(_keys.begin(), _keys.end(), key);
+}
+
+template <class Key, class Allocator>
+typename coordinate_compression<Key, Allocator>::size_type
+coordinate_compression<Key, Allocator>::index(const Key &key) const {
+    return static_cast<size_type>(std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin());
+}
+
+template <class Key, class Allocator>
+const Key &coordinate_compression<Key, Allocator>::key(size_type index) const {
+    return _keys[index];
+}
+
+template <class Key, class Allocator> std::span<const Key> coordinate_compression<Key, Allocator>::keys() const {
+    return std::span<const Key>(_keys.data(), _keys.size());
+}
+} // namespace j
@@ -1,262 +1,322 @@
 /*
  * @ Created by jaehyung409 on 25. 1. 29.
  * @ Copyright (c) 2025 jaehyung409 All rights reserved.
- * This software is licensed under the MIT License. 
+ * This software is licensed under the MIT License.
  */
 
 module;
-#include <functional>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <ranges>
 #include <span>
+#include <stdexcept>
 #include <type_traits>
-#include <initializer_list>
-#include <algorithm>
+#include <utility>
 
-export module j.fenwick_tree;
+export module j:fenwick_tree;
 
-import j.array;
-import j.vector;
-import j.basics;
+import :array;
+import :basics;
+import :parallel;
+import :vector;
 
 namespace j {
-    export template<class T,
-                    std::size_t Extent = std::dynamic_extent,
-                    class Allocator = std::allocator<T>>
-    class fenwick_tree {
-    public:
-        using value_type = T;
-        using size_type = std::size_t;
-        using reference = T&;
-        using const_reference = const T&;
-        using pointer = T*;
-        using const_pointer = const T*;
-        using allocator_type = Allocator;
-
-    private:
-        pointer _tree;
-        plus<T> _op = plus<T>();
-        Allocator _alloc;
-        size_type _dynamic_size; // real size is _dynamic_size + 1 (1-based index)
-        value_type _identity = _op.identity();
-        void _init_update() {
-            for (size_type i = 1; i <= _dynamic_size; i++) {
-                size_type parent = i + (i & -i);
-                if (parent <= _dynamic_size) {
-                    _tree[parent] = _op(_tree[parent], _tree[i]);
-                }
-            }
+export template <class T, std::size_t Extent = std::dynamic_extent, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>> // operator (commutative group)
+class fenwick_tree {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    [[no_unique_address]] Operator _op;
+    vector<T, Allocator> _tree; // 1-based: _tree[0] is unused
+    size_type _dynamic_size;    // real size is _dynamic_size + 1 (1-based index)
+    value_type _identity = _op.identity();
+
+    void _check_size(size_type size) const {
+        if (Extent != std::dynamic_extent && Extent != size) {
+            throw std::invalid_argument("fenwick_tree: size mismatch");
         }
+    }
+    // O(n) build: every node adds itself to its parent once
+    template <class Policy> void _init_update(const Policy &policy);
 
-    public:
-        fenwick_tree() requires (Extent != std::dynamic_extent)
-            : fenwick_tree(Allocator()) {}
-        fenwick_tree(const Allocator& alloc)
-        requires (Extent != std::dynamic_extent);
-
-        template<class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        fenwick_tree(InputIter first, InputIter last, const Allocator& alloc = Allocator());
-
-        template <class Container>
-        requires (std::ranges::sized_range<Container> &&
-                  std::convertible_to<std::ranges::range_value_t<Container>, T>)
-        fenwick_tree(const Container& container, const Allocator& alloc = Allocator());
-
-        template <class Container>
-        requires (std::ranges::sized_range<Container> &&
-                  std::convertible_to<std::ranges::range_value_t<Container>, T>)
-        fenwick_tree(Container&& container, const Allocator& alloc = Allocator());
-
-        fenwick_tree(std::initializer_list<T> il, const Allocator& alloc = Allocator());
-
-        //template<container-compatible-range<T> R>
-        //fenwick_tree(from_range_t, R&& range, const Allocator& = Allocator());
-
-        fenwick_tree(const fenwick_tree& other);
-        fenwick_tree(fenwick_tree&& other) noexcept(
-                std::allocator_traits<Allocator>::is_always_equal::value);
-        ~fenwick_tree();
-        allocator_type get_allocator() const noexcept;
-
-        template<class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        void assign(InputIter first, InputIter last);
-        //template<container-compatible-range<T> R>
-        //void assign_range(R&& rg);
-        void assign(std::initializer_list<T> il);
-
-        size_type size() const;
-        value_type query(size_type index) const;
-        value_type query(size_type left, size_type right) const;
-        void update(size_type index, const value_type& value);
-        void swap(fenwick_tree& other) noexcept(
-                std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
-                std::allocator_traits<Allocator>::is_always_equal::value &&
-                std::is_nothrow_swappable_v<Allocator>) {
-            using std::swap;
-            swap(_tree, other._tree);
-            swap(_alloc, other._alloc);
-            swap(_dynamic_size, other._dynamic_size);
-            swap(_identity, other._identity);
-        }
-        void clear() noexcept;
-    };
+  public:
+    fenwick_tree()
+        requires(Extent != std::dynamic_extent)
+        : fenwick_tree(Allocator()) {}
+    explicit fenwick_tree(const Allocator &alloc)
+        requires(Extent != std::dynamic_extent);
 
-    template <class Container>
-    fenwick_tree(Container&&)
-        -> fenwick_tree<typename std::ranges::range_value_t<Container>>;
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    fenwick_tree(InputIter first, InputIter last, const Allocator &alloc = Allocator());
 
-    template <class T, std::size_t N>
-    fenwick_tree(array<T, N>&) -> fenwick_tree<T, N>;
+    template <class Container>
+        requires(std::ranges::sized_range<Container> && std::convertible_to<std::ranges::range_value_t<Container>, T>)
+    fenwick_tree(const Container &container, const Allocator &alloc = Allocator());
 
-    template <class T, std::size_t N>
-    fenwick_tree(const array<T, N>&) -> fenwick_tree<T, N>;
+    template <class Container>
+        requires(!std::is_lvalue_reference_v<Container> && std::ranges::sized_range<Container> &&
+                 std::convertible_to<std::ranges::range_value_t<Container>, T>)
+    fenwick_tree(Container &&container, const Allocator &alloc = Allocator());
+
+    fenwick_tree(std::initializer_list<T> il, const Allocator &alloc = Allocator());
+
+    fenwick_tree(const fenwick_tree &other) = default;
+    fenwick_tree(fenwick_tree &&other) noexcept;
+    ~fenwick_tree() = default;
+    fenwick_tree &operator=(const fenwick_tree &other) = default;
+    fenwick_tree &operator=(fenwick_tree &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+    template <execution_policy Policy, class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(Policy &&policy, InputIter first, InputIter last); // the build is split across threads under par
+
+    size_type size() const;
+    value_type query(size_type index) const;                  // [1, index]
+    value_type query(size_type left, size_type right) const; // [left, right]
+    size_type lower_bound(const value_type &value) const;     // first index with query(index) >= value, or size() + 1
+    void update(size_type index, const value_type &value);
+    // adds every value at its index; a large batch is applied in one O(n) pass
+    void update_many(std::span<const std::pair<size_type, value_type>> updates);
+    void swap(fenwick_tree &other) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+                                            std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        _tree.swap(other._tree);
+        swap(_dynamic_size, other._dynamic_size);
+        swap(_identity, other._identity);
+    }
+    void clear() noexcept;
+};
 
-    template <class InputIter, class Sentinel>
-    fenwick_tree(InputIter, Sentinel)
-        -> fenwick_tree<std::iter_value_t<InputIter>>;
+template <class Container> fenwick_tree(Container &&) -> fenwick_tree<typename std::ranges::range_value_t<Container>>;
 
-    template <class T>
-    fenwick_tree(std::initializer_list<T>) -> fenwick_tree<T>;
-}
+template <class T, std::size_t N> fenwick_tree(array<T, N> &) -> fenwick_tree<T, N>;
 
-namespace j {
-    template<class T, std::size_t Extent, class Allocator>
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(const Allocator &alloc)
-    requires (Extent != std::dynamic_extent)
-    : _alloc(alloc), _dynamic_size(Extent) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, Extent + 1);
-        for (size_type i = 1; i <= Extent; ++i) {
-            std::construct_at(std::addressof(_tree[i]), _identity);
-        }
-    }
+template <class T, std::size_t N> fenwick_tree(const array<T, N> &) -> fenwick_tree<T, N>;
 
-    template<class T, std::size_t Extent, class Allocator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(InputIter first, InputIter last, const Allocator &alloc)
-    : _alloc(alloc), _dynamic_size(std::distance(first, last)) {
-        if (Extent != std::dynamic_extent && Extent != _dynamic_size) {
-            throw std::invalid_argument("fenwick_tree: size mismatch");
-        }
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _dynamic_size + 1);
-        for (size_type i = 1; i <= _dynamic_size; ++i) {
-            std::construct_at(std::addressof(_tree[i]), *first++);
-        }
-        _init_update();
-    }
+template <class InputIter, class Sentinel>
+fenwick_tree(InputIter, Sentinel) -> fenwick_tree<std::iter_value_t<InputIter>>;
 
-    template<class T, std::size_t Extent, class Allocator>
-    template<class Container>
-    requires (std::ranges::sized_range<Container> &&
-              std::convertible_to<std::ranges::range_value_t<Container>, T>)
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(const Container &container, const Allocator &alloc)
-    : fenwick_tree(std::begin(container), std::end(container), alloc) {}
-
-    template<class T, std::size_t Extent, class Allocator>
-    template<class Container>
-    requires (std::ranges::sized_range<Container> &&
-              std::convertible_to<std::ranges::range_value_t<Container>, T>)
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(Container &&container, const Allocator &alloc)
-    : _alloc(alloc), _dynamic_size(container.size()) {
-        if (Extent != std::dynamic_extent && Extent != _dynamic_size) {
-            throw std::invalid_argument("fenwick_tree: size mismatch");
-        }
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _dynamic_size + 1);
-        std::uninitialized_move(container.begin(), container.end(), _tree + 1);
-        _init_update();
-    }
+template <class T> fenwick_tree(std::initializer_list<T>) -> fenwick_tree<T>;
 
+template <class T, std::size_t Extent, class Allocator, class Operator>
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(const Allocator &alloc)
+    requires(Extent != std::dynamic_extent)
+    : _tree(Extent + 1, Operator().identity(), alloc), _dynamic_size(Extent) {}
 
-    template<class T, std::size_t Extent, class Allocator>
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(std::initializer_list<T> il, const Allocator &alloc)
-    : fenwick_tree(il.begin(), il.end(), alloc) {}
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(InputIter first, InputIter last, const Allocator &alloc)
+    : _tree(alloc), _dynamic_size(0) {
+    assign(first, last);
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(const fenwick_tree &other)
-    : _alloc(other._alloc), _dynamic_size(other._dynamic_size) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _dynamic_size + 1);
-        for (size_type i = 1; i <= _dynamic_size; ++i) {
-            std::construct_at(std::addressof(_tree[i]), other._tree[i]);
-        }
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <class Container>
+    requires(std::ranges::sized_range<Container> && std::convertible_to<std::ranges::range_value_t<Container>, T>)
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(const Container &container, const Allocator &alloc)
+    : fenwick_tree(std::ranges::begin(container), std::ranges::end(container), alloc) {}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <class Container>
+    requires(!std::is_lvalue_reference_v<Container> && std::ranges::sized_range<Container> &&
+             std::convertible_to<std::ranges::range_value_t<Container>, T>)
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(Container &&container, const Allocator &alloc)
+    : _tree(alloc), _dynamic_size(static_cast<size_type>(std::ranges::size(container))) {
+    _check_size(_dynamic_size);
+    _tree.reserve(_dynamic_size + 1);
+    _tree.push_back(_identity);
+    for (auto &value : container) {
+        _tree.push_back(std::move(value));
     }
+    _init_update(execution::seq);
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    fenwick_tree<T, Extent, Allocator>::fenwick_tree(fenwick_tree &&other)
-    noexcept(std::allocator_traits<Allocator>::is_always_equal::value)
-    : _tree(other._tree), _alloc(std::move(other._alloc)), _dynamic_size(std::move(other._dynamic_size)) {
-        other._tree = nullptr;
-    }
+template <class T, std::size_t Extent, class Allocator, class Operator>
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(std::initializer_list<T> il, const Allocator &alloc)
+    : fenwick_tree(il.begin(), il.end(), alloc) {}
 
-    template<class T, std::size_t Extent, class Allocator>
-    fenwick_tree<T, Extent, Allocator>::~fenwick_tree() {
-        for (size_type i = 1; i <= _dynamic_size; ++i) {
-            std::destroy_at(std::addressof(_tree[i]));
-        }
-        std::allocator_traits<Allocator>::deallocate(_alloc, _tree, _dynamic_size + 1);
+template <class T, std::size_t Extent, class Allocator, class Operator>
+fenwick_tree<T, Extent, Allocator, Operator>::fenwick_tree(fenwick_tree &&other) noexcept
+    : _tree(std::move(other._tree)), _dynamic_size(std::exchange(other._dynamic_size, 0)),
+      _identity(std::move(other._identity)) {}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+fenwick_tree<T, Extent, Allocator, Operator> &
+fenwick_tree<T, Extent, Allocator, Operator>::operator=(fenwick_tree &&other) noexcept {
+    if (this != &other) {
+        _tree = std::move(other._tree);
+        _dynamic_size = std::exchange(other._dynamic_size, 0);
+        _identity = std::move(other._identity);
     }
+    return *this;
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    typename fenwick_tree<T, Extent, Allocator>::allocator_type
-    fenwick_tree<T, Extent, Allocator>::get_allocator() const noexcept {
-        return _alloc;
-    }
+template <class T, std::size_t Extent, class Allocator, class Operator>
+typename fenwick_tree<T, Extent, Allocator, Operator>::allocator_type
+fenwick_tree<T, Extent, Allocator, Operator>::get_allocator() const noexcept {
+    return _tree.get_allocator();
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    void fenwick_tree<T, Extent, Allocator>::assign(InputIter first, InputIter last) {
-        if (std::distance(first, last) != _dynamic_size) {
-            throw std::invalid_argument("fenwick_tree::assign: size mismatch");
+// sequential: one pass in index order. parallel: the pass runs on aligned chunks of _parallel_grain (a power of
+// two) at once, since a node's parent lies in its own chunk unless the node ends the chunk; those last nodes, whose
+// lowbit is at least the chunk size, are added to their parents afterwards in index order
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <class Policy>
+void fenwick_tree<T, Extent, Allocator, Operator>::_init_update(const Policy &policy) {
+    if constexpr (_is_parallel<Policy>) {
+        constexpr auto chunk = static_cast<size_type>(_parallel_grain);
+        auto build_chunk = [&](size_type c) {
+            const size_type last = std::min((c + 1) * chunk - 1, _dynamic_size);
+            for (size_type i = c * chunk + 1; i <= last; i++) {
+                size_type parent = i + (i & -i);
+                if (parent <= _dynamic_size) {
+                    _tree[parent] = _op(_tree[parent], _tree[i]);
+                }
+            }
+        };
+        _run_tasks(_pool_of(policy), (_dynamic_size + chunk - 1) / chunk, build_chunk);
+        for (size_type i = chunk; i <= _dynamic_size; i += chunk) {
+            size_type parent = i + (i & -i);
+            if (parent <= _dynamic_size) {
+                _tree[parent] = _op(_tree[parent], _tree[i]);
+            }
         }
-        if (_tree == nullptr) {
-            _tree = std::allocator_traits<Allocator>::allocate(_alloc, _dynamic_size + 1);
-            for (size_type i = 1; i <= _dynamic_size; ++i) {
-                std::construct_at(std::addressof(_tree[i]), _identity);
+    } else {
+        for (size_type i = 1; i <= _dynamic_size; i++) {
+            size_type parent = i + (i & -i);
+            if (parent <= _dynamic_size) {
+                _tree[parent] = _op(_tree[parent], _tree[i]);
             }
-        } else {
-            clear();
         }
-        std::copy(first, last, _tree + 1);
-        _init_update();
     }
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    void fenwick_tree<T, Extent, Allocator>::assign(std::initializer_list<T> il) {
-        assign(il.begin(), il.end());
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void fenwick_tree<T, Extent, Allocator, Operator>::assign(InputIter first, InputIter last) {
+    assign(execution::seq, first, last);
+}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+template <execution_policy Policy, class InputIter>
+    requires std::input_iterator<InputIter>
+void fenwick_tree<T, Extent, Allocator, Operator>::assign(Policy &&policy, InputIter first, InputIter last) {
+    if constexpr (std::forward_iterator<InputIter>) {
+        _check_size(static_cast<size_type>(std::distance(first, last))); // throws before the tree is touched
+        _tree.clear();
+        _tree.reserve(static_cast<size_type>(std::distance(first, last)) + 1);
+    } else {
+        _tree.clear();
     }
+    _tree.push_back(_identity);
+    for (; first != last; ++first) {
+        _tree.push_back(*first);
+    }
+    _dynamic_size = _tree.size() - 1;
+    _check_size(_dynamic_size);
+    _init_update(policy);
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    typename fenwick_tree<T, Extent, Allocator>::size_type
-    fenwick_tree<T, Extent, Allocator>::size() const {
-        return _dynamic_size;
+template <class T, std::size_t Extent, class Allocator, class Operator>
+void fenwick_tree<T, Extent, Allocator, Operator>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+typename fenwick_tree<T, Extent, Allocator, Operator>::size_type
+fenwick_tree<T, Extent, Allocator, Operator>::size() const {
+    return _dynamic_size;
+}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+typename fenwick_tree<T, Extent, Allocator, Operator>::value_type
+fenwick_tree<T, Extent, Allocator, Operator>::query(size_type index) const {
+    value_type result = _identity;
+    for (size_type i = index; i > 0; i -= i & -i) {
+        result = _op(result, _tree[i]);
     }
+    return result;
+}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+typename fenwick_tree<T, Extent, Allocator, Operator>::value_type
+fenwick_tree<T, Extent, Allocator, Operator>::query(size_type left, size_type right) const {
+    return _op(query(right), _op.inverse(query(left - 1)));
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    typename fenwick_tree<T, Extent, Allocator>::value_type
-    fenwick_tree<T, Extent, Allocator>::query(fenwick_tree::size_type index) const {
-        value_type result = _identity;
-        for (size_type i = index; i > 0; i -= i & -i) {
-            result = _op(result, _tree[i]);
+// power-of-two descent: each step takes the largest block that keeps the prefix below value, so the prefix sums
+// must not decrease (no negative elements)
+template <class T, std::size_t Extent, class Allocator, class Operator>
+typename fenwick_tree<T, Extent, Allocator, Operator>::size_type
+fenwick_tree<T, Extent, Allocator, Operator>::lower_bound(const value_type &value) const {
+    size_type pos = 0;
+    value_type prefix = _identity;
+    for (size_type step = std::bit_floor(_dynamic_size); step > 0; step >>= 1) {
+        if (pos + step <= _dynamic_size && _op(prefix, _tree[pos + step]) < value) {
+            pos += step;
+            prefix = _op(prefix, _tree[pos]);
         }
-        return result;
     }
+    return pos + 1;
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    typename fenwick_tree<T, Extent, Allocator>::value_type
-    fenwick_tree<T, Extent, Allocator>::query(fenwick_tree::size_type left, fenwick_tree::size_type right) const {
-        return query(right) - query(left - 1);
+template <class T, std::size_t Extent, class Allocator, class Operator>
+void fenwick_tree<T, Extent, Allocator, Operator>::update(size_type index, const value_type &value) {
+    for (size_type i = index; i <= _dynamic_size; i += i & -i) {
+        _tree[i] = _op(_tree[i], value);
     }
+}
 
-    template<class T, std::size_t Extent, class Allocator>
-    void fenwick_tree<T, Extent, Allocator>::update(fenwick_tree::size_type index, const value_type &value) {
-        for (size_type i = index; i <= _dynamic_size; i += i & -i) {
-            _tree[i] = _op(_tree[i], value);
+// a batch of at least n / 32 values is built into a tree of its own in O(n) and added node by node, which holds
+// because every node folds a fixed range under a commutative operator. smaller batches go one by one: a fenwick path
+// is log(n) / 2 nodes on average and spread paths share only the top few, which stay cached, so sorting the batch to
+// merge them costs more than it saves
+template <class T, std::size_t Extent, class Allocator, class Operator>
+void fenwick_tree<T, Extent, Allocator, Operator>::update_many(
+    std::span<const std::pair<size_type, value_type>> updates) {
+    if (updates.size() * 32 < _dynamic_size) {
+        for (const auto &[index, value] : updates) {
+            update(index, value);
         }
+        return;
     }
-
-    template<class T, std::size_t Extent, class Allocator>
-    void fenwick_tree<T, Extent, Allocator>::clear() noexcept {
-        std::fill(_tree + 1, _tree + _dynamic_size + 1, _identity);
+    vector<T, Allocator> deltas(_dynamic_size + 1, _identity, _tree.get_allocator());
+    for (const auto &[index, value] : updates) {
+        if (index <= _dynamic_size) {
+            deltas[index] = _op(deltas[index], value);
+        }
+    }
+    for (size_type i = 1; i <= _dynamic_size; i++) {
+        const size_type parent = i + (i & -i);
+        if (parent <= _dynamic_size) {
+            deltas[parent] = _op(deltas[parent], deltas[i]);
+        }
+        _tree[i] = _op(_tree[i], deltas[i]);
     }
-}
\ No newline at end of file
+}
+
+template <class T, std::size_t Extent, class Allocator, class Operator>
+void fenwick_tree<T, Extent, Allocator, Operator>::clear() noexcept {
+    std::fill(_tree.begin(), _tree.end(), _identity);
+}
+} // namespace j
@@ -0,0 +1,225 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+export module j:fenwick_tree_2d;
+
+import :basics;
+import :vector;
+
+namespace j {
+// node (row, col) aggregates the rows (row - lowbit(row), row] and the columns (col - lowbit(col), col]
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>> // operator (commutative group)
+class fenwick_tree_2d {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    [[no_unique_address]] Operator _op;
+    vector<T, Allocator> _tree; // 1-based, row-major (_rows + 1) x (_cols + 1): row 0 and column 0 are unused
+    size_type _rows;
+    size_type _cols;
+
+    T &_at(size_type row, size_type col) {
+        return _tree[row * (_cols + 1) + col];
+    }
+    const T &_at(size_type row, size_type col) const {
+        return _tree[row * (_cols + 1) + col];
+    }
+    void _init_update(); // O(rows * cols) build: along every row, then along every column
+
+  public:
+    fenwick_tree_2d() : fenwick_tree_2d(0, 0) {}
+    explicit fenwick_tree_2d(const Allocator &alloc) : fenwick_tree_2d(0, 0, alloc) {}
+    fenwick_tree_2d(size_type rows, size_type cols, const Allocator &alloc = Allocator());
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    fenwick_tree_2d(size_type rows, size_type cols, InputIter first, const Allocator &alloc = Allocator());
+    fenwick_tree_2d(std::initializer_list<std::initializer_list<T>> il, const Allocator &alloc = Allocator());
+
+    fenwick_tree_2d(const fenwick_tree_2d &other) = default;
+    fenwick_tree_2d(fenwick_tree_2d &&other) noexcept;
+    ~fenwick_tree_2d() = default;
+    fenwick_tree_2d &operator=(const fenwick_tree_2d &other) = default;
+    fenwick_tree_2d &operator=(fenwick_tree_2d &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(size_type rows, size_type cols, InputIter first); // rows * cols elements in row-major order
+    void assign(std::initializer_list<std::initializer_list<T>> il);
+
+    bool empty() const;
+    size_type rows() const;
+    size_type cols() const;
+    value_type query(size_type row, size_type col) const; // [1, row] x [1, col]
+    value_type query(size_type row1, size_type col1, size_type row2,
+                     size_type col2) const; // [row1, row2] x [col1, col2]
+    void update(size_type row, size_type col, const value_type &value);
+    void swap(fenwick_tree_2d &other) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+                                               std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        _tree.swap(other._tree);
+        swap(_rows, other._rows);
+        swap(_cols, other._cols);
+    }
+    void clear() noexcept;
+};
+
+template <class T, class Allocator, class Operator>
+fenwick_tree_2d<T, Allocator, Operator>::fenwick_tree_2d(size_type rows, size_type cols, const Allocator &alloc)
+    : _tree((rows + 1) * (cols + 1), Operator().identity(), alloc), _rows(rows), _cols(cols) {}
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+fenwick_tree_2d<T, Allocator, Operator>::fenwick_tree_2d(size_type rows, size_type cols, InputIter first,
+                                                         const Allocator &alloc)
+    : _tree(alloc), _rows(0), _cols(0) {
+    assign(rows, cols, first);
+}
+
+template <class T, class Allocator, class Operator>
+fenwick_tree_2d<T, Allocator, Operator>::fenwick_tree_2d(std::initializer_list<std::initializer_list<T>> il,
+                                                         const Allocator &alloc)
+    : _tree(alloc), _rows(0), _cols(0) {
+    assign(il);
+}
+
+template <class T, class Allocator, class Operator>
+fenwick_tree_2d<T, Allocator, Operator>::fenwick_tree_2d(fenwick_tree_2d &&other) noexcept
+    : _tree(std::move(other._tree)), _rows(std::exchange(other._rows, 0)), _cols(std::exchange(other._cols, 0)) {}
+
+template <class T, class Allocator, class Operator>
+fenwick_tree_2d<T, Allocator, Operator> &
+fenwick_tree_2d<T, Allocator, Operator>::operator=(fenwick_tree_2d &&other) noexcept {
+    if (this != &other) {
+        _tree = std::move(other._tree);
+        _rows = std::exchange(other._rows, 0);
+        _cols = std::exchange(other._cols, 0);
+    }
+    return *this;
+}
+
+template <class T, class Allocator, class Operator>
+typename fenwick_tree_2d<T, Allocator, Operator>::allocator_type
+fenwick_tree_2d<T, Allocator, Operator>::get_allocator() const noexcept {
+    return _tree.get_allocator();
+}
+
+// the 2d tree is the 1d tree of the 1d row trees, so the 1d build runs along each axis in turn
+template <class T, class Allocator, class Operator> void fenwick_tree_2d<T, Allocator, Operator>::_init_update() {
+    for (size_type row = 1; row <= _rows; ++row) {
+        for (size_type col = 1; col <= _cols; ++col) {
+            const size_type parent = col + (col & -col);
+            if (parent <= _cols) {
+                _at(row, parent) = _op(_at(row, parent), _at(row, col));
+            }
+        }
+    }
+    for (size_type row = 1; row <= _rows; ++row) {
+        const size_type parent = row + (row & -row);
+        if (parent <= _rows) {
+            for (size_type col = 1; col <= _cols; ++col) {
+                _at(parent, col) = _op(_at(parent, col), _at(row, col));
+            }
+        }
+    }
+}
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void fenwick_tree_2d<T, Allocator, Operator>::assign(size_type rows, size_type cols, InputIter first) {
+    _rows = rows;
+    _cols = cols;
+    _tree.assign((_rows + 1) * (_cols + 1), _op.identity());
+    for (size_type row = 1; row <= _rows; ++row) {
+        for (size_type col = 1; col <= _cols; ++col, ++first) {
+            _at(row, col) = *first;
+        }
+    }
+    _init_update();
+}
+
+template <class T, class Allocator, class Operator>
+void fenwick_tree_2d<T, Allocator, Operator>::assign(std::initializer_list<std::initializer_list<T>> il) {
+    const size_type cols = il.size() == 0 ? 0 : il.begin()->size();
+    if (std::any_of(il.begin(), il.end(), [cols](const auto &row) { return row.size() != cols; })) {
+        throw std::invalid_argument("fenwick_tree_2d: rows of different lengths");
+    }
+    vector<T, Allocator> values(_tree.get_allocator());
+    values.reserve(il.size() * cols);
+    for (const auto &row : il) {
+        values.insert(values.end(), row.begin(), row.end());
+    }
+    assign(il.size(), cols, values.begin());
+}
+
+template <class T, class Allocator, class Operator> bool fenwick_tree_2d<T, Allocator, Operator>::empty() const {
+    return _rows == 0 || _cols == 0;
+}
+
+template <class T, class Allocator, class Operator>
+typename fenwick_tree_2d<T, Allocator, Operator>::size_type fenwick_tree_2d<T, Allocator, Operator>::rows() const {
+    return _rows;
+}
+
+template <class T, class Allocator, class Operator>
+typename fenwick_tree_2d<T, Allocator, Operator>::size_type fenwick_tree_2d<T, Allocator, Operator>::cols() const {
+    return _cols;
+}
+
+template <class T, class Allocator, class Operator>
+typename fenwick_tree_2d<T, Allocator, Operator>::value_type
+fenwick_tree_2d<T, Allocator, Operator>::query(size_type row, size_type col) const {
+    value_type result = _op.identity();
+    for (size_type i = row; i > 0; i -= i & -i) {
+        for (size_type j = col; j > 0; j -= j & -j) {
+            result = _op(result, _at(i, j));
+        }
+    }
+    return result;
+}
+
+// inclusion-exclusion over the four prefix rectangles
+template <class T, class Allocator, class Operator>
+typename fenwick_tree_2d<T, Allocator, Operator>::value_type
+fenwick_tree_2d<T, Allocator, Operator>::query(size_type row1, size_type col1, size_type row2, size_type col2) const {
+    const value_type outer = _op(query(row2, col2), query(row1 - 1, col1 - 1));
+    const value_type sides = _op(query(row1 - 1, col2), query(row2, col1 - 1));
+    return _op(outer, _op.inverse(sides));
+}
+
+template <class T, class Allocator, class Operator>
+void fenwick_tree_2d<T, Allocator, Operator>::update(size_type row, size_type col, const value_type &value) {
+    for (size_type i = row; i <= _rows; i += i & -i) {
+        for (size_type j = col; j <= _cols; j += j & -j) {
+            _at(i, j) = _op(_at(i, j), value);
+        }
+    }
+}
+
+template <class T, class Allocator, class Operator> void fenwick_tree_2d<T, Allocator, Operator>::clear() noexcept {
+    std::fill(_tree.begin(), _tree.end(), _op.identity());
+}
+} // namespace j
@@ -5,497 +5,463 @@
  */
 
 module;
-#include <span>
-#include <cmath>
-#include <functional>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
 #include <initializer_list>
-#include <iostream> // for debug
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
 
-export module j.lazy_segment_tree;
+export module j:lazy_segment_tree;
 
-import j.basics;
+import :basics;
+import :vector;
 
 namespace j {
-    export template<class T,
-            class Allocator = std::allocator<T>,
-            class Operator = plus <T>> // operator (monoid)
-    class lazy_segment_tree {
-    public:
-        using value_type = T;
-        using size_type = std::size_t;
-        using reference = T&;
-        using const_reference = const T&;
-        using pointer = T*;
-        using const_pointer = const T*;
-        using allocator_type = Allocator;
-
-    private:
-        size_type _size;            // size of elements
-        size_type _array_size;      // size of segment tree array
-        value_type _identity;       // identity element
-        allocator_type _alloc;
-        Operator _op;
-        std::function<T(T, T)> _lazy_op;
-        std::function<T(T, T)> _lazy_op_inv;
-        value_type _lazy_identity;
-        pointer _tree;
-        pointer _lazy;              // lazy propagation
-        bool _is_built = false;     // built flag
-
-        size_type _resize(size_type size);
-        void _push(size_type pos, const size_type length) const {
-            if (_lazy[pos] != _lazy_identity) {
-                _apply(pos << 1, _lazy[pos], length >> 1);
-                _apply(pos << 1 | 1, _lazy[pos], length >> 1);
-                _lazy[pos] = _lazy_identity;
-            }
-        } // push lazy propagation
-        void _apply(size_type pos, const T& value, const size_type length) const {
-            _tree[pos] = _lazy_op(_tree[pos], value);
-            if (pos < _size) {
-                for (size_type i = 1; i < length; ++i) {
-                    _tree[pos] = _lazy_op_inv(_tree[pos], value);
-                }
-                _lazy[pos] = _lazy_op_inv(_lazy[pos], value);
+// Segment tree with lazy propagation over a value monoid (Operator) and a tag monoid (Action). Action(old, new)
+// composes pending tags and Mapping(tag, value, length) applies a tag to the aggregate of length elements, so
+// every apply is O(1). The leaves are padded to a power of two so a node at height h covers exactly 1 << h elements.
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>,      // operator (monoid)
+                 class Action = plus<T>,        // range tag (monoid)
+                 class Mapping = add_to_sum<T>> // tag x value x length -> value
+class lazy_segment_tree {
+  public:
+    using value_type = T;
+    using tag_type = std::remove_cvref_t<decltype(std::declval<const Action &>().identity())>;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    using _tag_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<tag_type>;
+
+    size_type _size;     // size of elements
+    size_type _capacity; // number of leaves, bit_ceil(_size)
+    size_type _log;      // height of the tree, log2(_capacity)
+    Operator _op;
+    [[no_unique_address]] Action _action;
+    [[no_unique_address]] Mapping _mapping;
+    mutable vector<T, Allocator> _tree;             // 2 * _capacity nodes; _tree[0] is unused
+    mutable vector<tag_type, _tag_allocator> _lazy; // pending tags of the internal nodes
+    bool _is_built = false;                         // built flag
+
+    void _reset(size_type size);
+    template <class InputIter> void _assign_leaves(InputIter first, size_type size);
+    void _push(size_type pos, const size_type length) const {
+        if constexpr (std::equality_comparable<tag_type>) {
+            if (_lazy[pos] == _action.identity()) {
+                return;
             }
-        } // update value
-        void _pull(size_type pos) const {
-            _tree[pos] = _op(_tree[pos << 1], _tree[pos << 1 | 1]);
         }
-
-    public:
-        lazy_segment_tree() : lazy_segment_tree(0, Operator()) {}
-        explicit lazy_segment_tree(size_type size) : lazy_segment_tree(size, Operator()) {}
-        explicit lazy_segment_tree(size_type size, const Operator &op) : lazy_segment_tree(size, op, Allocator()) {}
-        lazy_segment_tree(size_type size, const Operator &op, const Allocator &alloc);
-        template <class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        lazy_segment_tree(InputIter first, InputIter last,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        template <class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        lazy_segment_tree(InputIter first, InputIter last, size_type size_hint,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        //template <container-compatible-range<T> R>
-        //lazy_segment_tree(from_range_t, R&& range, const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        lazy_segment_tree(const lazy_segment_tree &other);
-        lazy_segment_tree(lazy_segment_tree &&other);
-        lazy_segment_tree(const lazy_segment_tree &other, const std::type_identity_t<Allocator> &alloc);
-        lazy_segment_tree(lazy_segment_tree &&other, const std::type_identity_t<Allocator> &alloc);
-        lazy_segment_tree(std::initializer_list<T> il,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        ~lazy_segment_tree();
-        lazy_segment_tree &operator=(const lazy_segment_tree &other);
-        lazy_segment_tree &operator=(lazy_segment_tree &&other) noexcept(
+        _apply(pos << 1, _lazy[pos], length >> 1);
+        _apply(pos << 1 | 1, _lazy[pos], length >> 1);
+        _lazy[pos] = _action.identity();
+    } // push lazy propagation
+    void _apply(size_type pos, const tag_type &tag, const size_type length) const {
+        _tree[pos] = _mapping(tag, _tree[pos], length);
+        if (pos < _capacity) {
+            _lazy[pos] = _action(_lazy[pos], tag);
+        }
+    } // update value
+    void _pull(size_type pos) const {
+        _tree[pos] = _op(_tree[pos << 1], _tree[pos << 1 | 1]);
+    }
+    void _push_bounds(size_type left, size_type right) const; // push the ancestors of [left, right) (leaf indices)
+    size_type _length(size_type pos) const {
+        return _capacity >> (std::bit_width(pos) - 1);
+    } // number of leaves under node pos
+
+  public:
+    lazy_segment_tree() : lazy_segment_tree(0, Operator()) {}
+    explicit lazy_segment_tree(size_type size) : lazy_segment_tree(size, Operator()) {}
+    explicit lazy_segment_tree(size_type size, const Operator &op) : lazy_segment_tree(size, op, Allocator()) {}
+    lazy_segment_tree(size_type size, const Operator &op, const Allocator &alloc);
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    lazy_segment_tree(InputIter first, InputIter last, const Operator &op = Operator(),
+                      const Allocator &alloc = Allocator());
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    lazy_segment_tree(InputIter first, InputIter last, size_type size_hint, const Operator &op = Operator(),
+                      const Allocator &alloc = Allocator());
+    lazy_segment_tree(const lazy_segment_tree &other) = default;
+    lazy_segment_tree(lazy_segment_tree &&other) noexcept;
+    lazy_segment_tree(const lazy_segment_tree &other, const std::type_identity_t<Allocator> &alloc);
+    lazy_segment_tree(lazy_segment_tree &&other, const std::type_identity_t<Allocator> &alloc);
+    lazy_segment_tree(std::initializer_list<T> il, const Operator &op = Operator(),
+                      const Allocator &alloc = Allocator());
+    ~lazy_segment_tree() = default;
+    lazy_segment_tree &operator=(const lazy_segment_tree &other) = default;
+    lazy_segment_tree &operator=(lazy_segment_tree &&other) noexcept(
         std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
         std::allocator_traits<Allocator>::is_always_equal::value);
-        lazy_segment_tree &operator=(std::initializer_list<T> il);
-        allocator_type get_allocator() const noexcept;
-
-        template<class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        void assign(InputIter first, InputIter last);
-        //template<container-compatible-range<T> R>
-        //void assign_range(R&& rg);
-        void assign(std::initializer_list<T> il);
-
-        bool empty() const;
-        size_type size() const; // return the number of elements
-        size_type tree_size() const; // return the size of the segment tree (real memory size)
-        size_type resize(size_type size);
-
-        void build();
-        bool is_built() const;
-        void update(size_type pos, const T &value);
-        void update(size_type left, size_type right, const T &value);
-        void flush() const;
-        Operator get_range_operator() const;
-        void set_range_operator(std::function<T(T, T)> op, std::function<T(T, T)> inv, T identity);
-
-        size_type query(size_type pos);
-        size_type query(size_type left, size_type right);
-        std::span<const T> data() const;
-        void swap(lazy_segment_tree& x) noexcept(
-        std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
-        std::allocator_traits<Allocator>::is_always_equal::value) {
-            using std::swap;
-            swap(_size, x._size);
-            swap(_array_size, x._array_size);
-            swap(_identity, x._identity);
-            swap(_alloc, x._alloc);
-            swap(_op, x._op);
-            swap(_tree, x._tree);
-            swap(_is_built, x._is_built);
-        }
-        void clear();
-    };
+    lazy_segment_tree &operator=(std::initializer_list<T> il);
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+
+    bool empty() const;
+    size_type size() const;      // return the number of elements
+    size_type tree_size() const; // return the size of the segment tree (real memory size)
+    size_type resize(size_type size);
+
+    void build();
+    bool is_built() const;
+    void update(size_type pos, const tag_type &tag);
+    void update(size_type left, size_type right, const tag_type &tag); // [left, right]
+    void flush() const;
+
+    value_type query(size_type pos);
+    value_type query(size_type left, size_type right); // [left, right]
+    // binary search on the aggregates: pred must hold for the identity and stay false once it turns false;
+    // the bounds are half-open here, so max_right returns one past the last element that keeps pred
+    template <class Predicate> size_type max_right(size_type left, Predicate pred); // largest r: pred([left, r))
+    template <class Predicate> size_type min_left(size_type right, Predicate pred); // least l: pred([l, right))
+    std::span<const T> data() const;
+    void swap(lazy_segment_tree &x) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+                                             std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_size, x._size);
+        swap(_capacity, x._capacity);
+        swap(_log, x._log);
+        swap(_op, x._op);
+        _tree.swap(x._tree);
+        _lazy.swap(x._lazy);
+        swap(_is_built, x._is_built);
+    }
+    void clear();
+};
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(size_type size, const Operator &op,
+                                                                              const Allocator &alloc)
+    : _size(0), _capacity(0), _log(0), _op(op), _tree(alloc), _lazy(_tag_allocator(alloc)) {
+    _reset(size);
 }
 
-namespace j {
-
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(lazy_segment_tree::size_type size, const Operator &op,
-                                                       const Allocator &alloc)
-            : _size(size), _array_size(size << 1), _identity(op.identity()), _alloc(alloc), _op(op) {
-        _lazy = std::allocator_traits<Allocator>::allocate(_alloc, _size);
-        _lazy_op = plus<value_type>();
-        _lazy_op_inv = plus<value_type>();
-        _lazy_identity = plus<value_type>().identity();
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        for (size_type i = 1; i < _size; ++i) {
-            std::construct_at(std::addressof(_lazy[i]), _lazy_identity);
-        }
-        for (size_type i = 1; i < _array_size; ++i) {
-            std::construct_at(std::addressof(_tree[i]), _identity);
-        }
-        _is_built = false;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(InputIter first, InputIter last,
+                                                                              const Operator &op,
+                                                                              const Allocator &alloc)
+    : lazy_segment_tree(0, op, alloc) {
+    assign(first, last);
+}
 
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(InputIter first, InputIter last, const Operator &op,
-                                                       const Allocator &alloc)
-            : lazy_segment_tree(first, last, std::distance(first, last), op, alloc) {}
-
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(InputIter first, InputIter last,
-                                                       lazy_segment_tree::size_type size_hint, const Operator &op,
-                                                       const Allocator &alloc)
-            : _size(size_hint), _array_size(_size << 1), _identity(op.identity()),
-              _alloc(alloc), _op(op) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        _lazy = std::allocator_traits<Allocator>::allocate(_alloc, _size);
-        _lazy_op = plus<value_type>();
-        _lazy_op_inv = plus<value_type>();
-        _lazy_identity = plus<value_type>().identity();
-        for (size_type i = 1; i < _size; ++i) {
-            std::construct_at(std::addressof(_lazy[i]), _lazy_identity);
-        }
-        std::uninitialized_copy(first, last, _tree + _size);
-        build();
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(InputIter first, InputIter last,
+                                                                              size_type size_hint, const Operator &op,
+                                                                              const Allocator &alloc)
+    : lazy_segment_tree(0, op, alloc) {
+    _assign_leaves(first, size_hint);
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(const lazy_segment_tree &other)
-            : lazy_segment_tree(other, other.get_allocator()) {}
-
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(lazy_segment_tree &&other)
-            : lazy_segment_tree(std::move(other), std::move(other.get_allocator())) {}
-
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(const lazy_segment_tree &other,
-                                                       const std::type_identity_t <Allocator> &alloc)
-            : _size(other._size), _array_size(other._array_size), _alloc(alloc), _is_built(other._is_built) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        _lazy = std::allocator_traits<Allocator>::allocate(_alloc, _size);
-        _lazy_op = plus<value_type>();
-        _lazy_op_inv = plus<value_type>();
-        _lazy_identity = plus<value_type>().identity();
-        std::uninitialized_copy(other._lazy, other._lazy + _size, _lazy);
-        std::uninitialized_copy(other._tree, other._tree + _array_size, _tree);
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(lazy_segment_tree &&other) noexcept
+    : _size(std::exchange(other._size, 0)), _capacity(std::exchange(other._capacity, 0)),
+      _log(std::exchange(other._log, 0)), _op(std::move(other._op)), _tree(std::move(other._tree)),
+      _lazy(std::move(other._lazy)), _is_built(std::exchange(other._is_built, false)) {}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(
+    const lazy_segment_tree &other, const std::type_identity_t<Allocator> &alloc)
+    : _size(other._size), _capacity(other._capacity), _log(other._log), _op(other._op), _tree(other._tree, alloc),
+      _lazy(other._lazy, _tag_allocator(alloc)), _is_built(other._is_built) {}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(
+    lazy_segment_tree &&other, const std::type_identity_t<Allocator> &alloc)
+    : _size(std::exchange(other._size, 0)), _capacity(std::exchange(other._capacity, 0)),
+      _log(std::exchange(other._log, 0)), _op(std::move(other._op)), _tree(std::move(other._tree), alloc),
+      _lazy(std::move(other._lazy), _tag_allocator(alloc)), _is_built(std::exchange(other._is_built, false)) {}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::lazy_segment_tree(std::initializer_list<T> il,
+                                                                              const Operator &op,
+                                                                              const Allocator &alloc)
+    : lazy_segment_tree(il.begin(), il.end(), op, alloc) {}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping> &
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::operator=(lazy_segment_tree &&other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+    if (this != &other) {
+        _size = std::exchange(other._size, 0);
+        _capacity = std::exchange(other._capacity, 0);
+        _log = std::exchange(other._log, 0);
+        _op = std::move(other._op);
+        _tree = std::move(other._tree);
+        _lazy = std::move(other._lazy);
+        _is_built = std::exchange(other._is_built, false);
     }
+    return *this;
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(lazy_segment_tree &&other,
-                                                       const std::type_identity_t <Allocator> &alloc)
-            : _size(other._size), _array_size(other._array_size), _alloc(alloc), _is_built(other._is_built) {
-        _tree = other._tree;
-        _lazy = other._lazy;
-        _lazy_op = other._lazy_op;
-        _lazy_op_inv = other._lazy_op_inv;
-        _lazy_identity = other._lazy_identity;
-        other._tree = nullptr;
-        other._lazy = nullptr;
-        other._is_built = false;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping> &
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::operator=(std::initializer_list<T> il) {
+    assign(il);
+    return *this;
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::lazy_segment_tree(std::initializer_list<T> il, const Operator &op,
-                                                       const Allocator &alloc)
-            : lazy_segment_tree(il.begin(), il.end(), op, alloc) {}
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::allocator_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::get_allocator() const noexcept {
+    return _tree.get_allocator();
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::~lazy_segment_tree() {
-        for (size_type i = 1; i < _array_size; ++i) {
-            std::destroy_at(std::addressof(_tree[i]));
-        }
-        for (size_type i = 1; i < _size; ++i) {
-            std::destroy_at(std::addressof(_lazy[i]));
-        }
-        std::allocator_traits<Allocator>::deallocate(_alloc, _tree, _array_size);
-        std::allocator_traits<Allocator>::deallocate(_alloc, _lazy, _size);
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::_reset(size_type size) {
+    _size = size;
+    _capacity = std::bit_ceil(std::max<size_type>(_size, 1));
+    _log = static_cast<size_type>(std::countr_zero(_capacity));
+    _tree.assign(_capacity << 1, _op.identity());
+    _lazy.assign(_capacity, _action.identity());
+    _is_built = false;
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator> &lazy_segment_tree<T, Allocator, Operator>::operator=(const lazy_segment_tree &other) {
-        if (this != &other) {
-            _size = other._size;
-            _array_size = other._array_size;
-            _identity = other._identity;
-            _resize(_size);
-            _alloc = other._alloc;
-            _is_built = other._is_built;
-            _lazy_op = other._lazy_op;
-            _lazy_op_inv = other._lazy_op_inv;
-            _lazy_identity = other._lazy_identity;
-            std::uninitialized_copy(other._tree, other._tree + _array_size, _tree);
-            std::uninitialized_copy(other._lazy, other._lazy + _size, _lazy);
-        }
-        return *this;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class InputIter>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::_assign_leaves(InputIter first, size_type size) {
+    _reset(size);
+    std::copy_n(first, _size, _tree.begin() + static_cast<std::ptrdiff_t>(_capacity));
+    build();
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator> &lazy_segment_tree<T, Allocator, Operator>::operator=(lazy_segment_tree &&other)
-    noexcept (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
-              std::allocator_traits<Allocator>::is_always_equal::value) {
-        if (this != &other) {
-            clear();
-            _size = other._size;
-            _array_size = other._array_size;
-            _alloc = std::move(other._alloc);
-            _is_built = other._is_built;
-            _tree = other._tree;
-            _lazy = other._lazy;
-            _lazy_op = other._lazy_op;
-            _lazy_op_inv = other._lazy_op_inv;
-            _lazy_identity = other._lazy_identity;
-            other._tree = nullptr;
-            other._lazy = nullptr;
-            other._is_built = false;
-        }
-        return *this;
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::assign(InputIter first, InputIter last) {
+    if constexpr (std::forward_iterator<InputIter>) {
+        _assign_leaves(first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        // single pass: collect the elements to learn their number
+        vector<T, Allocator> leaves(first, last, _tree.get_allocator());
+        _assign_leaves(leaves.begin(), leaves.size());
     }
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator> &lazy_segment_tree<T, Allocator, Operator>::operator=(std::initializer_list<T> il) {
-        assign(il);
-        return *this;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
 
-    template<class T, class Allocator, class Operator>
-    lazy_segment_tree<T, Allocator, Operator>::allocator_type lazy_segment_tree<T, Allocator, Operator>::get_allocator() const noexcept {
-        return _alloc;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+bool lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::empty() const {
+    return _size == 0;
+}
 
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    void lazy_segment_tree<T, Allocator, Operator>::assign(InputIter first, InputIter last) {
-        if (_tree == nullptr) {
-            _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-            _lazy = std::allocator_traits<Allocator>::allocate(_alloc, _size);
-            _lazy_op = plus<value_type>();
-            _lazy_op_inv = plus<value_type>();
-            _lazy_identity = plus<value_type>().identity();
-            _size = std::distance(first, last);
-            _array_size = _size << 1;
-        } else {
-            _resize(std::distance(first, last));
-        }
-        for (size_type i = 1; i < _size; ++i) {
-            std::construct_at(std::addressof(_lazy[i]), _lazy_identity);
-        }
-        std::uninitialized_copy(first, last, _tree + _size);
-        build();
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size() const {
+    return _size;
+}
 
-    template<class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::assign(std::initializer_list<T> il) {
-        assign(il.begin(), il.end());
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::tree_size() const {
+    return _tree.size() + _lazy.size();
+}
 
-    template<class T, class Allocator, class Operator>
-    bool lazy_segment_tree<T, Allocator, Operator>::empty() const {
-        return _size == 0;
+// a new size discards the elements: every node is reset to the identity
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::resize(size_type size) {
+    if (size != _size) {
+        _reset(size);
     }
+    return _size;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type lazy_segment_tree<T, Allocator, Operator>::size() const {
-        return _size;
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::build() {
+    for (size_type i = _capacity; i-- > 1;) {
+        _pull(i);
     }
+    std::fill(_lazy.begin(), _lazy.end(), _action.identity());
+    _is_built = true;
+} // build segment tree, pending tags are dropped
 
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type lazy_segment_tree<T, Allocator, Operator>::tree_size() const {
-        return _array_size;
-    }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+bool lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::is_built() const {
+    return _is_built;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type
-    lazy_segment_tree<T, Allocator, Operator>::resize(lazy_segment_tree::size_type size) {
-        size_type ret = _resize(size);
-        if (ret != _size) {
-            for (size_type i = 1; i < _size; ++i) {
-                std::construct_at(std::addressof(_lazy[i]), _lazy_identity);
-            }
-            for (size_type i = 1; i < _array_size; ++i) {
-                std::construct_at(std::addressof(_tree[i]), _identity);
-            }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::_push_bounds(size_type left, size_type right) const {
+    for (size_type i = _log; i > 0; --i) {
+        if (((left >> i) << i) != left) {
+            _push(left >> i, size_type(1) << i);
         }
-        return ret;
-    }
-
-    template<class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::build() {
-        for (size_type i = _size - 1; i > 0; --i) {
-            _tree[i] = _op(_tree[i << 1], _tree[i << 1 | 1]);
+        if (((right >> i) << i) != right) {
+            _push((right - 1) >> i, size_type(1) << i);
         }
-        _is_built = true;
-    } // build segment tree, didn't build lazy propagation
-
-    template<class T, class Allocator, class Operator>
-    bool lazy_segment_tree<T, Allocator, Operator>::is_built() const {
-        return _is_built;
     }
+}
 
-    template<class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::update(lazy_segment_tree::size_type pos, const T &value) {
-        pos += _size;
-        for (size_type i = 63 - __builtin_clzll(pos); i > 0; --i) {
-            _push(pos >> i, 1 >> i);
-        }
-        _apply(pos, value, 1);
-        for (size_type i = 1; i <= 63 - __builtin_clzll(pos); ++i) {
-            _pull(pos >> i);
-        }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::update(size_type pos, const tag_type &tag) {
+    pos += _capacity;
+    for (size_type i = _log; i > 0; --i) {
+        _push(pos >> i, size_type(1) << i);
+    }
+    _apply(pos, tag, 1);
+    for (size_type i = 1; i <= _log; ++i) {
+        _pull(pos >> i);
     }
+}
 
-    template <class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::update(size_type left, size_type right, const T& value) {
-        left += _size;
-        right += _size;
-        for (size_type i = 63 - __builtin_clzll(left); i > 0; --i) {
-            if (left >> i << i != left) {
-                _push(left >> i, 1 >> i);
-            }
-            if (right >> i << i != right + 1) {
-                _push(right >> i, 1 >> i);
-            }
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::update(size_type left, size_type right,
+                                                                        const tag_type &tag) {
+    left += _capacity;
+    right += _capacity + 1;
+    _push_bounds(left, right);
+    for (size_type L = left, R = right, length = 1; L < R; L >>= 1, R >>= 1, length <<= 1) {
+        if (L & 1) {
+            _apply(L++, tag, length);
         }
-        for (size_type i = 1, L = left, R = right; L <= R; L >>= 1, R >>= 1, i <<= 1) {
-            if (L & 1) {
-                _apply(L++, value, i);
-            }
-            if (~R & 1) {
-                _apply(R--, value, i);
-            }
-        }
-        for (;; left >>= 1) {
-            if (left & 1) {
-                break;
-            }
-        }
-        for (;; right >>= 1) {
-            if (~right & 1) {
-                break;
-            }
-        }
-        for (left >>= 1; left > 0; left >>= 1) {
-            _pull(left);
+        if (R & 1) {
+            _apply(--R, tag, length);
         }
-        for (right >>= 1; right > 0; right >>= 1) {
-            _pull(right);
+    }
+    for (size_type i = 1; i <= _log; ++i) {
+        if (((left >> i) << i) != left) {
+            _pull(left >> i);
         }
-    } // [left, right]
-
-    template <class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::flush() const {
-        size_type size = _size;
-        while (size > 1) {
-            const size_type count = _size / size;
-            for (size_type i = 0; i < count; ++i) {
-                _push(i + count, size);
-            }
-            size >>= 1;
+        if (((right >> i) << i) != right) {
+            _pull((right - 1) >> i);
         }
     }
+} // [left, right]
 
-    template <class T, class Allocator, class Operator>
-    Operator lazy_segment_tree<T, Allocator, Operator>::get_range_operator() const {
-        return _lazy_op;
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::flush() const {
+    for (size_type pos = 1; pos < _capacity; ++pos) {
+        _push(pos, _length(pos));
     }
-
-    template <class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::set_range_operator(std::function<T(T, T)> op,
-                                                                       std::function<T(T, T)> inv, T identity) {
-        flush();
-        _lazy_identity = identity;
-        _lazy_op = std::move(op);
-        _lazy_op_inv = std::move(inv);
+} // push every pending tag down to the leaves
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::value_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::query(size_type pos) {
+    pos += _capacity;
+    for (size_type i = _log; i > 0; --i) {
+        _push(pos >> i, size_type(1) << i);
     }
+    return _tree[pos];
+}
 
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type
-    lazy_segment_tree<T, Allocator, Operator>::query(lazy_segment_tree::size_type pos) {
-        pos += _size;
-        for (size_type i = 63 - __builtin_clzll(pos); i > 0; --i) {
-            _push(pos >> i, 1 >> i);
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::value_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::query(size_type left, size_type right) {
+    T Left = _op.identity(), Right = _op.identity();
+    left += _capacity;
+    right += _capacity + 1;
+    _push_bounds(left, right);
+    for (; left < right; left >>= 1, right >>= 1) {
+        if (left & 1) {
+            Left = _op(Left, _tree[left++]);
         }
-        return _tree[pos];
-    }
-
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type
-    lazy_segment_tree<T, Allocator, Operator>::query(lazy_segment_tree::size_type left, lazy_segment_tree::size_type right) {
-        size_type Left = _identity, Right = _identity;
-        left += _size;
-        right += _size;
-        for (size_type i = 63 - __builtin_clzll(left); i > 0; --i) {
-            if (left >> i << i != left) {
-                _push(left >> i, 1 >> i);
-            }
-            if (right >> i << i != right + 1) {
-                _push(right >> i, 1 >> i);
-            }
+        if (right & 1) {
+            Right = _op(_tree[--right], Right);
         }
-        for (; left <= right; left >>= 1, right >>= 1) {
-            if (left & 1) {
-                Left = _op(Left, _tree[left++]);
-            }
-            if (~right & 1) {
-                Right = _op(_tree[right--], Right);
+    }
+    return _op(Left, Right);
+} // [left, right]
+
+// climbs from the left leaf while it is a left child, then descends into the first node that fails pred
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class Predicate>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::max_right(size_type left, Predicate pred) {
+    if (left == _size) {
+        return _size;
+    }
+    left += _capacity;
+    for (size_type i = _log; i > 0; --i) {
+        _push(left >> i, size_type(1) << i);
+    }
+    T prefix = _op.identity();
+    do {
+        left >>= std::countr_zero(left);
+        if (!pred(_op(prefix, _tree[left]))) {
+            while (left < _capacity) {
+                _push(left, _length(left));
+                left <<= 1;
+                if (pred(_op(prefix, _tree[left]))) {
+                    prefix = _op(prefix, _tree[left++]);
+                }
             }
+            return left - _capacity;
         }
-        return _op(Left, Right);
-    } // [left, right]
+        prefix = _op(prefix, _tree[left++]);
+    } while (!std::has_single_bit(left));
+    return _size;
+}
 
-    template<class T, class Allocator, class Operator>
-    std::span<const T> lazy_segment_tree<T, Allocator, Operator>::data() const {
-        flush();
-        return std::span<const T>(_tree + _size, _size);
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+template <class Predicate>
+typename lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::size_type
+lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::min_left(size_type right, Predicate pred) {
+    if (right == 0) {
+        return 0;
     }
-
-    template<class T, class Allocator, class Operator>
-    void lazy_segment_tree<T, Allocator, Operator>::clear() {
-        for (size_type i = 1; i < _array_size; ++i) {
-            std::destroy_at(std::addressof(_tree[i]));
+    right += _capacity;
+    for (size_type i = _log; i > 0; --i) {
+        _push((right - 1) >> i, size_type(1) << i);
+    }
+    T suffix = _op.identity();
+    do {
+        --right;
+        while (right > 1 && (right & 1)) {
+            right >>= 1;
         }
-        for (size_type i = 1; i < _size; ++i) {
-            std::destroy_at(std::addressof(_lazy[i]));
+        if (!pred(_op(_tree[right], suffix))) {
+            while (right < _capacity) {
+                _push(right, _length(right));
+                right = right << 1 | 1;
+                if (pred(_op(_tree[right], suffix))) {
+                    suffix = _op(_tree[right--], suffix);
+                }
+            }
+            return right + 1 - _capacity;
         }
-        std::allocator_traits<Allocator>::deallocate(_alloc, _tree, _array_size);
-        std::allocator_traits<Allocator>::deallocate(_alloc, _lazy, _size);
-        _size = 0;
-        _array_size = 0;
-        _tree = nullptr;
-        _is_built = false;
-    }
+        suffix = _op(_tree[right], suffix);
+    } while (!std::has_single_bit(right));
+    return 0;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename lazy_segment_tree<T, Allocator, Operator>::size_type
-    lazy_segment_tree<T, Allocator, Operator>::_resize(size_type size) {
-        if (size == _size) {
-            return _size;
-        }
-        clear();
-        _size = size;
-        _array_size = _size << 1;
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        _lazy = std::allocator_traits<Allocator>::allocate(_alloc, _size);
-        _is_built = false;
-        return _size;
-    }
-}
\ No newline at end of file
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+std::span<const T> lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::data() const {
+    flush();
+    return std::span<const T>(_tree.data() + _capacity, _size);
+}
+
+template <class T, class Allocator, class Operator, class Action, class Mapping>
+void lazy_segment_tree<T, Allocator, Operator, Action, Mapping>::clear() {
+    _tree.clear();
+    _tree.shrink_to_fit();
+    _lazy.clear();
+    _lazy.shrink_to_fit();
+    _size = 0;
+    _capacity = 0;
+    _log = 0;
+    _is_built = false;
+}
+} // namespace j
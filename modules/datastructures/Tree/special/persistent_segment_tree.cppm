@@ -0,0 +1,360 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+
+export module j:persistent_segment_tree;
+
+import :basics;
+import :vector;
+
+namespace j {
+// Segment tree whose versions share structure: update copies the O(log n) nodes on the path to the leaf and returns
+// the new version, every older version stays valid and queryable. Nodes live in an index-linked pool; collect()
+// returns the nodes no longer reachable from the given versions to it in one pass.
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>> // operator (monoid)
+class persistent_segment_tree {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+    class version {
+        friend persistent_segment_tree;
+        size_type _root = _null;
+        explicit version(size_type root) : _root(root) {}
+
+      public:
+        version() = default;
+        bool operator==(const version &other) const = default;
+    }; // handle to the root of one version; valid until a collect() that does not keep it
+
+  private:
+    static constexpr size_type _null = std::numeric_limits<size_type>::max();
+    struct _node {
+        T _value;
+        size_type _left;  // child index, or the next free node while the node is in the free list
+        size_type _right; // child index, _null for leaves
+    };
+    using _node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<_node>;
+
+    size_type _size; // size of elements
+    Operator _op;
+    vector<_node, _node_allocator> _nodes; // the pool: live nodes of every version and the free list
+    size_type _free = _null;               // head of the free list
+    size_type _live = 0;                   // nodes not in the free list
+    version _initial;
+
+    size_type _new_node(const T &value, size_type left, size_type right);
+    template <class InputIter> size_type _build(InputIter &first, size_type length);
+    T _query(size_type node, size_type lo, size_type hi, size_type left, size_type right) const;
+
+  public:
+    persistent_segment_tree() : persistent_segment_tree(0) {}
+    explicit persistent_segment_tree(size_type size, const Operator &op = Operator(),
+                                     const Allocator &alloc = Allocator());
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    persistent_segment_tree(InputIter first, InputIter last, const Operator &op = Operator(),
+                            const Allocator &alloc = Allocator());
+    persistent_segment_tree(std::initializer_list<T> il, const Operator &op = Operator(),
+                            const Allocator &alloc = Allocator());
+    persistent_segment_tree(const persistent_segment_tree &other) = default;
+    persistent_segment_tree(persistent_segment_tree &&other) noexcept;
+    ~persistent_segment_tree() = default;
+    persistent_segment_tree &operator=(const persistent_segment_tree &other) = default;
+    persistent_segment_tree &operator=(persistent_segment_tree &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    bool empty() const;
+    size_type size() const;       // return the number of elements
+    size_type node_count() const; // live nodes across all versions
+    void reserve(size_type nodes);
+
+    version initial() const; // the version built by the constructor, unless a collect() dropped it
+    version update(version v, size_type pos, const T &value);
+    value_type query(version v, size_type pos) const;
+    value_type query(version v, size_type left, size_type right) const; // [left, right)
+    void collect(std::span<const version> keep); // every version not in keep becomes invalid
+    void swap(persistent_segment_tree &x) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_size, x._size);
+        swap(_op, x._op);
+        _nodes.swap(x._nodes);
+        swap(_free, x._free);
+        swap(_live, x._live);
+        swap(_initial, x._initial);
+    }
+    void clear();
+};
+
+template <class InputIter, class Sentinel>
+persistent_segment_tree(InputIter, Sentinel) -> persistent_segment_tree<std::iter_value_t<InputIter>>;
+
+template <class T> persistent_segment_tree(std::initializer_list<T>) -> persistent_segment_tree<T>;
+
+template <class T, class Allocator, class Operator>
+persistent_segment_tree<T, Allocator, Operator>::persistent_segment_tree(size_type size, const Operator &op,
+                                                                         const Allocator &alloc)
+    : _size(size), _op(op), _nodes(_node_allocator(alloc)) {
+    _nodes.reserve(_size == 0 ? 0 : 2 * _size - 1);
+    struct identity_iterator {
+        const Operator *_op;
+        T operator*() const {
+            return _op->identity();
+        }
+        identity_iterator &operator++() {
+            return *this;
+        }
+    } first{&_op};
+    _initial = version(_build(first, _size));
+}
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+persistent_segment_tree<T, Allocator, Operator>::persistent_segment_tree(InputIter first, InputIter last,
+                                                                         const Operator &op, const Allocator &alloc)
+    : _size(0), _op(op), _nodes(_node_allocator(alloc)) {
+    if constexpr (std::forward_iterator<InputIter>) {
+        _size = static_cast<size_type>(std::distance(first, last));
+        _nodes.reserve(_size == 0 ? 0 : 2 * _size - 1);
+        _initial = version(_build(first, _size));
+    } else {
+        // single pass: collect the elements to learn their number
+        vector<T, Allocator> leaves(first, last, alloc);
+        _size = leaves.size();
+        _nodes.reserve(_size == 0 ? 0 : 2 * _size - 1);
+        auto it = leaves.begin();
+        _initial = version(_build(it, _size));
+    }
+}
+
+template <class T, class Allocator, class Operator>
+persistent_segment_tree<T, Allocator, Operator>::persistent_segment_tree(std::initializer_list<T> il,
+                                                                         const Operator &op, const Allocator &alloc)
+    : persistent_segment_tree(il.begin(), il.end(), op, alloc) {}
+
+template <class T, class Allocator, class Operator>
+persistent_segment_tree<T, Allocator, Operator>::persistent_segment_tree(persistent_segment_tree &&other) noexcept
+    : _size(std::exchange(other._size, 0)), _op(std::move(other._op)), _nodes(std::move(other._nodes)),
+      _free(std::exchange(other._free, _null)), _live(std::exchange(other._live, 0)),
+      _initial(std::exchange(other._initial, version())) {}
+
+template <class T, class Allocator, class Operator>
+persistent_segment_tree<T, Allocator, Operator> &
+persistent_segment_tree<T, Allocator, Operator>::operator=(persistent_segment_tree &&other) noexcept {
+    if (this != &other) {
+        _size = std::exchange(other._size, 0);
+        _op = std::move(other._op);
+        _nodes = std::move(other._nodes);
+        _free = std::exchange(other._free, _null);
+        _live = std::exchange(other._live, 0);
+        _initial = std::exchange(other._initial, version());
+    }
+    return *this;
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::allocator_type
+persistent_segment_tree<T, Allocator, Operator>::get_allocator() const noexcept {
+    return allocator_type(_nodes.get_allocator());
+}
+
+// a free node is reused before the pool grows
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::size_type
+persistent_segment_tree<T, Allocator, Operator>::_new_node(const T &value, size_type left, size_type right) {
+    ++_live;
+    if (_free != _null) {
+        const size_type node = _free;
+        _free = _nodes[node]._left;
+        _nodes[node] = _node{value, left, right};
+        return node;
+    }
+    _nodes.push_back(_node{value, left, right});
+    return _nodes.size() - 1;
+}
+
+// post-order over [first, first + length): the left half takes length / 2 elements, the same split as the queries
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+typename persistent_segment_tree<T, Allocator, Operator>::size_type
+persistent_segment_tree<T, Allocator, Operator>::_build(InputIter &first, size_type length) {
+    if (length == 0) {
+        return _null;
+    }
+    if (length == 1) {
+        const size_type leaf = _new_node(*first, _null, _null);
+        ++first;
+        return leaf;
+    }
+    const size_type left = _build(first, length / 2);
+    const size_type right = _build(first, length - length / 2);
+    return _new_node(_op(_nodes[left]._value, _nodes[right]._value), left, right);
+}
+
+template <class T, class Allocator, class Operator>
+bool persistent_segment_tree<T, Allocator, Operator>::empty() const {
+    return _size == 0;
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::size_type
+persistent_segment_tree<T, Allocator, Operator>::size() const {
+    return _size;
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::size_type
+persistent_segment_tree<T, Allocator, Operator>::node_count() const {
+    return _live;
+}
+
+template <class T, class Allocator, class Operator>
+void persistent_segment_tree<T, Allocator, Operator>::reserve(size_type nodes) {
+    _nodes.reserve(nodes);
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::version
+persistent_segment_tree<T, Allocator, Operator>::initial() const {
+    return _initial;
+}
+
+// descend recording the path, then copy it bottom-up; v itself is left untouched
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::version
+persistent_segment_tree<T, Allocator, Operator>::update(version v, size_type pos, const T &value) {
+    size_type path[std::numeric_limits<size_type>::digits];
+    bool went_left[std::numeric_limits<size_type>::digits];
+    size_type depth = 0, node = v._root;
+    for (size_type lo = 0, hi = _size; hi - lo > 1; ++depth) {
+        const size_type mid = lo + (hi - lo) / 2;
+        path[depth] = node;
+        went_left[depth] = pos < mid;
+        if (went_left[depth]) {
+            node = _nodes[node]._left;
+            hi = mid;
+        } else {
+            node = _nodes[node]._right;
+            lo = mid;
+        }
+    }
+    size_type child = _new_node(value, _null, _null);
+    while (depth-- > 0) {
+        const size_type left = went_left[depth] ? child : _nodes[path[depth]]._left;
+        const size_type right = went_left[depth] ? _nodes[path[depth]]._right : child;
+        child = _new_node(_op(_nodes[left]._value, _nodes[right]._value), left, right);
+    }
+    return version(child);
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::value_type
+persistent_segment_tree<T, Allocator, Operator>::query(version v, size_type pos) const {
+    size_type node = v._root;
+    for (size_type lo = 0, hi = _size; hi - lo > 1;) {
+        const size_type mid = lo + (hi - lo) / 2;
+        if (pos < mid) {
+            node = _nodes[node]._left;
+            hi = mid;
+        } else {
+            node = _nodes[node]._right;
+            lo = mid;
+        }
+    }
+    return _nodes[node]._value;
+}
+
+template <class T, class Allocator, class Operator>
+T persistent_segment_tree<T, Allocator, Operator>::_query(size_type node, size_type lo, size_type hi, size_type left,
+                                                          size_type right) const {
+    if (left <= lo && hi <= right) {
+        return _nodes[node]._value;
+    }
+    const size_type mid = lo + (hi - lo) / 2;
+    if (right <= mid) {
+        return _query(_nodes[node]._left, lo, mid, left, right);
+    }
+    if (mid <= left) {
+        return _query(_nodes[node]._right, mid, hi, left, right);
+    }
+    return _op(_query(_nodes[node]._left, lo, mid, left, right), _query(_nodes[node]._right, mid, hi, left, right));
+}
+
+template <class T, class Allocator, class Operator>
+typename persistent_segment_tree<T, Allocator, Operator>::value_type
+persistent_segment_tree<T, Allocator, Operator>::query(version v, size_type left, size_type right) const {
+    if (left >= right) {
+        return _op.identity();
+    }
+    return _query(v._root, 0, _size, left, right);
+} // [left, right)
+
+// mark what the kept versions reach (shared subtrees once), then rebuild the free list from the unmarked nodes
+template <class T, class Allocator, class Operator>
+void persistent_segment_tree<T, Allocator, Operator>::collect(std::span<const version> keep) {
+    vector<std::uint8_t, typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint8_t>> marked(
+        _nodes.size(), 0, _nodes.get_allocator());
+    vector<size_type, typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>> stack(
+        _nodes.get_allocator());
+    for (const version &v : keep) {
+        if (v._root != _null) {
+            stack.push_back(v._root);
+        }
+    }
+    while (!stack.empty()) {
+        const size_type node = stack.back();
+        stack.pop_back();
+        if (marked[node]) {
+            continue;
+        }
+        marked[node] = 1;
+        if (_nodes[node]._right != _null) {
+            stack.push_back(_nodes[node]._left);
+            stack.push_back(_nodes[node]._right);
+        }
+    }
+    if (_initial._root != _null && !marked[_initial._root]) {
+        _initial = version();
+    }
+    _free = _null;
+    _live = 0;
+    for (size_type node = _nodes.size(); node-- > 0;) {
+        if (marked[node]) {
+            ++_live;
+        } else {
+            _nodes[node]._left = _free;
+            _free = node;
+        }
+    }
+}
+
+template <class T, class Allocator, class Operator> void persistent_segment_tree<T, Allocator, Operator>::clear() {
+    _nodes.clear();
+    _nodes.shrink_to_fit();
+    _size = 0;
+    _free = _null;
+    _live = 0;
+    _initial = version();
+}
+} // namespace j
@@ -0,0 +1,203 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+export module j:range_fenwick_tree;
+
+import :vector;
+
+namespace j {
+// range add and range sum over two fenwick trees of the difference array d[i] = a[i] - a[i - 1]:
+// a[1] + ... + a[i] = i * (d[1] + ... + d[i]) - (d[1] * 0 + ... + d[i] * (i - 1)), so T needs +, - and *
+export template <class T, class Allocator = std::allocator<T>> class range_fenwick_tree {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    vector<T, Allocator> _tree;   // 1-based sums of d, _tree[0] is unused
+    vector<T, Allocator> _scaled; // 1-based sums of d[j] * (j - 1), _scaled[0] is unused
+    size_type _size;
+
+    void _add(vector<T, Allocator> &tree, size_type index, const T &value) {
+        for (; index <= _size; index += index & -index) {
+            tree[index] += value;
+        }
+    }
+    T _sum(const vector<T, Allocator> &tree, size_type index) const {
+        T result = T();
+        for (; index > 0; index -= index & -index) {
+            result += tree[index];
+        }
+        return result;
+    }
+    void _init_update(); // _tree holds the elements: turn them into both trees in O(n)
+
+  public:
+    range_fenwick_tree() : range_fenwick_tree(Allocator()) {}
+    explicit range_fenwick_tree(const Allocator &alloc) : range_fenwick_tree(0, alloc) {}
+    explicit range_fenwick_tree(size_type size, const Allocator &alloc = Allocator());
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    range_fenwick_tree(InputIter first, InputIter last, const Allocator &alloc = Allocator());
+    range_fenwick_tree(std::initializer_list<T> il, const Allocator &alloc = Allocator());
+
+    range_fenwick_tree(const range_fenwick_tree &other) = default;
+    range_fenwick_tree(range_fenwick_tree &&other) noexcept;
+    ~range_fenwick_tree() = default;
+    range_fenwick_tree &operator=(const range_fenwick_tree &other) = default;
+    range_fenwick_tree &operator=(range_fenwick_tree &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+
+    size_type size() const;
+    value_type query(size_type index) const;                               // [1, index]
+    value_type query(size_type left, size_type right) const;               // [left, right]
+    void update(size_type index, const value_type &value);                 // add value to one element
+    void update(size_type left, size_type right, const value_type &value); // add value to [left, right]
+    void swap(range_fenwick_tree &other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        _tree.swap(other._tree);
+        _scaled.swap(other._scaled);
+        swap(_size, other._size);
+    }
+    void clear() noexcept;
+};
+
+template <class InputIter, class Sentinel>
+range_fenwick_tree(InputIter, Sentinel) -> range_fenwick_tree<std::iter_value_t<InputIter>>;
+
+template <class T> range_fenwick_tree(std::initializer_list<T>) -> range_fenwick_tree<T>;
+
+template <class T, class Allocator>
+range_fenwick_tree<T, Allocator>::range_fenwick_tree(size_type size, const Allocator &alloc)
+    : _tree(size + 1, T(), alloc), _scaled(size + 1, T(), alloc), _size(size) {}
+
+template <class T, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+range_fenwick_tree<T, Allocator>::range_fenwick_tree(InputIter first, InputIter last, const Allocator &alloc)
+    : _tree(alloc), _scaled(alloc), _size(0) {
+    assign(first, last);
+}
+
+template <class T, class Allocator>
+range_fenwick_tree<T, Allocator>::range_fenwick_tree(std::initializer_list<T> il, const Allocator &alloc)
+    : range_fenwick_tree(il.begin(), il.end(), alloc) {}
+
+template <class T, class Allocator>
+range_fenwick_tree<T, Allocator>::range_fenwick_tree(range_fenwick_tree &&other) noexcept
+    : _tree(std::move(other._tree)), _scaled(std::move(other._scaled)), _size(std::exchange(other._size, 0)) {}
+
+template <class T, class Allocator>
+range_fenwick_tree<T, Allocator> &range_fenwick_tree<T, Allocator>::operator=(range_fenwick_tree &&other) noexcept {
+    if (this != &other) {
+        _tree = std::move(other._tree);
+        _scaled = std::move(other._scaled);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+template <class T, class Allocator>
+typename range_fenwick_tree<T, Allocator>::allocator_type
+range_fenwick_tree<T, Allocator>::get_allocator() const noexcept {
+    return _tree.get_allocator();
+}
+
+// differences from the back so every element is still read before it is overwritten, then one pass per tree
+// adds each node to its parent once
+template <class T, class Allocator> void range_fenwick_tree<T, Allocator>::_init_update() {
+    for (size_type i = _size; i > 1; --i) {
+        _tree[i] -= _tree[i - 1];
+    }
+    _scaled.assign(_size + 1, T());
+    for (size_type i = 1; i <= _size; ++i) {
+        _scaled[i] = _tree[i] * static_cast<T>(i - 1);
+    }
+    for (size_type i = 1; i <= _size; ++i) {
+        const size_type parent = i + (i & -i);
+        if (parent <= _size) {
+            _tree[parent] += _tree[i];
+            _scaled[parent] += _scaled[i];
+        }
+    }
+}
+
+template <class T, class Allocator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void range_fenwick_tree<T, Allocator>::assign(InputIter first, InputIter last) {
+    _tree.clear();
+    if constexpr (std::forward_iterator<InputIter>) {
+        _tree.reserve(static_cast<size_type>(std::distance(first, last)) + 1);
+    }
+    _tree.push_back(T());
+    for (; first != last; ++first) {
+        _tree.push_back(*first);
+    }
+    _size = _tree.size() - 1;
+    _init_update();
+}
+
+template <class T, class Allocator> void range_fenwick_tree<T, Allocator>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
+
+template <class T, class Allocator>
+typename range_fenwick_tree<T, Allocator>::size_type range_fenwick_tree<T, Allocator>::size() const {
+    return _size;
+}
+
+template <class T, class Allocator>
+typename range_fenwick_tree<T, Allocator>::value_type range_fenwick_tree<T, Allocator>::query(size_type index) const {
+    return _sum(_tree, index) * static_cast<T>(index) - _sum(_scaled, index);
+}
+
+template <class T, class Allocator>
+typename range_fenwick_tree<T, Allocator>::value_type
+range_fenwick_tree<T, Allocator>::query(size_type left, size_type right) const {
+    return query(right) - query(left - 1);
+}
+
+template <class T, class Allocator>
+void range_fenwick_tree<T, Allocator>::update(size_type index, const value_type &value) {
+    update(index, index, value);
+}
+
+// d[left] += value and d[right + 1] -= value
+template <class T, class Allocator>
+void range_fenwick_tree<T, Allocator>::update(size_type left, size_type right, const value_type &value) {
+    _add(_tree, left, value);
+    _add(_tree, right + 1, -value);
+    _add(_scaled, left, value * static_cast<T>(left - 1));
+    _add(_scaled, right + 1, -value * static_cast<T>(right));
+}
+
+template <class T, class Allocator> void range_fenwick_tree<T, Allocator>::clear() noexcept {
+    std::fill(_tree.begin(), _tree.end(), T());
+    std::fill(_scaled.begin(), _scaled.end(), T());
+}
+} // namespace j
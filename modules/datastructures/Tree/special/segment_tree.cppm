@@ -1,335 +1,740 @@
 /*
  * @ Created by jaehyung409 on 25. 1. 29.
  * @ Copyright (c) 2025 jaehyung409 All rights reserved.
- * This software is licensed under the MIT License. 
+ * This software is licensed under the MIT License.
  */
 
 module;
-#include <span>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
-export module j.segment_tree;
+export module j:segment_tree;
 
-import j.basics;
+import :basics;
+import :parallel;
+import :sort_algo;
+import :vector;
 
 namespace j {
-    export template<class T,
-                    class Allocator = std::allocator<T>,
-                    class Operator = plus<T>> // operator (monoid)
-    class segment_tree {
-    public:
-        using value_type = T;
-        using size_type = std::size_t;
-        using reference = T&;
-        using const_reference = const T&;
-        using pointer = T*;
-        using const_pointer = const T*;
-        using allocator_type = Allocator;
-
-    private:
-        size_type _size;            // size of elements
-        size_type _array_size;      // size of segment tree array
-        value_type _identity;       // identity element
-        allocator_type _alloc;
-        Operator _op;
-        pointer _tree;
-        bool _is_built = false;     // built flag
-
-        size_type _resize(size_type size);
-
-    public:
-        segment_tree() : segment_tree(0, Operator()) {}
-        explicit segment_tree(size_type size) : segment_tree(size, Operator()) {}
-        explicit segment_tree(size_type size, const Operator &op) : segment_tree(size, op, Allocator()) {}
-        segment_tree(size_type size, const Operator &op, const Allocator &alloc);
-        template <class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        segment_tree(InputIter first, InputIter last,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        template <class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        segment_tree(InputIter first, InputIter last, size_type size_hint,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        //template <container-compatible-range<T> R>
-        //segment_tree(from_range_t, R&& range, const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        segment_tree(const segment_tree &other);
-        segment_tree(segment_tree &&other);
-        segment_tree(const segment_tree &other, const std::type_identity_t<Allocator> &alloc);
-        segment_tree(segment_tree &&other, const std::type_identity_t<Allocator> &alloc);
-        segment_tree(std::initializer_list<T> il,
-                     const Operator &op = Operator(), const Allocator &alloc = Allocator());
-        ~segment_tree();
-        segment_tree &operator=(const segment_tree &other);
-        segment_tree &operator=(segment_tree &&other) noexcept(
-                std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
-                std::allocator_traits<Allocator>::is_always_equal::value);
-        segment_tree &operator=(std::initializer_list<T> il);
-        allocator_type get_allocator() const noexcept;
-
-        template<class InputIter>
-        requires (!std::is_integral_v<InputIter>)
-        void assign(InputIter first, InputIter last);
-        //template<container-compatible-range<T> R>
-        //void assign_range(R&& rg);
-        void assign(std::initializer_list<T> il);
-
-        bool empty() const;
-        size_type size() const; // return the number of elements
-        size_type tree_size() const; // return the size of the segment tree (real memory size)
-        size_type resize(size_type size);
-
-        void build();
-        bool is_built() const;
-        void update(size_type pos, const T &value);
-
-        size_type query(size_type pos);
-        size_type query(size_type left, size_type right);
-        std::span<const T> data() const;
-        void swap(segment_tree& x) noexcept(
-            std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
-            std::allocator_traits<Allocator>::is_always_equal::value) {
-            using std::swap;
-            swap(_size, x._size);
-            swap(_array_size, x._array_size);
-            swap(_identity, x._identity);
-            swap(_alloc, x._alloc);
-            swap(_op, x._op);
-            swap(_tree, x._tree);
-            swap(_is_built, x._is_built);
+// node layouts for segment_tree
+export struct segment_tree_binary {}; // bottom-up 2n array: leaves at [size, 2 * size), node i aggregates 2i, 2i + 1
+export template <std::size_t B = 0>
+struct segment_tree_wide {}; // B-ary levels stored leaves first; the B children of a node sit side by side, so a
+                             // query touches one block per level. B = 0 picks one cache line of elements
+
+template <class Layout, class T> struct _segment_tree_arity : std::integral_constant<std::size_t, 2> {};
+template <std::size_t B, class T>
+struct _segment_tree_arity<segment_tree_wide<B>, T>
+    : std::integral_constant<std::size_t, B != 0 ? B : std::max<std::size_t>(2, 64 / sizeof(T))> {};
+
+// unsigned integer with the object representation of T, used to select lanes without branches
+template <class T>
+using _segment_tree_bits =
+    std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                          std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+#if defined(__AVX2__)
+// 32-bit values, eight to an AVX2 register; every operation works on the integer view of the register
+template <class T, class Operator>
+inline constexpr bool _avx2_node_reducible =
+    (std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t> || std::is_same_v<T, float>) &&
+    (std::is_same_v<Operator, plus<T>> || std::is_same_v<Operator, max<T>>);
+
+template <class T, class Operator> __m256i _avx2_node_combine(__m256i a, __m256i b) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+        const __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+        if constexpr (std::is_same_v<Operator, plus<T>>) {
+            return _mm256_castps_si256(_mm256_add_ps(x, y));
+        } else {
+            return _mm256_castps_si256(_mm256_max_ps(x, y));
         }
-        void clear();
-    };
+    } else if constexpr (std::is_same_v<Operator, plus<T>>) {
+        return _mm256_add_epi32(a, b);
+    } else if constexpr (std::is_same_v<T, std::int32_t>) {
+        return _mm256_max_epi32(a, b);
+    } else {
+        return _mm256_max_epu32(a, b);
+    }
 }
 
-namespace j {
+// block[from, to) of a node of Arity (a multiple of 8) values: lanes outside the range load the identity
+template <class T, class Operator, std::size_t Arity>
+T _avx2_node_reduce(const T *block, std::size_t from, std::size_t to, T identity) noexcept {
+    const __m256i fill = _mm256_set1_epi32(std::bit_cast<std::int32_t>(identity));
+    const __m256i lo = _mm256_set1_epi32(static_cast<int>(from)), hi = _mm256_set1_epi32(static_cast<int>(to));
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i result = fill;
+    for (std::size_t i = 0; i < Arity; i += 8, index = _mm256_add_epi32(index, _mm256_set1_epi32(8))) {
+        const __m256i inside = _mm256_andnot_si256(_mm256_cmpgt_epi32(lo, index), _mm256_cmpgt_epi32(hi, index));
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + i));
+        result = _avx2_node_combine<T, Operator>(result, _mm256_blendv_epi8(fill, values, inside));
+    }
+    // fold the register onto its first lane: halves, then pairs of pairs, then pairs
+    result = _avx2_node_combine<T, Operator>(result, _mm256_permute2x128_si256(result, result, 1));
+    result = _avx2_node_combine<T, Operator>(result, _mm256_shuffle_epi32(result, 0x4E));
+    result = _avx2_node_combine<T, Operator>(result, _mm256_shuffle_epi32(result, 0xB1));
+    return std::bit_cast<T>(_mm256_cvtsi256_si32(result));
+}
+#endif
+
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = plus<T>,           // operator (monoid)
+                 class Layout = segment_tree_binary> // node layout
+class segment_tree {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    static constexpr bool _wide = !std::is_same_v<Layout, segment_tree_binary>;
+    static constexpr size_type _arity = _segment_tree_arity<Layout, T>::value;
+    // plus and max over arithmetic types are cheap enough to reduce a whole node under a mask
+    static constexpr bool _simd = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8 &&
+                                  (std::is_same_v<Operator, plus<T>> || std::is_same_v<Operator, max<T>>);
+    struct _binary_state {};
+    struct _wide_state {
+        size_type _levels = 0;
+        size_type _offset[std::numeric_limits<size_type>::digits + 1] = {}; // start of each level, leaves first
+    };
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(segment_tree::size_type size, const Operator &op,
-                                                       const Allocator &alloc)
-    : _size(size), _array_size(size << 1), _identity(op.identity()), _alloc(alloc), _op(op) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        for (size_type i = 1; i < _array_size; ++i) {
-            std::construct_at(std::addressof(_tree[i]), _identity);
+    size_type _size;            // size of elements
+    Operator _op;
+    vector<T, Allocator> _tree; // binary: 2 * _size nodes, _tree[0] is unused; wide: the levels, each padded to B
+    [[no_unique_address]] std::conditional_t<_wide, _wide_state, _binary_state> _state;
+    bool _is_built = false; // built flag
+
+    void _reset(size_type size);
+    template <class InputIter, class Policy>
+    void _assign_leaves(InputIter first, InputIter last, size_type size, const Policy &policy);
+    size_type _leaf(size_type pos) const {
+        if constexpr (_wide) {
+            return _state._offset[0] + pos;
+        } else {
+            return _size + pos;
         }
-        _is_built = false;
     }
-
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    segment_tree<T, Allocator, Operator>::segment_tree(InputIter first, InputIter last, const Operator &op,
-                                                       const Allocator &alloc)
-    : segment_tree(first, last, std::distance(first, last), op, alloc) {}
-
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    segment_tree<T, Allocator, Operator>::segment_tree(InputIter first, InputIter last,
-                                                       segment_tree::size_type size_hint, const Operator &op,
-                                                       const Allocator &alloc)
-    : _size(size_hint), _array_size(_size << 1), _identity(op.identity()),
-      _alloc(alloc), _op(op) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        std::uninitialized_copy(first, last, _tree + _size);
-        build();
+    T _masked(const T &value, bool keep) const; // value if keep, else the identity, without a branch (_simd only)
+    T _block_reduce(const T *block, size_type from, size_type to) const; // block[from, to) of one wide node
+
+    // a bottom-up query in flight: the range still to fold on the current level
+    struct _query_cursor {
+        size_type _left;
+        size_type _right;
+        size_type _level = 0;
+    };
+    _query_cursor _begin_query(size_type left, size_type right) const;
+    bool _query_step(_query_cursor &cursor, T &prefix, T &suffix) const; // one level; false once folded
+
+  public:
+    segment_tree() : segment_tree(0, Operator()) {}
+    explicit segment_tree(size_type size) : segment_tree(size, Operator()) {}
+    explicit segment_tree(size_type size, const Operator &op) : segment_tree(size, op, Allocator()) {}
+    segment_tree(size_type size, const Operator &op, const Allocator &alloc);
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    segment_tree(InputIter first, InputIter last, const Operator &op = Operator(),
+                 const Allocator &alloc = Allocator());
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    segment_tree(InputIter first, InputIter last, size_type size_hint, const Operator &op = Operator(),
+                 const Allocator &alloc = Allocator());
+    segment_tree(const segment_tree &other) = default;
+    segment_tree(segment_tree &&other) noexcept;
+    segment_tree(const segment_tree &other, const std::type_identity_t<Allocator> &alloc);
+    segment_tree(segment_tree &&other, const std::type_identity_t<Allocator> &alloc);
+    segment_tree(std::initializer_list<T> il, const Operator &op = Operator(), const Allocator &alloc = Allocator());
+    ~segment_tree() = default;
+    segment_tree &operator=(const segment_tree &other) = default;
+    segment_tree &operator=(segment_tree &&other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value);
+    segment_tree &operator=(std::initializer_list<T> il);
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+    template <execution_policy Policy, class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(Policy &&policy, InputIter first, InputIter last); // builds with build(policy)
+
+    bool empty() const;
+    size_type size() const;      // return the number of elements
+    size_type tree_size() const; // return the size of the segment tree (real memory size)
+    size_type resize(size_type size);
+
+    void build();
+    template <execution_policy Policy> void build(Policy &&policy); // level by level, each level split under par
+    bool is_built() const;
+    void update(size_type pos, const T &value);
+    // sets every leaf first (the last value wins for a repeated position), then recomputes each shared ancestor once
+    void update_many(std::span<const std::pair<size_type, T>> updates);
+
+    value_type query(size_type pos);
+    value_type query(size_type left, size_type right); // [left, right)
+    vector<T, Allocator> query_many(std::span<const std::pair<size_type, size_type>> ranges) const; // [first, second)
+    // binary search on the aggregates: pred must hold for the identity and stay false once it turns false
+    template <class Predicate> size_type max_right(size_type left, Predicate pred) const; // largest r: pred([left, r))
+    template <class Predicate> size_type min_left(size_type right, Predicate pred) const; // least l: pred([l, right))
+    std::span<const T> data() const;
+    void swap(segment_tree &x) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+                                        std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_size, x._size);
+        swap(_op, x._op);
+        _tree.swap(x._tree);
+        swap(_state, x._state);
+        swap(_is_built, x._is_built);
     }
+    void clear();
+};
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(const segment_tree &other)
-    : segment_tree(other, other.get_allocator()) {}
-
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(segment_tree &&other)
-    : segment_tree(std::move(other), std::move(other.get_allocator())) {
-        other._tree = nullptr;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(size_type size, const Operator &op, const Allocator &alloc)
+    : _size(0), _op(op), _tree(alloc) {
+    _reset(size);
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(const segment_tree &other,
-                                                       const std::type_identity_t <Allocator> &alloc)
-    : _size(other._size), _array_size(other._array_size), _alloc(alloc), _is_built(other._is_built) {
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        std::uninitialized_copy(other._tree, other._tree + _array_size, _tree);
-    }
+template <class T, class Allocator, class Operator, class Layout>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(InputIter first, InputIter last, const Operator &op,
+                                                           const Allocator &alloc)
+    : _size(0), _op(op), _tree(alloc) {
+    assign(first, last);
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(segment_tree &&other,
-                                                       const std::type_identity_t <Allocator> &alloc)
-    : _size(other._size), _array_size(other._array_size), _alloc(alloc), _is_built(other._is_built) {
-        _tree = other._tree;
-        other._tree = nullptr;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(InputIter first, InputIter last, size_type size_hint,
+                                                           const Operator &op, const Allocator &alloc)
+    : _size(0), _op(op), _tree(alloc) {
+    _assign_leaves(first, last, size_hint, execution::seq);
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::segment_tree(std::initializer_list<T> il, const Operator &op,
-                                                       const Allocator &alloc)
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(segment_tree &&other) noexcept
+    : _size(std::exchange(other._size, 0)), _op(std::move(other._op)), _tree(std::move(other._tree)),
+      _state(std::exchange(other._state, {})), _is_built(std::exchange(other._is_built, false)) {}
+
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(const segment_tree &other,
+                                                           const std::type_identity_t<Allocator> &alloc)
+    : _size(other._size), _op(other._op), _tree(other._tree, alloc), _state(other._state),
+      _is_built(other._is_built) {}
+
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(segment_tree &&other,
+                                                           const std::type_identity_t<Allocator> &alloc)
+    : _size(std::exchange(other._size, 0)), _op(std::move(other._op)), _tree(std::move(other._tree), alloc),
+      _state(std::exchange(other._state, {})), _is_built(std::exchange(other._is_built, false)) {}
+
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout>::segment_tree(std::initializer_list<T> il, const Operator &op,
+                                                           const Allocator &alloc)
     : segment_tree(il.begin(), il.end(), op, alloc) {}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator>::~segment_tree() {
-        clear();
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout> &
+segment_tree<T, Allocator, Operator, Layout>::operator=(segment_tree &&other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+    if (this != &other) {
+        _size = std::exchange(other._size, 0);
+        _op = std::move(other._op);
+        _tree = std::move(other._tree);
+        _state = std::exchange(other._state, {});
+        _is_built = std::exchange(other._is_built, false);
     }
+    return *this;
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator> &segment_tree<T, Allocator, Operator>::operator=(const segment_tree &other) {
-        if (this != &other) {
-            _size = other._size;
-            _array_size = other._array_size;
-            _identity = other._identity;
-            resize(_size);
-            _alloc = other._alloc;
-            _is_built = other._is_built;
-            std::uninitialized_copy(other._tree, other._tree + _array_size, _tree);
-        }
-        return *this;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+segment_tree<T, Allocator, Operator, Layout> &
+segment_tree<T, Allocator, Operator, Layout>::operator=(std::initializer_list<T> il) {
+    assign(il);
+    return *this;
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::allocator_type
+segment_tree<T, Allocator, Operator, Layout>::get_allocator() const noexcept {
+    return _tree.get_allocator();
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator> &segment_tree<T, Allocator, Operator>::operator=(segment_tree &&other)
-    noexcept (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
-              std::allocator_traits<Allocator>::is_always_equal::value) {
-        if (this != &other) {
-            clear();
-            std::allocator_traits<Allocator>::deallocate(_alloc, _tree, _array_size);
-            _size = other._size;
-            _array_size = other._array_size;
-            _alloc = std::move(other._alloc);
-            _is_built = other._is_built;
-            _tree = other._tree;
-            other.clear();
+// every node is reset to the identity
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::_reset(size_type size) {
+    _size = size;
+    _is_built = false;
+    if constexpr (_wide) {
+        _state = {};
+        size_type total = 0;
+        for (size_type count = std::max<size_type>(_size, 1);; count = (count + _arity - 1) / _arity) {
+            _state._offset[_state._levels++] = total;
+            total += (count + _arity - 1) / _arity * _arity;
+            if (count == 1) {
+                break;
+            }
+        }
+        // slack to start the leaves on a cache line; a copy keeps the offsets and may lose the alignment
+        constexpr size_type line = 64 % sizeof(T) == 0 ? 64 / sizeof(T) : 0;
+        _tree.assign(total + line, _op.identity());
+        const auto address = reinterpret_cast<std::uintptr_t>(_tree.data());
+        if (line != 0 && address % sizeof(T) == 0) {
+            const size_type pad = (64 - address % 64) % 64 / sizeof(T);
+            for (size_type level = 0; level < _state._levels; ++level) {
+                _state._offset[level] += pad;
+            }
         }
-        return *this;
+    } else {
+        _tree.assign(_size << 1, _op.identity());
     }
+}
 
-    template<class T, class Allocator, class Operator>
-    segment_tree<T, Allocator, Operator> &segment_tree<T, Allocator, Operator>::operator=(std::initializer_list<T> il) {
-        assign(il);
-        return *this;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+template <class InputIter, class Policy>
+void segment_tree<T, Allocator, Operator, Layout>::_assign_leaves(InputIter first, InputIter last, size_type size,
+                                                                  const Policy &policy) {
+    _reset(size);
+    std::copy_n(first, _size, _tree.begin() + static_cast<std::ptrdiff_t>(_leaf(0)));
+    build(policy);
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::allocator_type segment_tree<T, Allocator, Operator>::get_allocator() const noexcept {
-        return _alloc;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void segment_tree<T, Allocator, Operator, Layout>::assign(InputIter first, InputIter last) {
+    assign(execution::seq, first, last);
+}
 
-    template<class T, class Allocator, class Operator>
-    template<class InputIter>
-    requires (!std::is_integral_v<InputIter>)
-    void segment_tree<T, Allocator, Operator>::assign(InputIter first, InputIter last) {
-        if (_tree == nullptr) {
-            _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-            _size = std::distance(first, last);
-            _array_size = _size << 1;
-        } else {
-            _resize(std::distance(first, last));
-        }
-        std::uninitialized_copy(first, last, _tree + _size);
-        build();
-    }
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
 
-    template<class T, class Allocator, class Operator>
-    void segment_tree<T, Allocator, Operator>::assign(std::initializer_list<T> il) {
-        assign(il.begin(), il.end());
+template <class T, class Allocator, class Operator, class Layout>
+template <execution_policy Policy, class InputIter>
+    requires std::input_iterator<InputIter>
+void segment_tree<T, Allocator, Operator, Layout>::assign(Policy &&policy, InputIter first, InputIter last) {
+    if constexpr (std::forward_iterator<InputIter>) {
+        _assign_leaves(first, last, static_cast<size_type>(std::distance(first, last)), policy);
+    } else {
+        // single pass: collect the elements to learn their number
+        vector<T, Allocator> leaves(first, last, _tree.get_allocator());
+        _assign_leaves(leaves.begin(), leaves.end(), leaves.size(), policy);
     }
+}
 
-    template<class T, class Allocator, class Operator>
-    bool segment_tree<T, Allocator, Operator>::empty() const {
-        return _size == 0;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+bool segment_tree<T, Allocator, Operator, Layout>::empty() const {
+    return _size == 0;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type segment_tree<T, Allocator, Operator>::size() const {
-        return _size;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::size_type
+segment_tree<T, Allocator, Operator, Layout>::size() const {
+    return _size;
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::size_type
+segment_tree<T, Allocator, Operator, Layout>::tree_size() const {
+    return _tree.size();
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type segment_tree<T, Allocator, Operator>::tree_size() const {
-        return _array_size;
+// a new size discards the elements: every node is reset to the identity
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::size_type
+segment_tree<T, Allocator, Operator, Layout>::resize(size_type size) {
+    if (size != _size) {
+        _reset(size);
     }
+    return _size;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type
-    segment_tree<T, Allocator, Operator>::resize(segment_tree::size_type size) {
-        const size_type ret = _resize(size);
-        if (ret != _size) {
-            for (size_type i = 1; i < _array_size; ++i) {
-                std::construct_at(std::addressof(_tree[i]), _identity);
-            }
+template <class T, class Allocator, class Operator, class Layout>
+T segment_tree<T, Allocator, Operator, Layout>::_masked(const T &value, bool keep) const {
+    using bits = _segment_tree_bits<T>;
+    const bits mask = static_cast<bits>(bits(0) - bits(keep));
+    return std::bit_cast<T>(
+        static_cast<bits>((std::bit_cast<bits>(value) & mask) | (std::bit_cast<bits>(_op.identity()) & ~mask)));
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+T segment_tree<T, Allocator, Operator, Layout>::_block_reduce(const T *block, size_type from, size_type to) const {
+#if defined(__AVX2__)
+    if constexpr (_avx2_node_reducible<T, Operator> && _arity % 8 == 0) {
+        return _avx2_node_reduce<T, Operator, _arity>(block, from, to, _op.identity());
+    } else
+#endif
+    if constexpr (_simd) {
+        // masked over the whole node: lanes outside [from, to) take the identity, so the fixed trip count runs
+        // without branches
+        T lanes[_arity];
+        for (size_type i = 0; i < _arity; ++i) {
+            lanes[i] = _masked(block[i], i >= from && i < to);
         }
-        return ret;
+        T result = _op.identity();
+        for (size_type i = 0; i < _arity; ++i) {
+            result = _op(result, lanes[i]);
+        }
+        return result;
+    } else {
+        T result = _op.identity();
+        for (; from < to; ++from) {
+            result = _op(result, block[from]);
+        }
+        return result;
     }
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::build() {
+    build(execution::seq);
+}
 
-    template<class T, class Allocator, class Operator>
-    void segment_tree<T, Allocator, Operator>::build() {
-        for (size_type i = _size - 1; i > 0; --i) {
-            _tree[i] = _op(_tree[i << 1], _tree[i << 1 | 1]);
+// the nodes of one level only read the level below, so each level may be split across threads
+template <class T, class Allocator, class Operator, class Layout>
+template <execution_policy Policy>
+void segment_tree<T, Allocator, Operator, Layout>::build(Policy &&policy) {
+    if constexpr (_wide) {
+        size_type count = std::max<size_type>(_size, 1);
+        for (size_type level = 1; level < _state._levels; ++level) {
+            const T *children = _tree.data() + _state._offset[level - 1];
+            T *nodes = _tree.data() + _state._offset[level];
+            count = (count + _arity - 1) / _arity;
+            _for_indices(policy, 0, count,
+                         [&](size_type i) { nodes[i] = _block_reduce(children + i * _arity, 0, _arity); });
+        }
+    } else if (_size > 1) {
+        // level l holds the internal nodes [2^l, 2^(l + 1)) below _size; the deepest one first
+        for (size_type level = static_cast<size_type>(std::bit_width(_size - 1)); level-- > 0;) {
+            _for_indices(policy, size_type{1} << level, std::min(size_type{2} << level, _size),
+                         [&](size_type i) { _tree[i] = _op(_tree[i << 1], _tree[i << 1 | 1]); });
         }
-        _is_built = true;
     }
+    _is_built = true;
+}
 
-    template<class T, class Allocator, class Operator>
-    bool segment_tree<T, Allocator, Operator>::is_built() const {
-        return _is_built;
-    }
+template <class T, class Allocator, class Operator, class Layout>
+bool segment_tree<T, Allocator, Operator, Layout>::is_built() const {
+    return _is_built;
+}
 
-    template<class T, class Allocator, class Operator>
-    void segment_tree<T, Allocator, Operator>::update(segment_tree::size_type pos, const T &value) {
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::update(size_type pos, const T &value) {
+    if constexpr (_wide) {
+        _tree[_leaf(pos)] = value;
+        for (size_type level = 1; level < _state._levels; ++level) {
+            const T *children = _tree.data() + _state._offset[level - 1] + pos / _arity * _arity;
+            pos /= _arity;
+            _tree[_state._offset[level] + pos] = _block_reduce(children, 0, _arity);
+        }
+    } else {
         for (_tree[pos += _size] = value; pos > 1; pos >>= 1) {
-            _tree[pos >> 1] = _op(_tree[pos], _tree[pos ^ 1]);
+            _tree[pos >> 1] = _op(_tree[pos & ~size_type(1)], _tree[pos | 1]);
         }
     }
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type
-    segment_tree<T, Allocator, Operator>::query(segment_tree::size_type pos) {
-        return _tree[pos + _size];
+// the touched nodes of a level stay sorted when mapped to their parents, so dropping adjacent repeats leaves every
+// ancestor once per level: O(k log(n / k)) node updates for k spread positions instead of O(k log n)
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::update_many(std::span<const std::pair<size_type, T>> updates) {
+    if (updates.size() * static_cast<size_type>(std::bit_width(updates.size())) >= _size) {
+        // sorting a batch this large relative to the tree costs more than rebuilding every node
+        for (const auto &[pos, value] : updates) {
+            _tree[_leaf(pos)] = value;
+        }
+        build();
+        return;
     }
-
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type
-    segment_tree<T, Allocator, Operator>::query(segment_tree::size_type left, segment_tree::size_type right) {
-        size_type result = _identity;
-        for (left += _size, right += _size; left < right; left >>= 1, right >>= 1) {
-            if (left & 1) {
-                result = _op(result, _tree[left++]);
+    vector<size_type> nodes; // the touched nodes of the current level, ascending
+    nodes.reserve(updates.size());
+    for (const auto &[pos, value] : updates) {
+        _tree[_leaf(pos)] = value; // in the given order, so the last value wins
+        nodes.push_back(pos);
+    }
+    std::identity key;
+    _radix_sort<8>(nodes.begin(), nodes.end(), key);
+    auto climb = [&nodes](size_type divisor) {
+        size_type count = 0;
+        for (const size_type node : nodes) {
+            if (count == 0 || nodes[count - 1] != node / divisor) {
+                nodes[count++] = node / divisor;
             }
-            if (right & 1) {
-                result = _op(result, _tree[--right]);
+        }
+        nodes.erase(nodes.begin() + static_cast<std::ptrdiff_t>(count), nodes.end());
+    };
+    climb(1);
+    if constexpr (_wide) {
+        for (size_type level = 1; level < _state._levels && !nodes.empty(); ++level) {
+            climb(_arity);
+            const T *children = _tree.data() + _state._offset[level - 1];
+            for (const size_type node : nodes) {
+                _tree[_state._offset[level] + node] = _block_reduce(children + node * _arity, 0, _arity);
             }
         }
-        return result;
-    } // [left, right)
+    } else {
+        // leaves of a size that is not a power of two sit on two depths: a node reached early from the shallow side
+        // is computed again once the deeper side arrives, and the last computation sees its children up to date
+        for (size_type &node : nodes) {
+            node += _size;
+        }
+        while (!nodes.empty() && nodes.back() > 1) {
+            climb(2);
+            if (nodes.front() == 0) {
+                nodes.erase(nodes.begin());
+            }
+            for (const size_type node : nodes) {
+                _tree[node] = _op(_tree[node << 1], _tree[node << 1 | 1]);
+            }
+        }
+    }
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::value_type
+segment_tree<T, Allocator, Operator, Layout>::query(size_type pos) {
+    return _tree[_leaf(pos)];
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::_query_cursor
+segment_tree<T, Allocator, Operator, Layout>::_begin_query(size_type left, size_type right) const {
+    if constexpr (_wide) {
+        return {left, right};
+    } else {
+        return {left + _size, right + _size};
+    }
+}
 
-    template<class T, class Allocator, class Operator>
-    std::span<const T> segment_tree<T, Allocator, Operator>::data() const {
-        return std::span<const T>(_tree + _size, _size);
+// the prefix folds nodes from the left end and the suffix from the right end, so the operator needs no commutativity
+template <class T, class Allocator, class Operator, class Layout>
+bool segment_tree<T, Allocator, Operator, Layout>::_query_step(_query_cursor &cursor, T &prefix, T &suffix) const {
+    auto &[left, right, level] = cursor;
+    if (left >= right) {
+        return false;
+    }
+    if constexpr (_wide) {
+        // fold the partial nodes at both ends, then step up to the whole nodes between them
+        const T *nodes = _tree.data() + _state._offset[level++];
+        const size_type left_bound = (left + _arity - 1) / _arity * _arity;
+        const size_type right_bound = right / _arity * _arity;
+        if (left_bound > right_bound) { // both ends inside one node
+            prefix = _op(prefix, _block_reduce(nodes + right_bound, left - right_bound, right - right_bound));
+            left = right;
+            return false;
+        }
+        if (left != left_bound) {
+            prefix = _op(prefix, _block_reduce(nodes + left_bound - _arity, left + _arity - left_bound, _arity));
+        }
+        if (right != right_bound) {
+            suffix = _op(_block_reduce(nodes + right_bound, 0, right - right_bound), suffix);
+        }
+        left = left_bound / _arity;
+        right = right_bound / _arity;
+    } else if constexpr (_simd) {
+        // both ends are read every level and masked, so the loop has no data-dependent branches;
+        // left < right keeps both reads inside the tree
+        const bool take_left = (left & 1) != 0, take_right = (right & 1) != 0;
+        prefix = _op(prefix, _masked(_tree[left], take_left));
+        suffix = _op(_masked(_tree[right - 1], take_right), suffix);
+        left = (left + take_left) >> 1;
+        right = (right - take_right) >> 1;
+    } else {
+        if (left & 1) {
+            prefix = _op(prefix, _tree[left++]);
+        }
+        if (right & 1) {
+            suffix = _op(_tree[--right], suffix);
+        }
+        left >>= 1;
+        right >>= 1;
     }
+    return left < right;
+}
 
-    template<class T, class Allocator, class Operator>
-    void segment_tree<T, Allocator, Operator>::clear() {
-        for (size_type i = 0; i < _array_size; ++i) {
-            std::destroy_at(std::addressof(_tree[i]));
+template <class T, class Allocator, class Operator, class Layout>
+typename segment_tree<T, Allocator, Operator, Layout>::value_type
+segment_tree<T, Allocator, Operator, Layout>::query(size_type left, size_type right) {
+    _query_cursor cursor = _begin_query(left, right);
+    T prefix = _op.identity(), suffix = _op.identity();
+    while (_query_step(cursor, prefix, suffix)) {
+    }
+    return _op(prefix, suffix);
+} // [left, right)
+
+// queries advance level by level in groups: the loads of independent queries are in flight together
+template <class T, class Allocator, class Operator, class Layout>
+vector<T, Allocator> segment_tree<T, Allocator, Operator, Layout>::query_many(
+    std::span<const std::pair<size_type, size_type>> ranges) const {
+    constexpr size_type group = 8;
+    vector<T, Allocator> results(ranges.size(), _op.identity(), _tree.get_allocator());
+    vector<T, Allocator> suffixes(group, _op.identity(), _tree.get_allocator());
+    _query_cursor cursors[group];
+    for (size_type first = 0; first < ranges.size(); first += group) {
+        const size_type count = std::min(group, ranges.size() - first);
+        for (size_type i = 0; i < count; ++i) {
+            cursors[i] = _begin_query(ranges[first + i].first, ranges[first + i].second);
+            suffixes[i] = _op.identity();
+        }
+        for (bool active = true; active;) {
+            active = false;
+            for (size_type i = 0; i < count; ++i) {
+                active |= _query_step(cursors[i], results[first + i], suffixes[i]);
+            }
+        }
+        for (size_type i = 0; i < count; ++i) {
+            results[first + i] = _op(results[first + i], suffixes[i]);
         }
-        std::allocator_traits<Allocator>::deallocate(_alloc, _tree, _array_size);
-        _size = 0;
-        _array_size = 0;
-        _identity = Operator().identity();
-        _tree = nullptr;
-        _is_built = false;
     }
+    return results;
+}
 
-    template<class T, class Allocator, class Operator>
-    typename segment_tree<T, Allocator, Operator>::size_type
-    segment_tree<T, Allocator, Operator>::_resize(size_type size) {
-        if (size == _size) {
-            return _size;
+// the nodes of [left, size) are visited left to right; the first one that fails pred holds the answer, found by
+// descending into it
+template <class T, class Allocator, class Operator, class Layout>
+template <class Predicate>
+typename segment_tree<T, Allocator, Operator, Layout>::size_type
+segment_tree<T, Allocator, Operator, Layout>::max_right(size_type left, Predicate pred) const {
+    T prefix = _op.identity();
+    if constexpr (_wide) {
+        size_type level = 0, pos = left;
+        for (size_type count = _size; pos < count; ++level, count = (count + _arity - 1) / _arity) {
+            const T *nodes = _tree.data() + _state._offset[level];
+            const size_type end = pos / _arity * _arity + _arity;
+            for (; pos < end; ++pos) {
+                if (!pred(_op(prefix, nodes[pos]))) {
+                    for (; level > 0; --level) { // the children of a failing node hold the first failing child
+                        nodes = _tree.data() + _state._offset[level - 1];
+                        for (pos *= _arity; pred(_op(prefix, nodes[pos])); ++pos) {
+                            prefix = _op(prefix, nodes[pos]);
+                        }
+                    }
+                    return pos;
+                }
+                prefix = _op(prefix, nodes[pos]);
+            }
+            pos /= _arity;
+        }
+        return _size;
+    } else {
+        size_type nodes[2 * std::numeric_limits<size_type>::digits], count = 0, right_count = 0;
+        for (size_type L = left + _size, R = _size << 1; L < R; L >>= 1, R >>= 1) {
+            if (L & 1) {
+                nodes[count++] = L++;
+            }
+            if (R & 1) {
+                nodes[std::size(nodes) - ++right_count] = --R;
+            }
+        }
+        std::copy(std::end(nodes) - right_count, std::end(nodes), nodes + count);
+        count += right_count;
+        for (size_type i = 0; i < count; ++i) {
+            size_type node = nodes[i];
+            if (!pred(_op(prefix, _tree[node]))) {
+                while (node < _size) {
+                    node <<= 1;
+                    if (pred(_op(prefix, _tree[node]))) {
+                        prefix = _op(prefix, _tree[node++]);
+                    }
+                }
+                return node - _size;
+            }
+            prefix = _op(prefix, _tree[node]);
         }
-        clear();
-        _size = size;
-        _array_size = _size << 1;
-        _tree = std::allocator_traits<Allocator>::allocate(_alloc, _array_size);
-        _is_built = false;
         return _size;
     }
-}
\ No newline at end of file
+}
+
+// mirror of max_right: the nodes of [0, right) are visited right to left
+template <class T, class Allocator, class Operator, class Layout>
+template <class Predicate>
+typename segment_tree<T, Allocator, Operator, Layout>::size_type
+segment_tree<T, Allocator, Operator, Layout>::min_left(size_type right, Predicate pred) const {
+    T suffix = _op.identity();
+    if constexpr (_wide) {
+        for (size_type level = 0, pos = right; pos > 0; ++level) {
+            const T *nodes = _tree.data() + _state._offset[level];
+            const size_type begin = (pos - 1) / _arity * _arity;
+            for (; pos > begin; --pos) {
+                if (!pred(_op(nodes[pos - 1], suffix))) {
+                    for (; level > 0; --level) {
+                        nodes = _tree.data() + _state._offset[level - 1];
+                        for (pos *= _arity; pred(_op(nodes[pos - 1], suffix)); --pos) {
+                            suffix = _op(nodes[pos - 1], suffix);
+                        }
+                    }
+                    return pos;
+                }
+                suffix = _op(nodes[pos - 1], suffix);
+            }
+            pos /= _arity;
+        }
+        return 0;
+    } else {
+        size_type nodes[2 * std::numeric_limits<size_type>::digits], count = 0, left_count = 0;
+        for (size_type L = _size, R = right + _size; L < R; L >>= 1, R >>= 1) {
+            if (L & 1) {
+                nodes[std::size(nodes) - ++left_count] = L++;
+            }
+            if (R & 1) {
+                nodes[count++] = --R;
+            }
+        }
+        std::copy(std::end(nodes) - left_count, std::end(nodes), nodes + count);
+        count += left_count;
+        for (size_type i = 0; i < count; ++i) {
+            size_type node = nodes[i];
+            if (!pred(_op(_tree[node], suffix))) {
+                while (node < _size) {
+                    node = node << 1 | 1;
+                    if (pred(_op(_tree[node], suffix))) {
+                        suffix = _op(_tree[node--], suffix);
+                    }
+                }
+                return node + 1 - _size;
+            }
+            suffix = _op(_tree[node], suffix);
+        }
+        return 0;
+    }
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+std::span<const T> segment_tree<T, Allocator, Operator, Layout>::data() const {
+    return std::span<const T>(_tree.data() + _leaf(0), _size);
+}
+
+template <class T, class Allocator, class Operator, class Layout>
+void segment_tree<T, Allocator, Operator, Layout>::clear() {
+    _tree.clear();
+    _tree.shrink_to_fit();
+    _size = 0;
+    _state = {};
+    _is_built = false;
+}
+} // namespace j
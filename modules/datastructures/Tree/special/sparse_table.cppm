@@ -0,0 +1,202 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+export module j:sparse_table;
+
+import :basics;
+import :vector;
+
+namespace j {
+// combines src[i] and src[i + offset] into dst[i] for i in [0, count). arithmetic values go in fixed-width chunks
+// of one 32-byte register, which the compiler turns into vector operations even at -O2
+template <class T, class Operator>
+void _sparse_table_combine(const T *__restrict src, T *__restrict dst, std::size_t count, std::size_t offset,
+                           const Operator &op) {
+    std::size_t i = 0;
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        constexpr std::size_t lanes = std::max<std::size_t>(1, 32 / sizeof(T));
+        for (; i + lanes <= count; i += lanes) {
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                dst[i + lane] = op(src[i + lane], src[i + offset + lane]);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        dst[i] = op(src[i], src[i + offset]);
+    }
+}
+
+// level k holds the aggregate of [i, i + 2^k) at i; a query overlaps the two blocks of 2^k that cover its range
+export template <class T, class Allocator = std::allocator<T>,
+                 class Operator = min<T>> // operator (idempotent monoid)
+class sparse_table {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using allocator_type = Allocator;
+
+  private:
+    [[no_unique_address]] Operator _op;
+    vector<T, Allocator> _table; // level k at [k * _size, (k + 1) * _size), the last 2^k - 1 entries unused
+    size_type _size;
+    size_type _levels;
+
+    void _build(); // level 0 holds the elements: every other level from the one below, O(n log n)
+
+  public:
+    sparse_table() : sparse_table(Allocator()) {}
+    explicit sparse_table(const Allocator &alloc) : _table(alloc), _size(0), _levels(0) {}
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    sparse_table(InputIter first, InputIter last, const Operator &op = Operator(),
+                 const Allocator &alloc = Allocator());
+    sparse_table(std::initializer_list<T> il, const Operator &op = Operator(), const Allocator &alloc = Allocator());
+
+    sparse_table(const sparse_table &other) = default;
+    sparse_table(sparse_table &&other) noexcept;
+    ~sparse_table() = default;
+    sparse_table &operator=(const sparse_table &other) = default;
+    sparse_table &operator=(sparse_table &&other) noexcept;
+    allocator_type get_allocator() const noexcept;
+
+    template <class InputIter>
+        requires std::input_iterator<InputIter>
+    void assign(InputIter first, InputIter last);
+    void assign(std::initializer_list<T> il);
+
+    bool empty() const;
+    size_type size() const;
+    value_type query(size_type pos) const;
+    value_type query(size_type left, size_type right) const; // [left, right)
+    void swap(sparse_table &other) noexcept(std::allocator_traits<Allocator>::propagate_on_container_swap::value ||
+                                            std::allocator_traits<Allocator>::is_always_equal::value) {
+        using std::swap;
+        swap(_op, other._op);
+        _table.swap(other._table);
+        swap(_size, other._size);
+        swap(_levels, other._levels);
+    }
+    void clear() noexcept;
+};
+
+template <class InputIter, class Sentinel>
+sparse_table(InputIter, Sentinel) -> sparse_table<std::iter_value_t<InputIter>>;
+
+template <class T> sparse_table(std::initializer_list<T>) -> sparse_table<T>;
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+sparse_table<T, Allocator, Operator>::sparse_table(InputIter first, InputIter last, const Operator &op,
+                                                   const Allocator &alloc)
+    : _op(op), _table(alloc), _size(0), _levels(0) {
+    assign(first, last);
+}
+
+template <class T, class Allocator, class Operator>
+sparse_table<T, Allocator, Operator>::sparse_table(std::initializer_list<T> il, const Operator &op,
+                                                   const Allocator &alloc)
+    : sparse_table(il.begin(), il.end(), op, alloc) {}
+
+template <class T, class Allocator, class Operator>
+sparse_table<T, Allocator, Operator>::sparse_table(sparse_table &&other) noexcept
+    : _op(std::move(other._op)), _table(std::move(other._table)), _size(std::exchange(other._size, 0)),
+      _levels(std::exchange(other._levels, 0)) {}
+
+template <class T, class Allocator, class Operator>
+sparse_table<T, Allocator, Operator> &sparse_table<T, Allocator, Operator>::operator=(sparse_table &&other) noexcept {
+    if (this != &other) {
+        _op = std::move(other._op);
+        _table = std::move(other._table);
+        _size = std::exchange(other._size, 0);
+        _levels = std::exchange(other._levels, 0);
+    }
+    return *this;
+}
+
+template <class T, class Allocator, class Operator>
+typename sparse_table<T, Allocator, Operator>::allocator_type
+sparse_table<T, Allocator, Operator>::get_allocator() const noexcept {
+    return _table.get_allocator();
+}
+
+template <class T, class Allocator, class Operator> void sparse_table<T, Allocator, Operator>::_build() {
+    _levels = _size == 0 ? 0 : static_cast<size_type>(std::bit_width(_size));
+    _table.resize(_levels * _size, _op.identity());
+    for (size_type level = 1; level < _levels; ++level) {
+        const size_type half = size_type{1} << (level - 1);
+        const T *below = _table.data() + (level - 1) * _size;
+        _sparse_table_combine(below, _table.data() + level * _size, _size - 2 * half + 1, half, _op);
+    }
+}
+
+template <class T, class Allocator, class Operator>
+template <class InputIter>
+    requires std::input_iterator<InputIter>
+void sparse_table<T, Allocator, Operator>::assign(InputIter first, InputIter last) {
+    _table.clear();
+    if constexpr (std::forward_iterator<InputIter>) {
+        const auto size = static_cast<size_type>(std::distance(first, last));
+        _table.reserve(size * static_cast<size_type>(std::bit_width(size)));
+    }
+    for (; first != last; ++first) {
+        _table.push_back(*first);
+    }
+    _size = _table.size();
+    _build();
+}
+
+template <class T, class Allocator, class Operator>
+void sparse_table<T, Allocator, Operator>::assign(std::initializer_list<T> il) {
+    assign(il.begin(), il.end());
+}
+
+template <class T, class Allocator, class Operator> bool sparse_table<T, Allocator, Operator>::empty() const {
+    return _size == 0;
+}
+
+template <class T, class Allocator, class Operator>
+typename sparse_table<T, Allocator, Operator>::size_type sparse_table<T, Allocator, Operator>::size() const {
+    return _size;
+}
+
+template <class T, class Allocator, class Operator>
+typename sparse_table<T, Allocator, Operator>::value_type
+sparse_table<T, Allocator, Operator>::query(size_type pos) const {
+    return _table[pos];
+}
+
+template <class T, class Allocator, class Operator>
+typename sparse_table<T, Allocator, Operator>::value_type
+sparse_table<T, Allocator, Operator>::query(size_type left, size_type right) const {
+    if (left >= right) {
+        return _op.identity();
+    }
+    const size_type level = static_cast<size_type>(std::bit_width(right - left)) - 1;
+    const T *row = _table.data() + level * _size;
+    return _op(row[left], row[right - (size_type{1} << level)]);
+}
+
+template <class T, class Allocator, class Operator> void sparse_table<T, Allocator, Operator>::clear() noexcept {
+    _table.clear();
+    _size = 0;
+    _levels = 0;
+}
+} // namespace j
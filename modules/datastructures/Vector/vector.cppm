@@ -301,6 +301,10 @@ template <class T, class Allocator> class vector<T, Allocator>::const_iterator {
         return temp += n;
     }
 
+    friend const_iterator operator+(difference_type n, const const_iterator &it) noexcept {
+        return it + n;
+    }
+
     const_iterator &operator-=(difference_type n) noexcept {
         _ptr -= n;
         return *this;
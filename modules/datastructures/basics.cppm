@@ -1,48 +1,103 @@
 /*
  * @ Created by jaehyung409 on 25. 1. 15.
  * @ Copyright (c) 2025 jaehyung409 All rights reserved.
- * This software is licensed under the MIT License. 
+ * This software is licensed under the MIT License.
  */
 
 module;
 #include <algorithm>
-#include <optional>
+#include <cstddef>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 
-export module j.basics;
-
-namespace j
-{
-    export template <class T, class Alloc>
-    struct uses_allocator : std::false_type {};
-
-    // Operation (Monoid)
-    export template <class T>
-    struct plus
-    {
-        constexpr T operator()(const T &lhs, const T &rhs) const { return lhs + rhs; }
-        constexpr T identity() const { return T(); }
-    };
-
-    export template <class T>
-    struct max
-    {
-        constexpr T operator()(const T &lhs, const T &rhs) const { return std::max(lhs, rhs); }
-        constexpr T identity() const { return std::numeric_limits<T>::min(); }
-    };
-
-    export template <class T>
-    struct assign
-    {
-        constexpr T operator()(const T &lhs, const T &rhs) const { return rhs; }
-        constexpr T identity() const { return T(); }
-    };
-
-    export template <class T>
-    struct multiply
-    {
-        constexpr T operator()(const T &lhs, const T &rhs) const { return lhs * rhs; }
-        constexpr T identity() const { return static_cast<T>(1); }
-    };
-}
\ No newline at end of file
+export module j:basics;
+
+namespace j {
+export template <class T, class Alloc> struct uses_allocator : std::false_type {};
+
+// Operation (Monoid): an associative operator() with an identity() element, as used by the range query trees
+// Group: a monoid whose inverse() undoes operator(), as used by the fenwick trees to cancel a prefix
+// Idempotent: a monoid with op(x, x) == x (min, max, gcd), as used by sparse_table to overlap two blocks
+export template <class T> struct plus {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return lhs + rhs;
+    }
+    constexpr T identity() const {
+        return T();
+    }
+    constexpr T inverse(const T &value) const {
+        return -value;
+    }
+};
+
+export template <class T> struct bit_xor {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return lhs ^ rhs;
+    }
+    constexpr T identity() const {
+        return T();
+    }
+    constexpr T inverse(const T &value) const {
+        return value;
+    }
+};
+
+export template <class T> struct max {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return std::max(lhs, rhs);
+    }
+    constexpr T identity() const {
+        return std::numeric_limits<T>::lowest();
+    }
+};
+
+export template <class T> struct min {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return std::min(lhs, rhs);
+    }
+    constexpr T identity() const {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+export template <class T> struct gcd {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return std::gcd(lhs, rhs);
+    }
+    constexpr T identity() const {
+        return T();
+    }
+};
+
+export template <class T> struct assign {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return rhs;
+    }
+    constexpr T identity() const {
+        return T();
+    }
+};
+
+export template <class T> struct multiply {
+    constexpr T operator()(const T &lhs, const T &rhs) const {
+        return lhs * rhs;
+    }
+    constexpr T identity() const {
+        return static_cast<T>(1);
+    }
+};
+
+// Mapping: applies a pending range tag to the aggregate of `length` elements, as used by lazy_segment_tree
+export template <class T> struct add_to_sum {
+    constexpr T operator()(const T &tag, const T &value, std::size_t length) const {
+        return value + tag * static_cast<T>(length);
+    }
+};
+
+export template <class T> struct add_to_max {
+    constexpr T operator()(const T &tag, const T &value, std::size_t) const {
+        return value + tag;
+    }
+};
+} // namespace j
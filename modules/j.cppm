@@ -7,17 +7,35 @@
 export module j;
 
 export import :traits;
+export import :basics;
 
 export import :array;
 export import :list;
 export import :forward_list;
+export import :intrusive_list;
+export import :unrolled_list;
+export import :timer_wheel;
 export import :vector;
 export import :deque;
 export import :stack;
 export import :queue;
+export import :concurrent_queue;
+export import :work_stealing_deque;
+export import :indexed_priority_queue;
+export import :thread_pool;
 
 export import :tree_selector;
 export import :map;
 export import :set;
+export import :segment_tree;
+export import :lazy_segment_tree;
+export import :persistent_segment_tree;
+export import :dynamic_segment_tree;
+export import :sparse_table;
+export import :disjoint_sparse_table;
+export import :fenwick_tree;
+export import :range_fenwick_tree;
+export import :fenwick_tree_2d;
 
-export import :algorithm;
\ No newline at end of file
+export import :algorithm;
+export import :parallel;
\ No newline at end of file
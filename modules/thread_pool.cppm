@@ -0,0 +1,391 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+module;
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+export module j:thread_pool;
+
+import :vector;
+import :deque;
+import :work_stealing_deque;
+import :concurrent_queue;
+
+namespace j {
+// a unit of work in the pool's queues; _execute runs it and frees whatever the task owns
+struct _pool_task {
+    void (*_execute)(_pool_task *);
+};
+
+template <class Fn> struct _pool_job : _pool_task {
+    Fn _fn;
+
+    explicit _pool_job(Fn fn) : _pool_task{&_run}, _fn(std::move(fn)) {}
+
+    static void _run(_pool_task *task) {
+        std::unique_ptr<_pool_job> job(static_cast<_pool_job *>(task));
+        job->_fn();
+    }
+};
+
+// counts the outstanding tasks of one parallel_for and keeps the first exception they threw. The group lives on the
+// waiting thread's stack and may be gone as soon as pending reaches 0, so the wakeup goes through an atomic the pool
+// owns: finished is bumped after the last decrement, and waiters block on it rather than on pending.
+struct _task_group {
+    std::atomic<std::size_t> pending;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    explicit _task_group(std::size_t count) noexcept : pending(count) {}
+
+    void fail(std::exception_ptr e) noexcept {
+        if (!failed.exchange(true, std::memory_order_acq_rel))
+            error = std::move(e);
+    }
+    void done(std::atomic<std::size_t> &finished) noexcept {
+        if (pending.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+            finished.fetch_add(1, std::memory_order_seq_cst);
+            finished.notify_all();
+        }
+    }
+};
+
+// Work-stealing thread pool. Every worker owns a lock-free work_stealing_deque: it pushes and pops its own tasks at
+// the bottom, and idle workers steal the oldest tasks of the others. Tasks submitted from outside the pool go through
+// a shared injection queue. A thread waiting in parallel_for runs queued tasks meanwhile, so parallel_for may nest.
+// The destructor runs every submitted task before joining the workers; a pool without workers runs them inline.
+export class thread_pool {
+  public:
+    using size_type = std::size_t;
+
+  private:
+    struct alignas(_cache_line_size) _worker {
+        work_stealing_deque<_pool_task *> tasks;
+    };
+
+    static constexpr int _spin_rounds = 64; // failed attempts to find a task before blocking
+
+    std::unique_ptr<_worker[]> _workers;
+    size_type _worker_count;
+    vector<std::thread> _threads;
+
+    std::mutex _inject_mutex;
+    deque<_pool_task *> _injected;
+
+    alignas(_cache_line_size) std::atomic<size_type> _pending{0}; // tasks queued but not taken yet
+    std::atomic<size_type> _sleepers{0};
+    std::atomic<size_type> _next_victim{0};
+    std::atomic<bool> _stop{false};
+    std::atomic<size_type> _finished_groups{0}; // bumped whenever a _task_group completes
+    std::mutex _sleep_mutex;
+    std::condition_variable _wake;
+
+    static inline thread_local thread_pool *_current_pool = nullptr;
+    static inline thread_local size_type _current_index = 0;
+
+    bool _on_worker() const noexcept {
+        return _current_pool == this;
+    }
+
+    void _enqueue(_pool_task *task);
+    static void _run_inline(_pool_task *task) noexcept {
+        task->_execute(task);
+    }
+    bool _take(_pool_task *&task) noexcept;
+    bool _try_run_one();
+    void _worker_loop(size_type index);
+    void _help_until(_task_group &group);
+
+    template <class Index, class Body> struct _for_context {
+        thread_pool *pool;
+        Body *body;
+        _task_group *group;
+        size_type grain;
+    };
+    template <class Index, class Body> struct _range_task : _pool_task {
+        _for_context<Index, Body> *context;
+        Index first;
+        Index last;
+
+        _range_task(_for_context<Index, Body> *ctx, Index f, Index l)
+            : _pool_task{&_run}, context(ctx), first(f), last(l) {}
+
+        static void _run(_pool_task *task) {
+            std::unique_ptr<_range_task> range(static_cast<_range_task *>(task));
+            thread_pool &pool = *range->context->pool;
+            _task_group &group = *range->context->group;
+            try {
+                pool._for_range(*range->context, range->first, range->last);
+            } catch (...) {
+                group.fail(std::current_exception());
+            }
+            group.done(pool._finished_groups);
+        }
+    };
+    template <class Index, class Body> void _for_range(_for_context<Index, Body> &context, Index first, Index last);
+
+  public:
+    // one worker less than the hardware threads: the thread calling parallel_for takes part as well.
+    // On a single core that is no worker at all, and submitted tasks run inline.
+    static size_type default_worker_count() noexcept {
+        return std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+
+    explicit thread_pool(size_type workers = default_worker_count());
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool();
+
+    size_type worker_count() const noexcept {
+        return _worker_count;
+    }
+    // threads that take part in a parallel_for: the workers and the caller
+    size_type concurrency() const noexcept {
+        return _worker_count + 1;
+    }
+
+    // runs f(args...) on a worker (inline without workers); the future receives the result or the exception
+    template <class F, class... Args>
+    std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> submit(F &&f, Args &&...args);
+
+    // runs f() on a worker and passes its result to callback there (callback() if f returns void).
+    // An exception escaping f or callback terminates the program, as it would on a std::thread. That holds on any
+    // thread that runs the job, including one helping out while it waits in parallel_for.
+    template <class F, class Callback> void submit_then(F &&f, Callback &&callback);
+
+    // calls body(i) for every i in [first, last) and returns once all calls have finished, rethrowing the first
+    // exception. The range is split lazily: a thread runs grain indices at a time and halves what it has left only
+    // while no task is queued for the others, so idle threads get work without splitting a busy pool into tiny
+    // tasks. grain 0 picks a small grain from the range length.
+    template <std::integral Index, class Body>
+    void parallel_for(Index first, Index last, Body body, size_type grain = 0);
+};
+
+inline thread_pool::thread_pool(size_type workers) : _workers(new _worker[workers]), _worker_count(workers) {
+    _threads.reserve(workers);
+    try {
+        for (size_type i = 0; i < workers; ++i) {
+            _threads.emplace_back([this, i] { _worker_loop(i); });
+        }
+    } catch (...) {
+        {
+            std::lock_guard lock(_sleep_mutex);
+            _stop.store(true, std::memory_order_seq_cst);
+        }
+        _wake.notify_all();
+        for (std::thread &thread : _threads) {
+            thread.join();
+        }
+        throw;
+    }
+}
+
+inline thread_pool::~thread_pool() {
+    {
+        std::lock_guard lock(_sleep_mutex);
+        _stop.store(true, std::memory_order_seq_cst);
+    }
+    _wake.notify_all();
+    for (std::thread &thread : _threads) {
+        thread.join();
+    }
+}
+
+inline void thread_pool::_enqueue(_pool_task *task) {
+    if (_worker_count == 0) {
+        _run_inline(task); // nobody would ever take it from a queue
+        return;
+    }
+    // counted before it becomes visible, so _pending never drops below the number of queued tasks
+    _pending.fetch_add(1, std::memory_order_seq_cst);
+    try {
+        if (_on_worker()) {
+            _workers[_current_index].tasks.push(task);
+        } else {
+            std::lock_guard lock(_inject_mutex);
+            _injected.push_back(task);
+        }
+    } catch (...) {
+        _pending.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    if (_sleepers.load(std::memory_order_seq_cst) != 0) {
+        {
+            std::lock_guard lock(_sleep_mutex);
+        }
+        _wake.notify_one();
+    }
+}
+
+inline bool thread_pool::_take(_pool_task *&task) noexcept {
+    if (_on_worker() && _workers[_current_index].tasks.try_pop(task))
+        return true;
+    const size_type start = _next_victim.fetch_add(1, std::memory_order_relaxed);
+    for (size_type k = 0; k < _worker_count; ++k) {
+        const size_type victim = (start + k) % _worker_count;
+        if ((!_on_worker() || victim != _current_index) && _workers[victim].tasks.try_steal(task))
+            return true;
+    }
+    std::lock_guard lock(_inject_mutex);
+    if (_injected.empty())
+        return false;
+    task = _injected.front();
+    _injected.pop_front();
+    return true;
+}
+
+inline bool thread_pool::_try_run_one() {
+    if (_pending.load(std::memory_order_acquire) == 0)
+        return false;
+    _pool_task *task;
+    if (!_take(task))
+        return false;
+    _pending.fetch_sub(1, std::memory_order_relaxed);
+    task->_execute(task);
+    return true;
+}
+
+inline void thread_pool::_worker_loop(size_type index) {
+    _current_pool = this;
+    _current_index = index;
+    while (true) {
+        bool found = false;
+        for (int round = 0; round < _spin_rounds && !found; ++round) {
+            found = _try_run_one();
+            if (!found)
+                std::this_thread::yield();
+        }
+        if (found)
+            continue;
+        std::unique_lock lock(_sleep_mutex);
+        // announcing the sleeper before checking _pending pairs with _enqueue's increment-then-check: one of the two
+        // sides always sees the other
+        _sleepers.fetch_add(1, std::memory_order_seq_cst);
+        while (!_stop.load(std::memory_order_seq_cst) && _pending.load(std::memory_order_seq_cst) == 0) {
+            _wake.wait(lock);
+        }
+        _sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        if (_stop.load(std::memory_order_seq_cst) && _pending.load(std::memory_order_seq_cst) == 0)
+            return;
+    }
+}
+
+inline void thread_pool::_help_until(_task_group &group) {
+    int idle = 0;
+    while (true) {
+        // read before pending: a group finishing in between changes it, so the wait below cannot miss the wakeup
+        const size_type finished = _finished_groups.load(std::memory_order_seq_cst);
+        if (group.pending.load(std::memory_order_seq_cst) == 0)
+            return;
+        if (_try_run_one()) {
+            idle = 0;
+        } else if (++idle < _spin_rounds) {
+            std::this_thread::yield();
+        } else {
+            // the remaining tasks are running elsewhere
+            _finished_groups.wait(finished, std::memory_order_seq_cst);
+            idle = 0;
+        }
+    }
+}
+
+template <class F, class... Args>
+std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> thread_pool::submit(F &&f, Args &&...args) {
+    using result_type = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+    std::packaged_task<result_type()> work(
+        [fn = std::forward<F>(f), ... bound = std::forward<Args>(args)]() mutable -> result_type {
+            return std::invoke(std::move(fn), std::move(bound)...);
+        });
+    std::future<result_type> result = work.get_future();
+    auto job = std::make_unique<_pool_job<std::packaged_task<result_type()>>>(std::move(work));
+    _enqueue(job.get());
+    job.release();
+    return result;
+}
+
+template <class F, class Callback> void thread_pool::submit_then(F &&f, Callback &&callback) {
+    // noexcept: the job must not unwind into whatever the running thread was doing, e.g. a parallel_for whose tasks
+    // still point into its stack frame
+    auto work = [fn = std::forward<F>(f), cb = std::forward<Callback>(callback)]() mutable noexcept {
+        if constexpr (std::is_void_v<std::invoke_result_t<decltype(fn) &>>) {
+            fn();
+            cb();
+        } else {
+            cb(fn());
+        }
+    };
+    auto job = std::make_unique<_pool_job<decltype(work)>>(std::move(work));
+    _enqueue(job.get());
+    job.release();
+}
+
+template <class Index, class Body>
+void thread_pool::_for_range(_for_context<Index, Body> &context, Index first, Index last) {
+    while (first < last && !context.group->failed.load(std::memory_order_relaxed)) {
+        const auto count = static_cast<size_type>(last - first);
+        // lazy binary splitting: the own deque (the injection queue outside the pool) running dry means other
+        // threads are taking work, so hand them half of what is left
+        const bool hungry =
+            _on_worker() ? _workers[_current_index].tasks.empty() : _pending.load(std::memory_order_relaxed) == 0;
+        if (count > context.grain && hungry) {
+            const Index middle = first + static_cast<Index>(count / 2);
+            auto task = std::make_unique<_range_task<Index, Body>>(&context, middle, last);
+            context.group->pending.fetch_add(1, std::memory_order_relaxed);
+            try {
+                _enqueue(task.get());
+            } catch (...) {
+                context.group->done(_finished_groups);
+                throw;
+            }
+            task.release();
+            last = middle;
+            continue;
+        }
+        const Index step_end = first + static_cast<Index>(std::min(count, context.grain));
+        for (; first != step_end; ++first) {
+            (*context.body)(first);
+        }
+    }
+}
+
+template <std::integral Index, class Body>
+void thread_pool::parallel_for(Index first, Index last, Body body, size_type grain) {
+    if (!(first < last))
+        return;
+    const auto count = static_cast<size_type>(last - first);
+    if (grain == 0)
+        grain = std::max<size_type>(1, count / (concurrency() * 64));
+    if (_worker_count == 0 || count <= grain) {
+        for (; first != last; ++first) {
+            body(first);
+        }
+        return;
+    }
+    _task_group group(1);
+    _for_context<Index, Body> context{this, std::addressof(body), &group, grain};
+    try {
+        _for_range(context, first, last);
+    } catch (...) {
+        group.fail(std::current_exception());
+    }
+    group.done(_finished_groups);
+    _help_until(group);
+    if (group.error)
+        std::rethrow_exception(group.error);
+}
+} // namespace j
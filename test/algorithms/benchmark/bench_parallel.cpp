@@ -0,0 +1,125 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <catch2/catch_all.hpp>
+import j;
+
+constexpr std::size_t N = 1 << 22;
+
+template <class Container> Container random_values(unsigned seed) {
+    std::mt19937 rng(seed);
+    Container c;
+    for (std::size_t i = 0; i < N; ++i) {
+        c.push_back(static_cast<int>(rng() % 1000000));
+    }
+    return c;
+}
+
+TEST_CASE("Parallel Benchmarks: Sort") {
+    const auto data = random_values<j::vector<int>>(1);
+
+    BENCHMARK_ADVANCED("j::par::sort j::vector")(Catch::Benchmark::Chronometer meter) {
+        j::vector<int> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            j::par::sort(j::execution::par, v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("std::sort j::vector")(Catch::Benchmark::Chronometer meter) {
+        j::vector<int> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            std::sort(v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("j::par::stable_sort j::deque")(Catch::Benchmark::Chronometer meter) {
+        j::deque<int> d(data.begin(), data.end());
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), d.begin());
+            j::par::stable_sort(j::execution::par, d.begin(), d.end());
+            return d[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("std::stable_sort j::deque")(Catch::Benchmark::Chronometer meter) {
+        j::deque<int> d(data.begin(), data.end());
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), d.begin());
+            std::stable_sort(d.begin(), d.end());
+            return d[N / 2];
+        });
+    };
+}
+
+TEST_CASE("Parallel Benchmarks: Element-wise") {
+    auto v = random_values<j::vector<int>>(2);
+    auto d = random_values<j::deque<int>>(2);
+
+    BENCHMARK("j::par::for_each j::deque") {
+        j::par::for_each(j::execution::par, d.begin(), d.end(), [](int &x) { x = x * 3 + 1; });
+        return d[N / 2];
+    };
+
+    BENCHMARK("std::for_each j::deque") {
+        std::for_each(d.begin(), d.end(), [](int &x) { x = x * 3 + 1; });
+        return d[N / 2];
+    };
+
+    BENCHMARK("j::par::transform j::vector") {
+        j::par::transform(j::execution::par, v.begin(), v.end(), v.begin(), [](int x) { return x ^ (x >> 3); });
+        return v[N / 2];
+    };
+
+    BENCHMARK("std::transform j::vector") {
+        std::transform(v.begin(), v.end(), v.begin(), [](int x) { return x ^ (x >> 3); });
+        return v[N / 2];
+    };
+}
+
+TEST_CASE("Parallel Benchmarks: Reduce and Scan") {
+    const auto v = random_values<j::vector<int>>(3);
+    const auto d = random_values<j::deque<int>>(3);
+    std::vector<long long> out(N);
+
+    BENCHMARK("j::par::reduce j::deque") {
+        return j::par::reduce(j::execution::par, d.begin(), d.end(), 0LL);
+    };
+
+    BENCHMARK("std::accumulate j::deque") {
+        return std::accumulate(d.begin(), d.end(), 0LL);
+    };
+
+    BENCHMARK("j::par::transform_reduce j::vector") {
+        return j::par::transform_reduce(j::execution::par, v.begin(), v.end(), 0.0, std::plus<>(),
+                                        [](int x) { return std::sqrt(static_cast<double>(x)); });
+    };
+
+    BENCHMARK("std::transform_reduce j::vector") {
+        return std::transform_reduce(v.begin(), v.end(), 0.0, std::plus<>(),
+                                     [](int x) { return std::sqrt(static_cast<double>(x)); });
+    };
+
+    BENCHMARK("j::par::inclusive_scan j::deque") {
+        j::par::inclusive_scan(j::execution::par, d.begin(), d.end(), out.begin(), std::plus<>(), 0LL);
+        return out.back();
+    };
+
+    BENCHMARK("std::inclusive_scan j::deque") {
+        std::inclusive_scan(d.begin(), d.end(), out.begin(), std::plus<>(), 0LL);
+        return out.back();
+    };
+}
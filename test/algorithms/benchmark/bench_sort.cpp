@@ -0,0 +1,179 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include <catch2/catch_all.hpp>
+import j;
+
+constexpr std::size_t N = 1 << 20;
+constexpr std::size_t BLOCKS = 1 << 15;
+
+template <class T> j::vector<T> random_values(std::size_t n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    j::vector<T> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if constexpr (std::is_floating_point_v<T>)
+            v.push_back(static_cast<T>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng)));
+        else
+            v.push_back(static_cast<T>(rng()));
+    }
+    return v;
+}
+
+TEST_CASE("Sort Benchmarks: pdqsort") {
+    const auto random = random_values<int>(N, 1);
+    j::vector<int> few_unique = random;
+    for (auto &x : few_unique) {
+        x &= 15;
+    }
+    j::vector<int> nearly_sorted = random;
+    std::sort(nearly_sorted.begin(), nearly_sorted.end());
+    for (std::size_t i = 0; i < N / 1000; ++i) {
+        std::swap(nearly_sorted[(i * 7919) % N], nearly_sorted[(i * 104729) % N]);
+    }
+
+    const std::pair<const char *, const j::vector<int> *> inputs[] = {
+        {"random", &random}, {"few unique", &few_unique}, {"nearly sorted", &nearly_sorted}};
+    for (const auto &input : inputs) {
+        const j::vector<int> *data = input.second;
+        SECTION(input.first) {
+            BENCHMARK_ADVANCED("j::sort j::vector<int>")(Catch::Benchmark::Chronometer meter) {
+                j::vector<int> v = *data;
+                meter.measure([&] {
+                    std::copy(data->begin(), data->end(), v.begin());
+                    j::sort(v.begin(), v.end());
+                    return v[N / 2];
+                });
+            };
+
+            BENCHMARK_ADVANCED("std::sort j::vector<int>")(Catch::Benchmark::Chronometer meter) {
+                j::vector<int> v = *data;
+                meter.measure([&] {
+                    std::copy(data->begin(), data->end(), v.begin());
+                    std::sort(v.begin(), v.end());
+                    return v[N / 2];
+                });
+            };
+        }
+    }
+
+    SECTION("j::deque") {
+        BENCHMARK_ADVANCED("j::sort j::deque<int>")(Catch::Benchmark::Chronometer meter) {
+            j::deque<int> d(random.begin(), random.end());
+            meter.measure([&] {
+                std::copy(random.begin(), random.end(), d.begin());
+                j::sort(d.begin(), d.end());
+                return d[N / 2];
+            });
+        };
+
+        BENCHMARK_ADVANCED("std::sort j::deque<int>")(Catch::Benchmark::Chronometer meter) {
+            j::deque<int> d(random.begin(), random.end());
+            meter.measure([&] {
+                std::copy(random.begin(), random.end(), d.begin());
+                std::sort(d.begin(), d.end());
+                return d[N / 2];
+            });
+        };
+    }
+}
+
+template <class T> void radix_benchmarks() {
+    const auto data = random_values<T>(N, 2);
+
+    BENCHMARK_ADVANCED("j::radix_sort<8>")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            j::radix_sort<8>(v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("j::radix_sort<11>")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            j::radix_sort<11>(v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("j::radix_sort<16>")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            j::radix_sort<16>(v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("j::sort")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            j::sort(v.begin(), v.end());
+            return v[N / 2];
+        });
+    };
+}
+
+TEST_CASE("Sort Benchmarks: radix sort") {
+    SECTION("uint32_t") {
+        radix_benchmarks<std::uint32_t>();
+    }
+    SECTION("uint64_t") {
+        radix_benchmarks<std::uint64_t>();
+    }
+    SECTION("float") {
+        radix_benchmarks<float>();
+    }
+}
+
+template <std::size_t Size, class T> void network_benchmarks() {
+    const auto data = random_values<T>(Size * BLOCKS, 3);
+
+    BENCHMARK_ADVANCED("j::sort_network")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            for (std::size_t b = 0; b < BLOCKS; ++b) {
+                j::sort_network<Size>(v.begin() + b * Size);
+            }
+            return v[Size / 2];
+        });
+    };
+
+    BENCHMARK_ADVANCED("std::sort per block")(Catch::Benchmark::Chronometer meter) {
+        j::vector<T> v = data;
+        meter.measure([&] {
+            std::copy(data.begin(), data.end(), v.begin());
+            for (std::size_t b = 0; b < BLOCKS; ++b) {
+                std::sort(v.begin() + b * Size, v.begin() + (b + 1) * Size);
+            }
+            return v[Size / 2];
+        });
+    };
+}
+
+TEST_CASE("Sort Benchmarks: sorting networks") {
+    SECTION("8 x int32_t") {
+        network_benchmarks<8, std::int32_t>();
+    }
+    SECTION("16 x int32_t") {
+        network_benchmarks<16, std::int32_t>();
+    }
+    SECTION("32 x float") {
+        network_benchmarks<32, float>();
+    }
+}
@@ -0,0 +1,194 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+import j;
+
+// large enough to be split into many chunks
+constexpr std::size_t N = 300000;
+
+template <class Container> Container random_values(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    Container c;
+    for (std::size_t i = 0; i < n; ++i) {
+        c.push_back(static_cast<int>(rng() % 1000));
+    }
+    return c;
+}
+
+TEMPLATE_TEST_CASE("Parallel Algorithms", "", j::vector<int>, j::deque<int>) {
+    const TestType input = random_values<TestType>(N, 7);
+    const std::vector<int> expected_input(input.begin(), input.end());
+
+    SECTION("for_each and transform") {
+        TestType c = input;
+        j::par::for_each(j::execution::par, c.begin(), c.end(), [](int &v) { v *= 2; });
+        std::vector<int> expected = expected_input;
+        for (int &v : expected) {
+            v *= 2;
+        }
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+        std::vector<long> out(N);
+        auto end = j::par::transform(j::execution::par, c.begin(), c.end(), out.begin(), [](int v) { return v + 1L; });
+        REQUIRE(end == out.end());
+        REQUIRE(out[12345] == expected[12345] + 1L);
+
+        TestType sum = input;
+        j::par::transform(j::execution::par, input.begin(), input.end(), c.begin(), sum.begin(), std::plus<>());
+        REQUIRE(sum[N - 1] == expected_input[N - 1] * 3);
+    }
+
+    SECTION("reduce and transform_reduce") {
+        const long long expected = std::accumulate(expected_input.begin(), expected_input.end(), 0LL);
+        REQUIRE(j::par::reduce(j::execution::par, input.begin(), input.end(), 0LL) == expected);
+        REQUIRE(j::par::reduce(j::execution::seq, input.begin(), input.end(), 0LL) == expected);
+        REQUIRE(j::par::reduce(input.begin(), input.end()) == static_cast<int>(expected));
+
+        // chunk results are combined in order, so a non-commutative operation works
+        j::vector<std::string> words;
+        for (std::size_t i = 0; i < 40000; ++i) {
+            words.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+        }
+        const std::string joined = j::par::reduce(j::execution::par, words.begin(), words.end(), std::string());
+        REQUIRE(joined == std::accumulate(words.begin(), words.end(), std::string()));
+
+        const long long squares = j::par::transform_reduce(j::execution::par, input.begin(), input.end(), 0LL,
+                                                           std::plus<>(), [](int v) { return 1LL * v * v; });
+        long long expected_squares = 0;
+        for (int v : expected_input) {
+            expected_squares += 1LL * v * v;
+        }
+        REQUIRE(squares == expected_squares);
+        REQUIRE(j::par::transform_reduce(j::execution::par, input.begin(), input.end(), input.begin(), 0LL,
+                                         std::plus<>(), [](int a, int b) { return 1LL * a * b; }) == expected_squares);
+        REQUIRE(j::par::transform_reduce(j::execution::par, input.begin(), input.begin() + 1000, input.begin(), 0LL) ==
+                std::inner_product(input.begin(), input.begin() + 1000, input.begin(), 0LL));
+    }
+
+    SECTION("inclusive_scan") {
+        std::vector<long long> expected(N);
+        std::inclusive_scan(expected_input.begin(), expected_input.end(), expected.begin(), std::plus<>(), 5LL);
+        std::vector<long long> out(N);
+        j::par::inclusive_scan(j::execution::par, input.begin(), input.end(), out.begin(), std::plus<>(), 5LL);
+        REQUIRE(out == expected);
+
+        TestType in_place = input;
+        j::par::inclusive_scan(j::execution::par, in_place.begin(), in_place.end(), in_place.begin());
+        std::vector<int> expected_int(N);
+        std::inclusive_scan(expected_input.begin(), expected_input.end(), expected_int.begin());
+        REQUIRE(std::equal(in_place.begin(), in_place.end(), expected_int.begin(), expected_int.end()));
+    }
+
+    SECTION("sort and stable_sort") {
+        TestType c = input;
+        j::par::sort(j::execution::par, c.begin(), c.end());
+        std::vector<int> expected = expected_input;
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+        j::par::sort(c.begin(), c.end(), std::greater<>());
+        REQUIRE(std::is_sorted(c.begin(), c.end(), std::greater<>()));
+
+        // stability: sort by the low digit only, the original order must survive within equal keys
+        j::vector<std::pair<int, std::size_t>> tagged;
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            tagged.push_back({input[i] % 10, i});
+        }
+        j::par::stable_sort(j::execution::par, tagged.begin(), tagged.end(),
+                            [](const auto &a, const auto &b) { return a.first < b.first; });
+        REQUIRE(std::is_sorted(tagged.begin(), tagged.end()));
+    }
+
+    SECTION("merge") {
+        std::vector<int> a(expected_input.begin(), expected_input.begin() + N / 3);
+        TestType b(input.begin() + N / 3, input.end());
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        TestType out(N, 0);
+        REQUIRE(j::par::merge(j::execution::par, a.begin(), a.end(), b.begin(), b.end(), out.begin()) == out.end());
+        std::vector<int> expected = expected_input;
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(std::equal(out.begin(), out.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST_CASE("Parallel Algorithms Edge Cases") {
+    SECTION("Empty and small ranges") {
+        j::vector<int> empty;
+        j::par::sort(empty.begin(), empty.end());
+        REQUIRE(j::par::reduce(j::execution::par, empty.begin(), empty.end(), 3) == 3);
+        REQUIRE(j::par::inclusive_scan(j::execution::par, empty.begin(), empty.end(), empty.begin()) == empty.end());
+
+        j::array<int, 5> small = {5, 3, 1, 4, 2};
+        j::par::sort(j::execution::par, small.begin(), small.end());
+        REQUIRE(std::is_sorted(small.begin(), small.end()));
+        REQUIRE(j::par::reduce(j::execution::par, small.begin(), small.end()) == 15);
+    }
+
+    SECTION("Deque chunks start on block boundaries") {
+        // the range starts in the middle of a block, and every chunk still sees whole runs of contiguous memory
+        j::deque<int> d;
+        for (std::size_t i = 0; i < N; ++i) {
+            d.push_back(static_cast<int>(i));
+        }
+        for (int i = 0; i < 77; ++i) {
+            d.push_front(-1);
+        }
+        std::atomic<std::size_t> visited{0};
+        std::atomic<std::size_t> negative{0};
+        j::par::for_each(j::execution::par, d.begin() + 77, d.end(), [&](int &v) {
+            ++visited;
+            if (v < 0)
+                ++negative;
+        });
+        REQUIRE(visited == N);
+        REQUIRE(negative == 0);
+        j::par::sort(j::execution::par, d.begin(), d.end(), std::greater<>());
+        REQUIRE(std::is_sorted(d.begin(), d.end(), std::greater<>()));
+        REQUIRE(d.back() == -1);
+    }
+
+    SECTION("Exceptions reach the caller") {
+        j::vector<int> v(N, 1);
+        v[N / 2] = -1;
+        REQUIRE_THROWS_AS(j::par::for_each(j::execution::par, v.begin(), v.end(),
+                                           [](int x) {
+                                               if (x < 0)
+                                                   throw std::runtime_error("negative");
+                                           }),
+                          std::runtime_error);
+        // the pool is still usable
+        REQUIRE(j::par::reduce(j::execution::par, v.begin(), v.end()) == static_cast<int>(N) - 2);
+    }
+
+    SECTION("Nested calls") {
+        j::vector<j::vector<int>> rows;
+        for (int r = 0; r < 8; ++r) {
+            rows.push_back(random_values<j::vector<int>>(N / 4, static_cast<unsigned>(r)));
+        }
+        // a parallel for_each whose elements start parallel sorts, so workers wait on tasks of their own
+        j::vector<std::size_t> indices(N);
+        std::iota(indices.begin(), indices.end(), 0);
+        j::par::for_each(j::execution::par, indices.begin(), indices.end(), [&](std::size_t i) {
+            if (i % (N / rows.size()) == 0)
+                j::par::sort(rows[i / (N / rows.size())].begin(), rows[i / (N / rows.size())].end());
+        });
+        for (const auto &row : rows) {
+            REQUIRE(std::is_sorted(row.begin(), row.end()));
+        }
+    }
+}
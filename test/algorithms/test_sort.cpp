@@ -0,0 +1,312 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+import j;
+
+constexpr std::size_t N = 100000;
+
+// the input patterns pdqsort is designed for, plus plain random data
+std::vector<std::vector<int>> patterns(std::size_t n) {
+    std::mt19937 rng(42);
+    std::vector<std::vector<int>> result;
+    std::vector<int> v(n);
+
+    for (auto &x : v) {
+        x = static_cast<int>(rng());
+    }
+    result.push_back(v); // random
+    for (auto &x : v) {
+        x = static_cast<int>(rng() % 16);
+    }
+    result.push_back(v); // few unique
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(i);
+    }
+    result.push_back(v); // sorted
+    std::reverse(v.begin(), v.end());
+    result.push_back(v); // reversed
+    std::fill(v.begin(), v.end(), 7);
+    result.push_back(v); // all equal
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(i < n / 2 ? i : n - i);
+    }
+    result.push_back(v); // organ pipe
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(i % 1000);
+    }
+    result.push_back(v); // sawtooth
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(i);
+    }
+    for (std::size_t i = 0; i < n / 100; ++i) {
+        std::swap(v[rng() % n], v[rng() % n]);
+    }
+    result.push_back(v); // nearly sorted
+    return result;
+}
+
+TEMPLATE_TEST_CASE("Sort", "", j::vector<int>, j::deque<int>) {
+    SECTION("Input patterns") {
+        for (const auto &input : patterns(N)) {
+            TestType c(input.begin(), input.end());
+            j::sort(c.begin(), c.end());
+            std::vector<int> expected = input;
+            std::sort(expected.begin(), expected.end());
+            REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    SECTION("Comparators") {
+        for (const auto &input : patterns(N / 10)) {
+            TestType c(input.begin(), input.end());
+            j::sort(c.begin(), c.end(), std::greater<>());
+            REQUIRE(std::is_sorted(c.begin(), c.end(), std::greater<>()));
+
+            // a lambda takes the branchy partition
+            j::sort(c.begin(), c.end(), [](int a, int b) { return a % 1000 < b % 1000; });
+            REQUIRE(std::is_sorted(c.begin(), c.end(), [](int a, int b) { return a % 1000 < b % 1000; }));
+        }
+    }
+
+    SECTION("Small ranges") {
+        std::mt19937 rng(1);
+        for (std::size_t n = 0; n < 200; ++n) {
+            TestType c;
+            for (std::size_t i = 0; i < n; ++i) {
+                c.push_back(static_cast<int>(rng() % 50));
+            }
+            j::sort(c.begin(), c.end());
+            REQUIRE(std::is_sorted(c.begin(), c.end()));
+        }
+    }
+}
+
+TEST_CASE("Sort Properties") {
+    SECTION("Sorted and reversed inputs take a linear number of comparisons") {
+        std::vector<int> v(N);
+        for (std::size_t i = 0; i < N; ++i) {
+            v[i] = static_cast<int>(i);
+        }
+        std::size_t comparisons = 0;
+        auto counting = [&](int a, int b) {
+            ++comparisons;
+            return a < b;
+        };
+        j::sort(v.begin(), v.end(), counting);
+        REQUIRE(comparisons < 3 * N);
+
+        std::reverse(v.begin(), v.end());
+        comparisons = 0;
+        j::sort(v.begin(), v.end(), counting);
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+        REQUIRE(comparisons < 4 * N);
+    }
+
+    SECTION("Strings and move-only elements") {
+        std::mt19937 rng(3);
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < 5000; ++i) {
+            strings.push_back(std::to_string(rng() % 100000));
+        }
+        j::sort(strings.begin(), strings.end());
+        REQUIRE(std::is_sorted(strings.begin(), strings.end()));
+
+        std::vector<std::unique_ptr<int>> ptrs;
+        for (std::size_t i = 0; i < 5000; ++i) {
+            ptrs.push_back(std::make_unique<int>(static_cast<int>(rng() % 1000)));
+        }
+        j::sort(ptrs.begin(), ptrs.end(), [](const auto &a, const auto &b) { return *a < *b; });
+        REQUIRE(std::is_sorted(ptrs.begin(), ptrs.end(), [](const auto &a, const auto &b) { return *a < *b; }));
+    }
+
+    SECTION("Doubles") {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> dist(-1e6, 1e6);
+        j::vector<double> v;
+        for (std::size_t i = 0; i < N; ++i) {
+            v.push_back(dist(rng));
+        }
+        j::sort(v.begin(), v.end());
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+    }
+}
+
+TEMPLATE_TEST_CASE("Radix Sort", "", j::vector<std::int32_t>, j::deque<std::int32_t>) {
+    std::mt19937 rng(11);
+    TestType c;
+    for (std::size_t i = 0; i < N; ++i) {
+        c.push_back(static_cast<std::int32_t>(rng()));
+    }
+    std::vector<std::int32_t> expected(c.begin(), c.end());
+    std::sort(expected.begin(), expected.end());
+
+    SECTION("8-bit digits") {
+        j::radix_sort(c.begin(), c.end());
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("11-bit digits") {
+        j::radix_sort<11>(c.begin(), c.end());
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("16-bit digits") {
+        j::radix_sort<16>(c.begin(), c.end());
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST_CASE("Radix Sort Keys") {
+    std::mt19937_64 rng(13);
+
+    SECTION("Unsigned and 64-bit integers") {
+        std::vector<std::uint64_t> u(N);
+        for (auto &x : u) {
+            x = rng();
+        }
+        std::vector<std::int64_t> s(u.begin(), u.end());
+        j::radix_sort<11>(u.begin(), u.end());
+        REQUIRE(std::is_sorted(u.begin(), u.end()));
+        j::radix_sort<16>(s.begin(), s.end());
+        REQUIRE(std::is_sorted(s.begin(), s.end()));
+    }
+
+    SECTION("Narrow integers") {
+        std::vector<std::int8_t> bytes(N);
+        for (auto &x : bytes) {
+            x = static_cast<std::int8_t>(rng());
+        }
+        j::radix_sort(bytes.begin(), bytes.end());
+        REQUIRE(std::is_sorted(bytes.begin(), bytes.end()));
+
+        std::vector<std::uint16_t> shorts(N);
+        for (auto &x : shorts) {
+            x = static_cast<std::uint16_t>(rng());
+        }
+        j::radix_sort<11>(shorts.begin(), shorts.end());
+        REQUIRE(std::is_sorted(shorts.begin(), shorts.end()));
+    }
+
+    SECTION("Floating point") {
+        std::uniform_real_distribution<double> dist(-1e9, 1e9);
+        std::vector<double> d(N);
+        for (auto &x : d) {
+            x = dist(rng);
+        }
+        d[0] = 0.0;
+        d[1] = -0.0;
+        d[2] = std::numeric_limits<double>::infinity();
+        d[3] = -std::numeric_limits<double>::infinity();
+        d[4] = std::numeric_limits<double>::denorm_min();
+        std::vector<float> f(d.begin(), d.end());
+
+        j::radix_sort(d.begin(), d.end());
+        REQUIRE(std::is_sorted(d.begin(), d.end()));
+        REQUIRE(d.front() == -std::numeric_limits<double>::infinity());
+        REQUIRE(d.back() == std::numeric_limits<double>::infinity());
+        const auto zero = std::find(d.begin(), d.end(), 0.0);
+        REQUIRE(std::signbit(*zero)); // -0.0 first
+        REQUIRE_FALSE(std::signbit(*(zero + 1)));
+
+        j::radix_sort<11>(f.begin(), f.end());
+        REQUIRE(std::is_sorted(f.begin(), f.end()));
+    }
+
+    SECTION("Key extractor is stable") {
+        std::vector<std::pair<int, std::string>> v;
+        for (std::size_t i = 0; i < 20000; ++i) {
+            v.emplace_back(static_cast<int>(rng() % 200) - 100, std::to_string(i));
+        }
+        auto expected = v;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const auto &a, const auto &b) { return a.first < b.first; });
+        j::radix_sort(v.begin(), v.end(), [](const auto &p) { return p.first; });
+        REQUIRE(v == expected);
+    }
+
+    SECTION("Short and constant ranges") {
+        for (std::size_t n : {0, 1, 2, 63, 64, 65, 200}) {
+            std::vector<int> v(n);
+            for (auto &x : v) {
+                x = static_cast<int>(rng() % 1000) - 500;
+            }
+            j::radix_sort(v.begin(), v.end());
+            REQUIRE(std::is_sorted(v.begin(), v.end()));
+        }
+        std::vector<std::pair<unsigned, int>> same(1000);
+        for (std::size_t i = 0; i < same.size(); ++i) {
+            same[i] = {42u, static_cast<int>(i)};
+        }
+        j::radix_sort(same.begin(), same.end(), [](const auto &p) { return p.first; });
+        for (std::size_t i = 0; i < same.size(); ++i) {
+            REQUIRE(same[i].second == static_cast<int>(i));
+        }
+    }
+}
+
+template <std::size_t Size, class T, class Container, class Compare>
+void check_network(std::mt19937 &rng, Compare comp) {
+    for (int round = 0; round < 200; ++round) {
+        Container c;
+        for (std::size_t i = 0; i < Size; ++i) {
+            c.push_back(static_cast<T>(static_cast<int>(rng() % 64) - 32));
+        }
+        std::vector<T> expected(c.begin(), c.end());
+        std::sort(expected.begin(), expected.end(), comp);
+        j::sort_network<Size>(c.begin(), comp);
+        REQUIRE(std::equal(c.begin(), c.end(), expected.begin()));
+    }
+}
+
+TEST_CASE("Sorting Networks") {
+    std::mt19937 rng(17);
+
+    SECTION("Power of two sizes") {
+        check_network<2, int, j::vector<int>>(rng, std::less<>());
+        check_network<4, int, j::vector<int>>(rng, std::less<>());
+        check_network<8, int, j::vector<int>>(rng, std::less<>());
+        check_network<16, int, j::vector<int>>(rng, std::less<>());
+        check_network<32, int, j::vector<int>>(rng, std::less<>());
+        check_network<64, int, j::vector<int>>(rng, std::less<>());
+    }
+
+    SECTION("Vectorized key types and orders") {
+        check_network<8, std::uint32_t, j::vector<std::uint32_t>>(rng, std::less<>());
+        check_network<16, std::uint32_t, j::vector<std::uint32_t>>(rng, std::greater<std::uint32_t>());
+        check_network<32, float, j::vector<float>>(rng, std::less<float>());
+        check_network<16, float, j::vector<float>>(rng, std::greater<>());
+        check_network<32, int, j::vector<int>>(rng, std::greater<>());
+    }
+
+    SECTION("Deque iterators and other elements") {
+        check_network<16, int, j::deque<int>>(rng, std::less<>());
+        check_network<32, double, j::deque<double>>(rng, std::greater<>());
+        check_network<8, long long, j::vector<long long>>(rng, [](long long a, long long b) { return a < b; });
+
+        std::vector<std::string> words = {"pear", "fig", "apple", "kiwi", "date", "lime", "plum", "bean"};
+        j::sort_network<8>(words.begin());
+        REQUIRE(std::is_sorted(words.begin(), words.end()));
+    }
+
+    SECTION("Without a comparator") {
+        j::vector<int> v = {5, -3, 8, 0, 7, 7, -9, 2};
+        j::sort_network<8>(v.begin());
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+    }
+}
@@ -0,0 +1,265 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+import j;
+
+constexpr size_t N = 1000000;
+constexpr size_t ROUND_TRIPS = 10000;
+constexpr size_t BATCH = 64;
+constexpr size_t MPMC_ITEMS = 200000;
+
+// j::queue guarded by a mutex, the baseline the concurrent queues replace
+template <class T> class locked_queue {
+    j::queue<T> _q;
+    std::mutex _m;
+
+  public:
+    void push(const T &x) {
+        std::lock_guard lock(_m);
+        _q.push(x);
+    }
+    bool try_pop(T &out) {
+        std::lock_guard lock(_m);
+        if (_q.empty())
+            return false;
+        out = _q.front();
+        _q.pop();
+        return true;
+    }
+};
+
+// j::priority_queue guarded by a mutex
+template <class T> class locked_priority_queue {
+    j::priority_queue<T> _pq;
+    std::mutex _m;
+
+  public:
+    void push(const T &x) {
+        std::lock_guard lock(_m);
+        _pq.push(x);
+    }
+    bool try_pop(T &out) {
+        std::lock_guard lock(_m);
+        if (_pq.empty())
+            return false;
+        out = _pq.top();
+        _pq.pop();
+        return true;
+    }
+};
+
+template <class Queue> size_t transfer(Queue &q) {
+    std::thread producer([&] {
+        for (size_t i = 0; i < N; ++i) {
+            q.push(i);
+        }
+    });
+    size_t sum = 0;
+    for (size_t i = 0; i < N; ++i) {
+        size_t value;
+        while (!q.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        sum += value;
+    }
+    producer.join();
+    return sum;
+}
+
+template <class Queue> size_t ping_pong(Queue &ping, Queue &pong) {
+    std::thread echo([&] {
+        for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+            size_t value;
+            while (!ping.try_pop(value)) {
+                std::this_thread::yield();
+            }
+            pong.push(value);
+        }
+    });
+    size_t sum = 0;
+    for (size_t i = 0; i < ROUND_TRIPS; ++i) {
+        ping.push(i);
+        size_t value;
+        while (!pong.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        sum += value;
+    }
+    echo.join();
+    return sum;
+}
+
+TEST_CASE("SPSC Queue Benchmarks: two-thread throughput") {
+    SECTION("Single element push/pop") {
+        BENCHMARK("j::spsc_queue push/try_pop") {
+            j::spsc_queue<size_t, 1024> q;
+            return transfer(q);
+        };
+
+        BENCHMARK("std::mutex + j::queue push/try_pop") {
+            locked_queue<size_t> q;
+            return transfer(q);
+        };
+    }
+
+    SECTION("Batched push_n/pop_n") {
+        BENCHMARK("j::spsc_queue push_n/pop_n") {
+            j::spsc_queue<size_t, 1024> q;
+            std::thread producer([&] {
+                std::vector<size_t> batch(BATCH);
+                for (size_t i = 0; i < N;) {
+                    const size_t count = std::min(BATCH, N - i);
+                    for (size_t k = 0; k < count; ++k) {
+                        batch[k] = i + k;
+                    }
+                    for (size_t sent = 0; sent < count;) {
+                        const size_t pushed = q.push_n(batch.begin() + sent, count - sent);
+                        if (pushed == 0)
+                            std::this_thread::yield();
+                        sent += pushed;
+                    }
+                    i += count;
+                }
+            });
+            std::vector<size_t> batch(BATCH);
+            size_t sum = 0;
+            for (size_t received = 0; received < N;) {
+                const size_t count = q.pop_n(batch.begin(), BATCH);
+                if (count == 0)
+                    std::this_thread::yield();
+                for (size_t k = 0; k < count; ++k) {
+                    sum += batch[k];
+                }
+                received += count;
+            }
+            producer.join();
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("SPSC Queue Benchmarks: round-trip latency") {
+    SECTION("Ping-pong between two threads") {
+        BENCHMARK("j::spsc_queue round trip") {
+            j::spsc_queue<size_t, 64> ping;
+            j::spsc_queue<size_t, 64> pong;
+            return ping_pong(ping, pong);
+        };
+
+        BENCHMARK("std::mutex + j::queue round trip") {
+            locked_queue<size_t> ping;
+            locked_queue<size_t> pong;
+            return ping_pong(ping, pong);
+        };
+    }
+}
+
+// p producers and p consumers move MPMC_ITEMS items in total
+template <class Queue> size_t fan_in_out(Queue &q, size_t p) {
+    std::vector<std::thread> threads;
+    std::vector<size_t> sums(p, 0);
+    for (size_t t = 0; t < p; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = t; i < MPMC_ITEMS; i += p) {
+                q.push(i);
+            }
+        });
+        threads.emplace_back([&, t] {
+            for (size_t i = t; i < MPMC_ITEMS; i += p) {
+                size_t value;
+                if constexpr (requires { q.pop(value); }) {
+                    q.pop(value); // blocking pop, sleeps on the slot for j::mpmc_queue<T, true>
+                } else {
+                    while (!q.try_pop(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+                sums[t] += value;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    size_t sum = 0;
+    for (size_t s : sums) {
+        sum += s;
+    }
+    return sum;
+}
+
+TEST_CASE("MPMC Queue Benchmarks: producer/consumer scaling") {
+    for (size_t p : {1, 2, 4, 8, 16, 32}) {
+        const std::string threads = std::to_string(p) + "P/" + std::to_string(p) + "C";
+        SECTION(threads) {
+            BENCHMARK("j::mpmc_queue " + threads) {
+                j::mpmc_queue<size_t> q(1024);
+                return fan_in_out(q, p);
+            };
+
+            BENCHMARK("j::mpmc_queue (sleep) " + threads) {
+                j::mpmc_queue<size_t, true> q(1024);
+                return fan_in_out(q, p);
+            };
+
+            BENCHMARK("std::mutex + j::queue " + threads) {
+                locked_queue<size_t> q;
+                return fan_in_out(q, p);
+            };
+        }
+    }
+}
+
+// every worker alternates push and pop of random deadlines, as a scheduler's worker threads do
+template <class Queue> size_t schedule(Queue &q, size_t workers) {
+    std::vector<std::thread> threads;
+    std::vector<size_t> sums(workers, 0);
+    for (size_t t = 0; t < workers; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 rng(static_cast<unsigned>(t));
+            for (size_t i = 0; i < MPMC_ITEMS / workers; ++i) {
+                q.push(rng() % 1000000);
+                size_t value;
+                if (q.try_pop(value))
+                    sums[t] += value;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    size_t sum = 0;
+    for (size_t s : sums) {
+        sum += s;
+    }
+    return sum;
+}
+
+TEST_CASE("Concurrent Priority Queue Benchmarks: worker scaling") {
+    for (size_t workers : {1, 2, 4, 8, 16, 32}) {
+        const std::string threads = std::to_string(workers) + " workers";
+        SECTION(threads) {
+            BENCHMARK("j::concurrent_priority_queue " + threads) {
+                j::concurrent_priority_queue<size_t> q(2 * workers);
+                return schedule(q, workers);
+            };
+
+            BENCHMARK("std::mutex + j::priority_queue " + threads) {
+                locked_priority_queue<size_t> q;
+                return schedule(q, workers);
+            };
+        }
+    }
+}
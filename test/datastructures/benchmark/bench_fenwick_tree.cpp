@@ -0,0 +1,159 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <catch2/catch_all.hpp>
+import j;
+
+constexpr std::size_t OPS = 1 << 16; // operations per benchmark run
+constexpr std::size_t SIZES[] = {1000, 100000, 10000000, 100000000};
+
+TEST_CASE("Fenwick Tree Benchmarks") {
+    for (std::size_t n : SIZES) {
+        SECTION("n = " + std::to_string(n)) {
+            std::mt19937_64 rng(1);
+            j::vector<std::size_t> indices;
+            j::vector<std::pair<std::size_t, std::size_t>> ranges; // [first, second], 1-based
+            for (std::size_t i = 0; i < OPS; ++i) {
+                indices.push_back(rng() % n + 1);
+                std::size_t l = rng() % n + 1, r = rng() % n + 1;
+                if (l > r) {
+                    std::swap(l, r);
+                }
+                ranges.emplace_back(l, r);
+            }
+            const j::vector<int> values(n, 1);
+            j::fenwick_tree<int> tree(values.begin(), values.end()); // built outside the timed region
+
+            BENCHMARK("j::fenwick_tree point update") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(indices[i], static_cast<int>(i & 1) * 2 - 1);
+                }
+                return tree.query(n);
+            };
+
+            j::vector<std::pair<std::size_t, int>> batch;
+            for (std::size_t i = 0; i < OPS; ++i) {
+                batch.emplace_back(indices[i], static_cast<int>(i & 1) * 2 - 1);
+            }
+            BENCHMARK("j::fenwick_tree batched point update") {
+                tree.update_many({batch.data(), batch.size()});
+                return tree.query(n);
+            };
+
+            BENCHMARK("j::fenwick_tree prefix query") {
+                long long sum = 0;
+                for (std::size_t i : indices) {
+                    sum += tree.query(i);
+                }
+                return sum;
+            };
+
+            BENCHMARK("j::fenwick_tree range query") {
+                long long sum = 0;
+                for (const auto &[l, r] : ranges) {
+                    sum += tree.query(l, r);
+                }
+                return sum;
+            };
+
+            BENCHMARK("j::fenwick_tree lower bound") {
+                std::size_t sum = 0;
+                for (std::size_t i : indices) {
+                    sum += tree.lower_bound(static_cast<int>(i));
+                }
+                return sum;
+            };
+        }
+    }
+}
+
+TEST_CASE("Fenwick Tree Build Benchmarks") {
+    // 100M takes seconds per run, so stop one size earlier
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2]}) {
+        SECTION("n = " + std::to_string(n)) {
+            const j::vector<int> values(n, 1);
+            j::fenwick_tree<int> tree(values.begin(), values.end());
+
+            BENCHMARK("j::fenwick_tree build") {
+                tree.assign(values.begin(), values.end());
+                return tree.query(n);
+            };
+
+            BENCHMARK("j::fenwick_tree parallel build") {
+                tree.assign(j::execution::par, values.begin(), values.end());
+                return tree.query(n);
+            };
+        }
+    }
+}
+
+TEST_CASE("Range Fenwick Tree Benchmarks") {
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2]}) { // two trees of long long: up to 10M elements
+        SECTION("n = " + std::to_string(n)) {
+            std::mt19937_64 rng(2);
+            j::vector<std::pair<std::size_t, std::size_t>> ranges; // [first, second], 1-based
+            for (std::size_t i = 0; i < OPS; ++i) {
+                std::size_t l = rng() % n + 1, r = rng() % n + 1;
+                if (l > r) {
+                    std::swap(l, r);
+                }
+                ranges.emplace_back(l, r);
+            }
+            const j::vector<long long> values(n, 1);
+            j::range_fenwick_tree<long long> tree(values.begin(), values.end());
+
+            BENCHMARK("j::range_fenwick_tree range add") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(ranges[i].first, ranges[i].second, static_cast<long long>(i & 1) * 2 - 1);
+                }
+                return tree.query(n);
+            };
+
+            BENCHMARK("j::range_fenwick_tree range query") {
+                long long sum = 0;
+                for (const auto &[l, r] : ranges) {
+                    sum += tree.query(l, r);
+                }
+                return sum;
+            };
+        }
+    }
+}
+
+TEST_CASE("Fenwick Tree 2D Benchmarks") {
+    for (std::size_t side : {100, 1000, 4000}) {
+        SECTION(std::to_string(side) + " x " + std::to_string(side)) {
+            std::mt19937_64 rng(3);
+            j::vector<std::size_t> cells; // row, col pairs, 1-based
+            for (std::size_t i = 0; i < 2 * OPS; ++i) {
+                cells.push_back(rng() % side + 1);
+            }
+            const j::vector<int> values(side * side, 1);
+            j::fenwick_tree_2d<int> tree(side, side, values.begin());
+
+            BENCHMARK("j::fenwick_tree_2d point update") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(cells[2 * i], cells[2 * i + 1], static_cast<int>(i & 1) * 2 - 1);
+                }
+                return tree.query(side, side);
+            };
+
+            BENCHMARK("j::fenwick_tree_2d prefix query") {
+                long long sum = 0;
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    sum += tree.query(cells[2 * i], cells[2 * i + 1]);
+                }
+                return sum;
+            };
+        }
+    }
+}
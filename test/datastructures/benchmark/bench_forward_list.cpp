@@ -9,6 +9,7 @@
 
 #include <forward_list>
 #include <algorithm>
+#include <memory>
 #include <random>
 #include <vector>
 #include <catch2/catch_all.hpp>
@@ -327,6 +328,39 @@ TEST_CASE("Forward List Benchmarks: Sort Operations") {
     }
 }
 
+TEST_CASE("Forward List Benchmarks: Large Sort") {
+    // 1M nodes: far beyond the caches, so the cost is dominated by pointer chasing during the merges
+    constexpr size_t LARGE_N = 1000000;
+    std::mt19937 large_gen(7);
+    std::vector<int> random_data(LARGE_N);
+    for (auto &v : random_data) v = static_cast<int>(large_gen());
+    std::vector<int> nearly_sorted(LARGE_N);
+    for (size_t i = 0; i < LARGE_N; ++i) nearly_sorted[i] = static_cast<int>(i);
+    for (size_t k = 0; k < LARGE_N / 100; ++k) {
+        std::swap(nearly_sorted[large_gen() % LARGE_N], nearly_sorted[large_gen() % LARGE_N]);
+    }
+
+    for (const auto *data : {&random_data, &nearly_sorted}) {
+        SECTION(data == &random_data ? "1M random" : "1M nearly sorted (1% swapped)") {
+            BENCHMARK_ADVANCED("j::forward_list sort")(Catch::Benchmark::Chronometer meter) {
+                std::vector<j::forward_list<int>> lists(meter.runs(), j::forward_list<int>(data->begin(), data->end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front();
+                });
+            };
+
+            BENCHMARK_ADVANCED("std::forward_list sort")(Catch::Benchmark::Chronometer meter) {
+                std::vector<std::forward_list<int>> lists(meter.runs(), std::forward_list<int>(data->begin(), data->end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front();
+                });
+            };
+        }
+    }
+}
+
 TEST_CASE("Forward List Benchmarks: Splice Operations") {
     SECTION("Splice after entire list") {
         BENCHMARK("j::forward_list splice_after entire") {
@@ -417,6 +451,68 @@ TEST_CASE("Forward List Benchmarks: Splice Operations") {
     }
 }
 
+TEST_CASE("Forward List Benchmarks: Chunk Chain") {
+    // an append-only chain of small chunks: the tracked policy appends at its tail pointer, while the
+    // untracked lists have to find the end of the chain (or of each chunk) by walking
+    using tracked_list = j::forward_list<int, std::allocator<int>, j::forward_list_tracked>;
+    constexpr size_t chunks = 1000;
+    constexpr size_t chunk_size = 16;
+
+    BENCHMARK("j::forward_list tracked push_back") {
+        tracked_list chain;
+        for (size_t i = 0; i < chunks * chunk_size; ++i) {
+            chain.push_back(static_cast<int>(i));
+        }
+        return chain.size();
+    };
+
+    BENCHMARK("j::forward_list tracked splice_after before_end") {
+        tracked_list chain;
+        for (size_t c = 0; c < chunks; ++c) {
+            tracked_list chunk;
+            for (size_t i = 0; i < chunk_size; ++i) {
+                chunk.push_back(static_cast<int>(c * chunk_size + i));
+            }
+            chain.splice_after(chain.before_end(), chunk);
+        }
+        return chain.size();
+    };
+
+    BENCHMARK("j::forward_list plain splice_after end") {
+        j::forward_list<int> chain;
+        auto tail = chain.before_begin();
+        for (size_t c = 0; c < chunks; ++c) {
+            j::forward_list<int> chunk;
+            auto it = chunk.before_begin();
+            for (size_t i = 0; i < chunk_size; ++i) {
+                it = chunk.insert_after(it, static_cast<int>(c * chunk_size + i));
+            }
+            chain.splice_after(tail, chunk);
+            while (std::next(tail) != chain.end()) {
+                ++tail;
+            }
+        }
+        return chain.front();
+    };
+
+    BENCHMARK("std::forward_list splice_after end") {
+        std::forward_list<int> chain;
+        auto tail = chain.before_begin();
+        for (size_t c = 0; c < chunks; ++c) {
+            std::forward_list<int> chunk;
+            auto it = chunk.before_begin();
+            for (size_t i = 0; i < chunk_size; ++i) {
+                it = chunk.insert_after(it, static_cast<int>(c * chunk_size + i));
+            }
+            chain.splice_after(tail, chunk);
+            while (std::next(tail) != chain.end()) {
+                ++tail;
+            }
+        }
+        return chain.front();
+    };
+}
+
 TEST_CASE("Forward List Benchmarks: Merge Operations") {
     SECTION("Merge sorted lists") {
         BENCHMARK("j::forward_list merge") {
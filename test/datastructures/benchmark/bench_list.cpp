@@ -333,6 +333,74 @@ TEST_CASE("List Benchmarks: Sort Operations") {
     }
 }
 
+// too wide for the gather path, so j::list sorts these with the bin-array merge sort over the nodes
+struct large_sort_record {
+    int key;
+    int payload[4];
+
+    bool operator<(const large_sort_record &other) const {
+        return key < other.key;
+    }
+};
+static_assert(sizeof(large_sort_record) > 2 * sizeof(void *));
+
+TEST_CASE("List Benchmarks: Large Sort") {
+    // 1M nodes: far beyond the caches. int lists are sorted through a contiguous buffer (radix sort for the standard
+    // orderings); the record lists relink nodes, where the cost is dominated by pointer chasing during the merges
+    constexpr size_t LARGE_N = 1000000;
+    std::mt19937 large_gen(7);
+    std::vector<int> random_data(LARGE_N);
+    for (auto &v : random_data) v = static_cast<int>(large_gen());
+    std::vector<int> nearly_sorted(LARGE_N);
+    for (size_t i = 0; i < LARGE_N; ++i) nearly_sorted[i] = static_cast<int>(i);
+    for (size_t k = 0; k < LARGE_N / 100; ++k) {
+        std::swap(nearly_sorted[large_gen() % LARGE_N], nearly_sorted[large_gen() % LARGE_N]);
+    }
+
+    for (const auto *data : {&random_data, &nearly_sorted}) {
+        SECTION(data == &random_data ? "1M random" : "1M nearly sorted (1% swapped)") {
+            BENCHMARK_ADVANCED("j::list sort (gather path)")(Catch::Benchmark::Chronometer meter) {
+                std::vector<j::list<int>> lists(meter.runs(), j::list<int>(data->begin(), data->end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front();
+                });
+            };
+
+            BENCHMARK_ADVANCED("std::list sort")(Catch::Benchmark::Chronometer meter) {
+                std::vector<std::list<int>> lists(meter.runs(), std::list<int>(data->begin(), data->end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front();
+                });
+            };
+
+            std::vector<large_sort_record> records(data->size());
+            for (size_t i = 0; i < records.size(); ++i) {
+                records[i] = {(*data)[i], {static_cast<int>(i)}};
+            }
+
+            BENCHMARK_ADVANCED("j::list sort (merge sort, 20-byte records)")(Catch::Benchmark::Chronometer meter) {
+                std::vector<j::list<large_sort_record>> lists(
+                    meter.runs(), j::list<large_sort_record>(records.begin(), records.end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front().key;
+                });
+            };
+
+            BENCHMARK_ADVANCED("std::list sort (20-byte records)")(Catch::Benchmark::Chronometer meter) {
+                std::vector<std::list<large_sort_record>> lists(
+                    meter.runs(), std::list<large_sort_record>(records.begin(), records.end()));
+                meter.measure([&](int i) {
+                    lists[i].sort();
+                    return lists[i].front().key;
+                });
+            };
+        }
+    }
+}
+
 TEST_CASE("List Benchmarks: Splice Operations") {
     SECTION("Splice entire list") {
         BENCHMARK("j::list splice entire") {
@@ -610,3 +678,92 @@ TEST_CASE("List Benchmarks: Memory Operations") {
         };
     }
 }
+
+TEST_CASE("List Benchmarks: Unrolled List") {
+    // sorting random values scatters the nodes of the node-per-element lists across the heap, as in long-lived lists
+    constexpr size_t LARGE_N = 1000000;
+    std::mt19937 large_gen(11);
+    std::vector<int> data(LARGE_N);
+    for (auto &v : data) v = static_cast<int>(large_gen() % 1000000);
+
+    SECTION("Iterate 1M elements") {
+        j::list<int> j_lst(data.begin(), data.end());
+        std::list<int> std_lst(data.begin(), data.end());
+        j::unrolled_list<int> unrolled(data.begin(), data.end());
+        j_lst.sort(std::greater<int>());
+        std_lst.sort(std::greater<int>());
+        unrolled.sort(std::greater<int>());
+
+        BENCHMARK("j::list iterate") {
+            long long sum = 0;
+            for (int v : j_lst) sum += v;
+            return sum;
+        };
+
+        BENCHMARK("std::list iterate") {
+            long long sum = 0;
+            for (int v : std_lst) sum += v;
+            return sum;
+        };
+
+        BENCHMARK("j::unrolled_list iterate") {
+            long long sum = 0;
+            for (int v : unrolled) sum += v;
+            return sum;
+        };
+    }
+
+    // walk to the middle of 100k elements, then insert 10k elements there
+    constexpr size_t MID_N = 100000;
+    SECTION("Insert in the middle") {
+        BENCHMARK("j::list insert middle") {
+            j::list<int> lst(data.begin(), data.begin() + MID_N);
+            auto it = std::next(lst.begin(), MID_N / 2);
+            for (size_t i = 0; i < MID_N / 10; ++i) it = lst.insert(it, static_cast<int>(i));
+            return lst.size();
+        };
+
+        BENCHMARK("std::list insert middle") {
+            std::list<int> lst(data.begin(), data.begin() + MID_N);
+            auto it = std::next(lst.begin(), MID_N / 2);
+            for (size_t i = 0; i < MID_N / 10; ++i) it = lst.insert(it, static_cast<int>(i));
+            return lst.size();
+        };
+
+        BENCHMARK("j::unrolled_list insert middle") {
+            j::unrolled_list<int> lst(data.begin(), data.begin() + MID_N);
+            auto it = std::next(lst.begin(), MID_N / 2);
+            for (size_t i = 0; i < MID_N / 10; ++i) it = lst.insert(it, static_cast<int>(i));
+            return lst.size();
+        };
+    }
+
+    SECTION("Erase every other element") {
+        BENCHMARK("j::list erase alternate") {
+            j::list<int> lst(data.begin(), data.begin() + MID_N);
+            for (auto it = lst.begin(); it != lst.end();) {
+                it = lst.erase(it);
+                if (it != lst.end()) ++it;
+            }
+            return lst.size();
+        };
+
+        BENCHMARK("std::list erase alternate") {
+            std::list<int> lst(data.begin(), data.begin() + MID_N);
+            for (auto it = lst.begin(); it != lst.end();) {
+                it = lst.erase(it);
+                if (it != lst.end()) ++it;
+            }
+            return lst.size();
+        };
+
+        BENCHMARK("j::unrolled_list erase alternate") {
+            j::unrolled_list<int> lst(data.begin(), data.begin() + MID_N);
+            for (auto it = lst.begin(); it != lst.end();) {
+                it = lst.erase(it);
+                if (it != lst.end()) ++it;
+            }
+            return lst.size();
+        };
+    }
+}
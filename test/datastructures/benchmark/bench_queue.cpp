@@ -11,6 +11,12 @@
 #include <random>
 #include <queue>
 #include <algorithm>
+#include <iterator>
+#include <string>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
 
 import j;
 
@@ -518,3 +524,227 @@ TEST_CASE("Priority Queue Benchmarks: Different Orders") {
         };
     }
 }
+
+// d-ary heaps: make_heap cost, and steady-state pop + push on a heap of a given size
+// (every pop/push pair keeps the size constant, so only the sift depth depends on n)
+constexpr size_t HEAP_OPS = 10000;
+
+template <size_t Arity> void bench_dary_make_heap(size_t n) {
+    std::vector<int> data(n);
+    for (auto &x : data) x = dis(gen);
+    BENCHMARK(std::to_string(Arity) + "-ary make_heap n=" + std::to_string(n)) {
+        j::vector<int> v(data.begin(), data.end());
+        j::make_heap<Arity>(v.begin(), v.end());
+        return v.front();
+    };
+}
+
+template <size_t Arity> void bench_dary_pop_push(size_t n) {
+    j::vector<int> v(n);
+    for (auto &x : v) x = dis(gen);
+    j::make_heap<Arity>(v.begin(), v.end());
+    BENCHMARK(std::to_string(Arity) + "-ary pop+push n=" + std::to_string(n)) {
+        size_t sum = 0;
+        for (size_t i = 0; i < HEAP_OPS; ++i) {
+            j::pop_heap<Arity>(v.begin(), v.end());
+            sum += v.back();
+            v.back() = dis(gen);
+            j::push_heap<Arity>(v.begin(), v.end());
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("D-ary Heap Benchmarks: make_heap") {
+    for (size_t n : {size_t{1'000}, size_t{100'000}, size_t{10'000'000}, size_t{100'000'000}}) {
+        SECTION("n = " + std::to_string(n)) {
+            bench_dary_make_heap<2>(n);
+            bench_dary_make_heap<4>(n);
+            bench_dary_make_heap<8>(n);
+        }
+    }
+}
+
+TEST_CASE("D-ary Heap Benchmarks: pop/push") {
+    for (size_t n : {size_t{1'000}, size_t{100'000}, size_t{10'000'000}, size_t{100'000'000}}) {
+        SECTION("n = " + std::to_string(n)) {
+            bench_dary_pop_push<2>(n);
+            bench_dary_pop_push<4>(n);
+            bench_dary_pop_push<8>(n);
+        }
+    }
+}
+
+TEST_CASE("D-ary Heap Benchmarks: priority_queue arity policy") {
+    SECTION("push/pop N elements") {
+        BENCHMARK("j::priority_queue 2-ary") {
+            j::priority_queue<int, j::vector<int>, std::less<int>, 2> pq;
+            for (size_t i = 0; i < N; ++i) {
+                pq.push(dis(gen));
+            }
+            size_t sum = 0;
+            while (!pq.empty()) {
+                sum += pq.top();
+                pq.pop();
+            }
+            return sum;
+        };
+
+        BENCHMARK("j::priority_queue 4-ary") {
+            j::priority_queue<int, j::vector<int>, std::less<int>, 4> pq;
+            for (size_t i = 0; i < N; ++i) {
+                pq.push(dis(gen));
+            }
+            size_t sum = 0;
+            while (!pq.empty()) {
+                sum += pq.top();
+                pq.pop();
+            }
+            return sum;
+        };
+
+        BENCHMARK("j::priority_queue 8-ary") {
+            j::priority_queue<int, j::vector<int>, std::less<int>, 8> pq;
+            for (size_t i = 0; i < N; ++i) {
+                pq.push(dis(gen));
+            }
+            size_t sum = 0;
+            while (!pq.empty()) {
+                sum += pq.top();
+                pq.pop();
+            }
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("Heap Batch Benchmarks: expensive comparator pop") {
+    SECTION("heap sort of std::string") {
+        std::vector<std::string> data(N);
+        for (auto &x : data) x = "key-" + std::to_string(dis(gen)) + "-" + std::to_string(dis(gen));
+
+        BENCHMARK("j::pop_heap (bottom-up) strings") {
+            std::vector<std::string> v = data;
+            j::make_heap(v.begin(), v.end());
+            for (auto last = v.end(); last != v.begin(); --last) {
+                j::pop_heap(v.begin(), last);
+            }
+            return v.front().size();
+        };
+
+        BENCHMARK("std::pop_heap strings") {
+            std::vector<std::string> v = data;
+            std::make_heap(v.begin(), v.end());
+            for (auto last = v.end(); last != v.begin(); --last) {
+                std::pop_heap(v.begin(), last);
+            }
+            return v.front().size();
+        };
+    }
+}
+
+TEST_CASE("Heap Batch Benchmarks: push_range / pop_n") {
+    std::vector<int> batch(N);
+    for (auto &x : batch) x = dis(gen);
+
+    SECTION("insert N elements into a heap of N") {
+        BENCHMARK("j::priority_queue push loop") {
+            j::priority_queue<int> pq(batch.begin(), batch.end());
+            for (int x : batch) {
+                pq.push(x);
+            }
+            return pq.size();
+        };
+
+        BENCHMARK("j::priority_queue push_range") {
+            j::priority_queue<int> pq(batch.begin(), batch.end());
+            pq.push_range(batch);
+            return pq.size();
+        };
+    }
+
+    SECTION("extract top N / 10") {
+        BENCHMARK("j::priority_queue top/pop loop") {
+            j::priority_queue<int> pq(batch.begin(), batch.end());
+            j::vector<int> out;
+            for (size_t i = 0; i < N / 10; ++i) {
+                out.push_back(pq.top());
+                pq.pop();
+            }
+            return out.size();
+        };
+
+        BENCHMARK("j::priority_queue pop_n") {
+            j::priority_queue<int> pq(batch.begin(), batch.end());
+            j::vector<int> out;
+            pq.pop_n(std::back_inserter(out), N / 10);
+            return out.size();
+        };
+    }
+}
+
+// random directed graph with non-negative weights for the Dijkstra benchmarks
+std::vector<std::vector<std::pair<uint32_t, uint32_t>>> dijkstra_graph(uint32_t vertices, uint32_t edges) {
+    std::mt19937 rng(42);
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> g(vertices);
+    for (uint32_t e = 0; e < edges; ++e) {
+        g[rng() % vertices].emplace_back(rng() % vertices, rng() % 1000);
+    }
+    return g;
+}
+
+TEST_CASE("Indexed Priority Queue Benchmarks: Dijkstra") {
+    for (uint32_t vertices : {10000u, 100000u}) {
+        const auto g = dijkstra_graph(vertices, 8 * vertices);
+        SECTION("V = " + std::to_string(vertices) + ", E = 8V") {
+            BENCHMARK("j::priority_queue (lazy deletion)") {
+                std::vector<uint64_t> dist(g.size(), std::numeric_limits<uint64_t>::max());
+                j::priority_queue<std::pair<uint64_t, uint32_t>, j::vector<std::pair<uint64_t, uint32_t>>,
+                                  std::greater<std::pair<uint64_t, uint32_t>>>
+                    pq;
+                dist[0] = 0;
+                pq.emplace(0, 0);
+                while (!pq.empty()) {
+                    auto [d, u] = pq.top();
+                    pq.pop();
+                    if (d != dist[u])
+                        continue;
+                    for (auto [v, w] : g[u]) {
+                        if (d + w < dist[v]) {
+                            dist[v] = d + w;
+                            pq.emplace(dist[v], v);
+                        }
+                    }
+                }
+                return dist.back();
+            };
+
+            auto decrease_key = [&](auto &pq) {
+                std::vector<uint64_t> dist(g.size(), std::numeric_limits<uint64_t>::max());
+                dist[0] = 0;
+                pq.update(0, 0);
+                while (!pq.empty()) {
+                    auto [u, d] = pq.top();
+                    pq.pop();
+                    for (auto [v, w] : g[u]) {
+                        if (d + w < dist[v]) {
+                            dist[v] = d + w;
+                            pq.update(v, dist[v]);
+                        }
+                    }
+                }
+                return dist.back();
+            };
+
+            BENCHMARK("j::indexed_priority_queue 4-ary (decrease-key)") {
+                j::indexed_priority_queue<uint32_t, uint64_t, std::greater<uint64_t>> pq(g.size());
+                return decrease_key(pq);
+            };
+
+            BENCHMARK("j::indexed_radix_heap (decrease-key)") {
+                j::indexed_radix_heap<uint32_t, uint64_t> pq(g.size());
+                return decrease_key(pq);
+            };
+        }
+    }
+}
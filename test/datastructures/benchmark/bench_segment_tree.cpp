@@ -0,0 +1,267 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <catch2/catch_all.hpp>
+import j;
+
+constexpr std::size_t OPS = 1 << 16; // operations per benchmark run
+constexpr std::size_t SIZES[] = {1000, 100000, 1000000, 10000000, 100000000};
+
+struct workload {
+    j::vector<std::size_t> positions;
+    j::vector<std::pair<std::size_t, std::size_t>> ranges; // [first, second)
+    j::vector<int> values;
+};
+
+workload make_workload(std::size_t n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    workload w;
+    for (std::size_t i = 0; i < OPS; ++i) {
+        w.positions.push_back(rng() % n);
+        std::size_t l = rng() % n, r = rng() % n;
+        if (l > r) {
+            std::swap(l, r);
+        }
+        w.ranges.emplace_back(l, r + 1);
+        w.values.push_back(static_cast<int>(rng() % 1000));
+    }
+    return w;
+}
+
+template <class Tree> void point_update_and_range_query(const std::string &name, std::size_t n) {
+    const workload w = make_workload(n, 1);
+    Tree tree(n); // built outside the timed region
+
+    BENCHMARK(name + " point update") {
+        for (std::size_t i = 0; i < OPS; ++i) {
+            tree.update(w.positions[i], w.values[i]);
+        }
+        return tree.query(0);
+    };
+
+    j::vector<std::pair<std::size_t, int>> batch;
+    for (std::size_t i = 0; i < OPS; ++i) {
+        batch.emplace_back(w.positions[i], w.values[i]);
+    }
+    BENCHMARK(name + " batched point update") {
+        tree.update_many({batch.data(), batch.size()});
+        return tree.query(0);
+    };
+
+    BENCHMARK(name + " range query") {
+        std::size_t sum = 0;
+        for (const auto &[l, r] : w.ranges) {
+            sum += tree.query(l, r);
+        }
+        return sum;
+    };
+
+    BENCHMARK(name + " batched range query") {
+        std::size_t sum = 0;
+        for (int value : tree.query_many({w.ranges.data(), w.ranges.size()})) {
+            sum += value;
+        }
+        return sum;
+    };
+}
+
+template <class Operator> using binary_tree = j::segment_tree<int, std::allocator<int>, Operator>;
+template <class Operator>
+using wide_tree = j::segment_tree<int, std::allocator<int>, Operator, j::segment_tree_wide<>>;
+
+TEST_CASE("Segment Tree Benchmarks") {
+    for (std::size_t n : SIZES) {
+        SECTION("n = " + std::to_string(n)) {
+            SECTION("plus, binary layout") {
+                point_update_and_range_query<binary_tree<j::plus<int>>>("j::segment_tree<plus>", n);
+            }
+            SECTION("plus, wide layout") {
+                point_update_and_range_query<wide_tree<j::plus<int>>>("j::segment_tree<plus, wide>", n);
+            }
+            SECTION("max, binary layout") {
+                point_update_and_range_query<binary_tree<j::max<int>>>("j::segment_tree<max>", n);
+            }
+            SECTION("max, wide layout") {
+                point_update_and_range_query<wide_tree<j::max<int>>>("j::segment_tree<max, wide>", n);
+            }
+        }
+    }
+}
+
+TEST_CASE("Segment Tree Build Benchmarks") {
+    // 100M takes seconds per run, so stop one size earlier
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2], SIZES[3]}) {
+        SECTION("n = " + std::to_string(n)) {
+            const j::vector<int> values(n, 1);
+            binary_tree<j::plus<int>> binary(n);
+            wide_tree<j::plus<int>> wide(n);
+
+            BENCHMARK("j::segment_tree<plus> build") {
+                binary.assign(values.begin(), values.end());
+                return binary.query(0);
+            };
+
+            BENCHMARK("j::segment_tree<plus> parallel build") {
+                binary.assign(j::execution::par, values.begin(), values.end());
+                return binary.query(0);
+            };
+
+            BENCHMARK("j::segment_tree<plus, wide> build") {
+                wide.assign(values.begin(), values.end());
+                return wide.query(0);
+            };
+
+            BENCHMARK("j::segment_tree<plus, wide> parallel build") {
+                wide.assign(j::execution::par, values.begin(), values.end());
+                return wide.query(0);
+            };
+        }
+    }
+}
+
+TEST_CASE("Lazy Segment Tree Benchmarks") {
+    // the lazy tree keeps a power-of-two leaf array plus pending values, so stop one size earlier
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2], SIZES[3]}) {
+        SECTION("n = " + std::to_string(n)) {
+            const workload w = make_workload(n, 2);
+            j::lazy_segment_tree<int> tree(n);
+
+            BENCHMARK("j::lazy_segment_tree point update") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(w.positions[i], w.values[i]);
+                }
+                return tree.query(0);
+            };
+
+            BENCHMARK("j::lazy_segment_tree range add") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(w.ranges[i].first, w.ranges[i].second - 1, w.values[i] & 1);
+                }
+                return tree.query(0);
+            };
+
+            BENCHMARK("j::lazy_segment_tree range query") {
+                std::size_t sum = 0;
+                for (const auto &[l, r] : w.ranges) {
+                    sum += tree.query(l, r - 1);
+                }
+                return sum;
+            };
+        }
+    }
+}
+
+TEST_CASE("Persistent Segment Tree Benchmarks") {
+    // every run adds OPS versions, collected again at its end; the collection marks the whole pool
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2]}) {
+        SECTION("n = " + std::to_string(n)) {
+            const workload w = make_workload(n, 3);
+            j::persistent_segment_tree<int> tree(n);
+            const auto initial = tree.initial();
+            j::vector<j::persistent_segment_tree<int>::version> versions = {initial};
+            for (std::size_t i = 0; i < OPS; ++i) {
+                versions.push_back(tree.update(versions.back(), w.positions[i], w.values[i]));
+            }
+
+            BENCHMARK("j::persistent_segment_tree historical range query") {
+                std::size_t sum = 0;
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    sum += tree.query(versions[w.positions[i] % versions.size()], w.ranges[i].first,
+                                      w.ranges[i].second);
+                }
+                return sum;
+            };
+
+            tree.collect({&initial, 1});
+            BENCHMARK("j::persistent_segment_tree update and collect") {
+                auto version = initial;
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    version = tree.update(version, w.positions[i], w.values[i]);
+                }
+                const int sum = tree.query(version, 0, n);
+                tree.collect({&initial, 1});
+                return sum;
+            };
+        }
+    }
+}
+
+TEST_CASE("Dynamic Segment Tree Benchmarks") {
+    // the domain is far wider than any array, so only the nodes on the touched paths exist
+    for (std::size_t n : {SIZES[2], std::size_t{1} << 40, std::size_t{1} << 62}) {
+        SECTION("n = " + std::to_string(n)) {
+            const workload w = make_workload(n, 4);
+            j::dynamic_segment_tree<long long> tree(0, static_cast<long long>(n - 1));
+
+            BENCHMARK("j::dynamic_segment_tree range update") {
+                for (std::size_t i = 0; i < OPS; ++i) {
+                    tree.update(static_cast<long long>(w.ranges[i].first),
+                                static_cast<long long>(w.ranges[i].second - 1), w.values[i]);
+                }
+                return tree.node_count();
+            };
+
+            BENCHMARK("j::dynamic_segment_tree range query") {
+                long long sum = 0;
+                for (const auto &[l, r] : w.ranges) {
+                    sum += tree.query(static_cast<long long>(l), static_cast<long long>(r - 1));
+                }
+                return sum;
+            };
+        }
+    }
+}
+
+TEST_CASE("Sparse Table Benchmarks") {
+    // O(n log n) memory, so the sizes stop where the levels still fit comfortably
+    for (std::size_t n : {SIZES[0], SIZES[1], SIZES[2], SIZES[3]}) {
+        SECTION("n = " + std::to_string(n)) {
+            const workload w = make_workload(n, 5);
+            j::vector<int> values(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                values[i] = static_cast<int>(w.values[i % OPS]);
+            }
+            const j::sparse_table<int> table(values.begin(), values.end());
+            const j::disjoint_sparse_table<int> disjoint(values.begin(), values.end());
+            j::segment_tree<int, std::allocator<int>, j::min<int>> tree(values.begin(), values.end());
+
+            BENCHMARK("j::sparse_table build") {
+                return j::sparse_table<int>(values.begin(), values.end()).size();
+            };
+
+            BENCHMARK("j::sparse_table range min") {
+                long long sum = 0;
+                for (const auto &[l, r] : w.ranges) {
+                    sum += table.query(l, r);
+                }
+                return sum;
+            };
+
+            BENCHMARK("j::segment_tree range min") {
+                long long sum = 0;
+                for (const auto &[l, r] : w.ranges) {
+                    sum += tree.query(l, r);
+                }
+                return sum;
+            };
+
+            BENCHMARK("j::disjoint_sparse_table range sum") {
+                long long sum = 0;
+                for (const auto &[l, r] : w.ranges) {
+                    sum += disjoint.query(l, r);
+                }
+                return sum;
+            };
+        }
+    }
+}
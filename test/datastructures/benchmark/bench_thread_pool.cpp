@@ -0,0 +1,156 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+import j;
+
+constexpr size_t TASKS = 100000;
+constexpr size_t INDICES = 1000000;
+constexpr size_t DEQUE_ITEMS = 1000000;
+
+// one mutex-guarded j::deque per worker, the design the lock-free deques replace
+class locked_deque {
+    j::deque<size_t> _d;
+    std::mutex _m;
+
+  public:
+    void push(size_t x) {
+        std::lock_guard lock(_m);
+        _d.push_back(x);
+    }
+    bool try_pop(size_t &out) {
+        std::lock_guard lock(_m);
+        if (_d.empty())
+            return false;
+        out = _d.back();
+        _d.pop_back();
+        return true;
+    }
+    bool try_steal(size_t &out) {
+        std::lock_guard lock(_m);
+        if (_d.empty())
+            return false;
+        out = _d.front();
+        _d.pop_front();
+        return true;
+    }
+};
+
+// the owner pushes and pops DEQUE_ITEMS items while thief_count threads steal
+template <class Deque> size_t owner_and_thieves(Deque &d, size_t thief_count) {
+    std::atomic<bool> done{false};
+    std::vector<size_t> sums(thief_count + 1, 0);
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < thief_count; ++t) {
+        thieves.emplace_back([&, t] {
+            size_t value;
+            while (!done.load(std::memory_order_acquire)) {
+                if (d.try_steal(value))
+                    sums[t + 1] += value;
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+    size_t value;
+    for (size_t i = 0; i < DEQUE_ITEMS; ++i) {
+        d.push(i);
+        if (i % 2 == 0 && d.try_pop(value))
+            sums[0] += value;
+    }
+    while (d.try_pop(value)) {
+        sums[0] += value;
+    }
+    done.store(true, std::memory_order_release);
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+    size_t sum = 0;
+    for (size_t s : sums) {
+        sum += s;
+    }
+    return sum;
+}
+
+TEST_CASE("Work Stealing Deque Benchmarks: owner and thieves") {
+    for (size_t thieves : {0, 1, 3}) {
+        SECTION(std::to_string(thieves) + " thieves") {
+            BENCHMARK("j::work_stealing_deque") {
+                j::work_stealing_deque<size_t> d;
+                return owner_and_thieves(d, thieves);
+            };
+
+            BENCHMARK("std::mutex + j::deque") {
+                locked_deque d;
+                return owner_and_thieves(d, thieves);
+            };
+        }
+    }
+}
+
+TEST_CASE("Thread Pool Benchmarks: spawn throughput") {
+    for (size_t workers : {1, 2, 4, 8, 16, 32, 64}) {
+        SECTION(std::to_string(workers) + " workers") {
+            j::thread_pool pool(workers);
+
+            BENCHMARK("submit_then empty tasks") {
+                std::atomic<size_t> done{0};
+                bool finished = false; // set under m, so the waiter cannot return while the last callback holds it
+                std::mutex m;
+                std::condition_variable cv;
+                for (size_t i = 0; i < TASKS; ++i) {
+                    pool.submit_then([] {}, [&] {
+                        if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == TASKS) {
+                            std::lock_guard lock(m);
+                            finished = true;
+                            cv.notify_one();
+                        }
+                    });
+                }
+                std::unique_lock lock(m);
+                cv.wait(lock, [&] { return finished; });
+                return done.load();
+            };
+
+            BENCHMARK("parallel_for grain 1") {
+                std::atomic<size_t> sum{0};
+                pool.parallel_for(size_t(0), INDICES, [&](size_t i) {
+                    if (i % 1024 == 0)
+                        sum.fetch_add(i, std::memory_order_relaxed);
+                }, 1);
+                return sum.load();
+            };
+
+            BENCHMARK("parallel_for default grain") {
+                std::atomic<size_t> sum{0};
+                pool.parallel_for(size_t(0), INDICES, [&](size_t i) {
+                    if (i % 1024 == 0)
+                        sum.fetch_add(i, std::memory_order_relaxed);
+                });
+                return sum.load();
+            };
+
+            BENCHMARK("nested parallel_for") {
+                std::atomic<size_t> sum{0};
+                pool.parallel_for(size_t(0), size_t(1000), [&](size_t) {
+                    pool.parallel_for(size_t(0), size_t(1000), [&](size_t i) {
+                        if (i == 0)
+                            sum.fetch_add(1, std::memory_order_relaxed);
+                    });
+                }, 1);
+                return sum.load();
+            };
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+import j;
+
+constexpr size_t N = 1000000;
+constexpr std::uint64_t HORIZON = 30000; // timeouts up to 30 s at 1 ms ticks
+
+// the usual network-server pattern: every tick a batch of timeouts is armed, most are cancelled before expiring
+// (the request completed), and the rest expire
+TEST_CASE("Timer Wheel Benchmarks: arm/cancel/expire") {
+    std::mt19937_64 rng(42);
+    std::vector<std::uint64_t> timeouts(N);
+    for (auto &t : timeouts) t = 1 + rng() % HORIZON;
+
+    for (size_t per_tick : {10, 100, 1000}) {
+        SECTION(std::to_string(per_tick) + " timers per tick, 90% cancelled") {
+            BENCHMARK("j::timer_wheel") {
+                j::timer_wheel<std::uint64_t> wheel;
+                std::vector<j::timer_wheel<std::uint64_t>::handle> handles;
+                handles.reserve(per_tick);
+                std::uint64_t expired = 0;
+                for (size_t i = 0; i < N;) {
+                    handles.clear();
+                    for (size_t k = 0; k < per_tick && i < N; ++k, ++i) {
+                        handles.push_back(wheel.insert(wheel.now() + timeouts[i], i));
+                    }
+                    for (size_t k = 0; k < handles.size(); ++k) {
+                        if (k % 10 != 0)
+                            wheel.cancel(handles[k]);
+                    }
+                    wheel.advance(wheel.now() + 1, [&](std::uint64_t &id) { expired += id; });
+                }
+                wheel.advance(wheel.now() + HORIZON, [&](std::uint64_t &id) { expired += id; });
+                return expired;
+            };
+
+            BENCHMARK("j::priority_queue of deadlines (lazy cancel)") {
+                using entry = std::pair<std::uint64_t, std::uint64_t>; // (deadline, id)
+                j::priority_queue<entry, j::vector<entry>, std::greater<entry>> pq;
+                std::vector<bool> cancelled(N, false);
+                std::uint64_t now = 0;
+                std::uint64_t expired = 0;
+                auto expire = [&](std::uint64_t until) {
+                    while (!pq.empty() && pq.top().first <= until) {
+                        if (!cancelled[pq.top().second])
+                            expired += pq.top().second;
+                        pq.pop();
+                    }
+                };
+                for (size_t i = 0; i < N;) {
+                    const size_t first = i;
+                    for (size_t k = 0; k < per_tick && i < N; ++k, ++i) {
+                        pq.emplace(now + timeouts[i], i);
+                    }
+                    for (size_t id = first; id < i; ++id) {
+                        if ((id - first) % 10 != 0)
+                            cancelled[id] = true;
+                    }
+                    expire(++now);
+                }
+                expire(now + HORIZON);
+                return expired;
+            };
+        }
+    }
+}
+
+TEST_CASE("Timer Wheel Benchmarks: sparse expiry") {
+    SECTION("1000 timers spread over 2^30 ticks, advanced in one call") {
+        std::mt19937_64 rng(7);
+        std::vector<std::uint64_t> deadlines(1000);
+        for (auto &d : deadlines) d = rng() % (std::uint64_t{1} << 30);
+
+        BENCHMARK("j::timer_wheel advance") {
+            j::timer_wheel<std::uint64_t> wheel;
+            for (std::uint64_t d : deadlines) {
+                wheel.insert(d, d);
+            }
+            std::uint64_t sum = 0;
+            wheel.advance(std::uint64_t{1} << 30, [&](std::uint64_t &d) { sum += d; });
+            return sum;
+        };
+    }
+}
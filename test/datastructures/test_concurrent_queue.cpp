@@ -0,0 +1,395 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+import j;
+
+constexpr size_t N = 100000;
+
+TEST_CASE("SPSC Queue Basic") {
+    SECTION("Push/Pop/Front") {
+        j::spsc_queue<int, 8> q;
+        REQUIRE(q.empty());
+        REQUIRE(q.size() == 0);
+        REQUIRE(q.capacity() == 8);
+
+        q.push(1);
+        q.emplace(2);
+        int x = 3;
+        q.push(x);
+        REQUIRE(q.size() == 3);
+        REQUIRE(q.front() == 1);
+        q.pop();
+        REQUIRE(q.front() == 2);
+        q.pop();
+        REQUIRE(q.front() == 3);
+        q.pop();
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Full and empty") {
+        j::spsc_queue<int, 4> q;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(q.try_push(i));
+        }
+        REQUIRE_FALSE(q.try_push(4));
+        REQUIRE(q.size() == 4);
+
+        int out = -1;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(q.try_pop(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE_FALSE(q.try_pop(out));
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Wrap around") {
+        j::spsc_queue<int, 4> q;
+        for (int round = 0; round < 10; ++round) {
+            REQUIRE(q.try_push(round * 2));
+            REQUIRE(q.try_emplace(round * 2 + 1));
+            REQUIRE(q.front() == round * 2);
+            q.pop();
+            REQUIRE(q.front() == round * 2 + 1);
+            q.pop();
+        }
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Batched push_n/pop_n") {
+        j::spsc_queue<int, 8> q;
+        std::vector<int> in = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        REQUIRE(q.push_n(in.begin(), in.size()) == 8);
+        REQUIRE(q.size() == 8);
+
+        std::vector<int> out(10, -1);
+        REQUIRE(q.pop_n(out.begin(), 5) == 5);
+        REQUIRE(q.push_n(in.begin() + 8, 2) == 2);
+        REQUIRE(q.pop_n(out.begin() + 5, 10) == 5);
+        REQUIRE(out == in);
+        REQUIRE(q.pop_n(out.begin(), 1) == 0);
+    }
+
+    SECTION("Non-trivial type") {
+        j::spsc_queue<std::string, 4> q;
+        q.push(std::string(100, 'a'));
+        q.emplace(50, 'b');
+        REQUIRE(q.front() == std::string(100, 'a'));
+        q.pop();
+        std::string out;
+        REQUIRE(q.try_pop(out));
+        REQUIRE(out == std::string(50, 'b'));
+        q.emplace("left in queue");
+        q.emplace("destroyed by destructor");
+    }
+
+    SECTION("Throwing construction and moves do not stall the queue") {
+        static int live = 0;
+        struct fragile {
+            int value = 0;
+            fragile() {
+                ++live;
+            }
+            explicit fragile(int v) : value(v) {
+                if (v < 0)
+                    throw std::runtime_error("construct");
+                ++live;
+            }
+            fragile(const fragile &) = delete;
+            fragile &operator=(fragile &&other) {
+                if (other.value >= 1000)
+                    throw std::runtime_error("move");
+                value = other.value;
+                return *this;
+            }
+            ~fragile() {
+                --live;
+            }
+        };
+        {
+            j::mpmc_queue<fragile> q(4);
+            fragile out;
+            for (int round = 0; round < 5; ++round) { // six positions a round: several laps over the slots
+                q.emplace(round);
+                REQUIRE_THROWS_AS(q.emplace(-1), std::runtime_error);
+                REQUIRE_THROWS_AS(q.try_emplace(-1), std::runtime_error);
+                q.pop(out);
+                REQUIRE(out.value == round);
+                REQUIRE(q.try_emplace(round + 10));
+                REQUIRE(q.try_pop(out));
+                REQUIRE(out.value == round + 10);
+                REQUIRE_FALSE(q.try_pop(out));
+                REQUIRE(q.empty());
+
+                q.emplace(1000);
+                q.emplace(1001);
+                REQUIRE_THROWS_AS(q.pop(out), std::runtime_error); // the element is dropped
+                REQUIRE_THROWS_AS(q.try_pop(out), std::runtime_error);
+                REQUIRE(q.empty());
+            }
+            q.emplace(7);
+            REQUIRE_THROWS_AS(q.emplace(-1), std::runtime_error); // a hole left for the destructor
+        }
+        REQUIRE(live == 0);
+    }
+}
+
+TEST_CASE("SPSC Queue Two Threads") {
+    SECTION("FIFO order is preserved") {
+        j::spsc_queue<size_t, 64> q;
+        std::thread producer([&] {
+            for (size_t i = 0; i < N; ++i) {
+                q.push(i);
+            }
+        });
+
+        bool ordered = true;
+        for (size_t i = 0; i < N; ++i) {
+            size_t value;
+            while (!q.try_pop(value)) {
+                std::this_thread::yield();
+            }
+            ordered = ordered && value == i;
+        }
+        producer.join();
+        REQUIRE(ordered);
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Batched transfer") {
+        j::spsc_queue<size_t, 256> q;
+        std::thread producer([&] {
+            std::vector<size_t> batch(32);
+            for (size_t i = 0; i < N;) {
+                const size_t count = std::min<size_t>(batch.size(), N - i);
+                for (size_t k = 0; k < count; ++k) {
+                    batch[k] = i + k;
+                }
+                size_t sent = 0;
+                while (sent < count) {
+                    const size_t pushed = q.push_n(batch.begin() + sent, count - sent);
+                    if (pushed == 0)
+                        std::this_thread::yield();
+                    sent += pushed;
+                }
+                i += count;
+            }
+        });
+
+        std::vector<size_t> received;
+        received.reserve(N);
+        std::vector<size_t> batch(32);
+        while (received.size() < N) {
+            const size_t count = q.pop_n(batch.begin(), batch.size());
+            if (count == 0)
+                std::this_thread::yield();
+            received.insert(received.end(), batch.begin(), batch.begin() + count);
+        }
+        producer.join();
+
+        bool ordered = true;
+        for (size_t i = 0; i < N; ++i) {
+            ordered = ordered && received[i] == i;
+        }
+        REQUIRE(ordered);
+    }
+}
+
+TEST_CASE("MPMC Queue Basic") {
+    SECTION("Capacity rounds up to a power of two") {
+        j::mpmc_queue<int> q(5);
+        REQUIRE(q.capacity() == 8);
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Try push/pop") {
+        j::mpmc_queue<int> q(4);
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(q.try_push(i));
+        }
+        REQUIRE_FALSE(q.try_push(4));
+        REQUIRE(q.size() == 4);
+
+        int out = -1;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(q.try_pop(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE_FALSE(q.try_pop(out));
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Blocking and non-blocking operations interleave") {
+        j::mpmc_queue<int, true> q(4);
+        int out = -1;
+        for (int round = 0; round < 10; ++round) {
+            q.push(round);
+            REQUIRE(q.try_emplace(round + 100));
+            q.pop(out);
+            REQUIRE(out == round);
+            REQUIRE(q.try_pop(out));
+            REQUIRE(out == round + 100);
+        }
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Non-trivial type") {
+        j::mpmc_queue<std::string> q(4);
+        q.push(std::string(100, 'a'));
+        q.emplace(50, 'b');
+        std::string out;
+        q.pop(out);
+        REQUIRE(out == std::string(100, 'a'));
+        q.emplace("left in queue");
+        q.emplace("destroyed by destructor");
+    }
+}
+
+template <bool Sleep> void mpmc_round_trip(size_t producers, size_t consumers) {
+    constexpr size_t items = 20000;
+    j::mpmc_queue<size_t, Sleep> q(64);
+    std::vector<std::thread> threads;
+    std::vector<size_t> sums(consumers, 0);
+
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (size_t i = p; i < items; i += producers) {
+                if (i % 2 == 0) {
+                    q.push(i);
+                } else {
+                    while (!q.try_push(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            for (size_t i = c; i < items; i += consumers) {
+                size_t value;
+                if (i % 2 == 0) {
+                    q.pop(value);
+                } else {
+                    while (!q.try_pop(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+                sums[c] += value;
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), size_t{0}) == items * (items - 1) / 2);
+    REQUIRE(q.empty());
+}
+
+TEST_CASE("MPMC Queue Multiple Threads") {
+    SECTION("Spinning") {
+        mpmc_round_trip<false>(1, 1);
+        mpmc_round_trip<false>(4, 2);
+        mpmc_round_trip<false>(2, 4);
+    }
+
+    SECTION("Sleeping") {
+        mpmc_round_trip<true>(1, 1);
+        mpmc_round_trip<true>(4, 4);
+    }
+}
+
+TEST_CASE("Concurrent Priority Queue Basic") {
+    SECTION("Single lane is exact") {
+        j::concurrent_priority_queue<int> pq(1);
+        for (int v : {3, 1, 4, 1, 5, 9, 2, 6}) {
+            pq.push(v);
+        }
+        REQUIRE(pq.size() == 8);
+
+        std::vector<int> out;
+        int value;
+        while (pq.try_pop(value)) {
+            out.push_back(value);
+        }
+        REQUIRE(out == std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1});
+        REQUIRE(pq.empty());
+    }
+
+    SECTION("Min ordering with greater") {
+        j::concurrent_priority_queue<int, j::vector<int>, std::greater<int>> pq(1);
+        pq.emplace(5);
+        pq.emplace(2);
+        pq.emplace(8);
+        int value;
+        REQUIRE(pq.try_pop(value));
+        REQUIRE(value == 2);
+    }
+
+    SECTION("Many lanes return every element") {
+        j::concurrent_priority_queue<int> pq(8);
+        REQUIRE(pq.lanes() == 8);
+        std::vector<int> in(1000);
+        std::iota(in.begin(), in.end(), 0);
+        for (int v : in) {
+            pq.push(v);
+        }
+
+        std::vector<int> out;
+        int value;
+        long rank_error = 0;
+        while (pq.try_pop(value)) {
+            rank_error += static_cast<long>(in.size() - out.size()) - 1 - value; // 0 when the popped value is the max
+            out.push_back(value);
+        }
+        REQUIRE(out.size() == in.size());
+        REQUIRE_FALSE(pq.try_pop(value));
+        std::sort(out.begin(), out.end());
+        REQUIRE(out == in);
+        // the expected rank error of two-choice pops is O(lanes)
+        REQUIRE(rank_error / static_cast<long>(in.size()) < 8 * 4);
+    }
+}
+
+TEST_CASE("Concurrent Priority Queue Multiple Threads") {
+    constexpr size_t threads = 4;
+    constexpr size_t per_thread = 5000;
+    j::concurrent_priority_queue<size_t> pq(2 * threads);
+    std::vector<std::thread> workers;
+    std::vector<size_t> sums(threads, 0);
+
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (size_t i = 0; i < per_thread; ++i) {
+                pq.push(t * per_thread + i);
+            }
+            for (size_t i = 0; i < per_thread; ++i) {
+                size_t value;
+                while (!pq.try_pop(value)) {
+                    std::this_thread::yield();
+                }
+                sums[t] += value;
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+
+    const size_t n = threads * per_thread;
+    REQUIRE(std::accumulate(sums.begin(), sums.end(), size_t{0}) == n * (n - 1) / 2);
+    REQUIRE(pq.empty());
+}
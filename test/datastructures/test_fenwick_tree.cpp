@@ -0,0 +1,290 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+import j;
+
+constexpr std::size_t N = 1000;
+
+TEST_CASE("Fenwick Tree") {
+    SECTION("Construction") {
+        j::fenwick_tree<int> il = {1, 2, 3, 4, 5};
+        REQUIRE(il.size() == 5);
+        REQUIRE(il.query(5) == 15);
+        REQUIRE(il.query(2, 4) == 9);
+
+        j::vector<int> v = {4, 4, 4};
+        j::fenwick_tree<int> from_lvalue(v);
+        REQUIRE(from_lvalue.query(3) == 12);
+        REQUIRE(v.size() == 3);
+        j::fenwick_tree<int> from_rvalue(j::vector<int>{1, 1});
+        REQUIRE(from_rvalue.query(2) == 2);
+
+        j::fenwick_tree<int, 4> fixed;
+        REQUIRE(fixed.size() == 4);
+        REQUIRE(fixed.query(4) == 0);
+        REQUIRE_THROWS_AS(fixed.assign({1, 2}), std::invalid_argument);
+        j::array<int, 3> a = {1, 2, 3};
+        j::fenwick_tree deduced(a);
+        REQUIRE(deduced.size() == 3);
+        REQUIRE(deduced.query(3) == 6);
+    }
+
+    SECTION("Point update and range query against a reference") {
+        std::mt19937 rng(1);
+        std::vector<int64_t> ref(N);
+        for (auto &x : ref) {
+            x = static_cast<int64_t>(rng() % 2001) - 1000;
+        }
+        j::fenwick_tree<int64_t> tree(ref.begin(), ref.end());
+        for (int round = 0; round < 2000; ++round) {
+            const std::size_t index = rng() % N + 1;
+            const int64_t delta = static_cast<int64_t>(rng() % 201) - 100;
+            tree.update(index, delta);
+            ref[index - 1] += delta;
+            std::size_t l = rng() % N + 1, r = rng() % N + 1;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            REQUIRE(tree.query(l, r) == std::accumulate(ref.begin() + (l - 1), ref.begin() + r, 0LL));
+        }
+    }
+
+    SECTION("Lower bound on prefix sums") {
+        std::mt19937 rng(3);
+        for (std::size_t n : {1, 2, 7, 8, 100}) {
+            std::vector<int64_t> ref(n);
+            for (auto &x : ref) {
+                x = static_cast<int64_t>(rng() % 4);
+            }
+            j::fenwick_tree<int64_t> tree(ref.begin(), ref.end());
+            std::vector<int64_t> prefix(n + 1, 0);
+            std::partial_sum(ref.begin(), ref.end(), prefix.begin() + 1);
+            for (int64_t value = 0; value <= prefix[n] + 1; ++value) {
+                const auto expected = std::lower_bound(prefix.begin() + 1, prefix.end(), value) - prefix.begin();
+                REQUIRE(tree.lower_bound(value) == static_cast<std::size_t>(expected));
+            }
+        }
+        REQUIRE(j::fenwick_tree<int>({2, 2}).lower_bound(5) == 3);
+    }
+
+    SECTION("Batched updates and parallel build") {
+        for (std::size_t n : {std::size_t{1}, std::size_t{37}, N, std::size_t{100000}}) {
+            std::mt19937 rng(static_cast<unsigned>(n));
+            std::vector<int64_t> ref(n);
+            for (auto &x : ref) {
+                x = static_cast<int64_t>(rng() % 2001) - 1000;
+            }
+            j::fenwick_tree<int64_t> sequential(ref.begin(), ref.end());
+            j::fenwick_tree<int64_t> parallel({0});
+            parallel.assign(j::execution::par, ref.begin(), ref.end());
+            for (std::size_t i = 1; i <= n; i += 1 + n / 100) {
+                REQUIRE(parallel.query(i) == sequential.query(i));
+            }
+
+            for (std::size_t count : {std::size_t{1}, std::size_t{5}, n / 100 + 1, n / 4 + 1, 3 * n}) {
+                std::vector<std::pair<std::size_t, int64_t>> updates;
+                for (std::size_t i = 0; i < count; ++i) {
+                    updates.emplace_back(1 + rng() % n, static_cast<int64_t>(rng() % 201) - 100);
+                }
+                updates.emplace_back(n + 1, 5); // out of range, ignored like update()
+                for (const auto &[index, value] : updates) {
+                    sequential.update(index, value);
+                    if (index <= n) {
+                        ref[index - 1] += value;
+                    }
+                }
+                parallel.update_many(updates);
+                int64_t prefix = 0;
+                for (std::size_t i = 1; i <= n; ++i) {
+                    prefix += ref[i - 1];
+                    REQUIRE(parallel.query(i) == prefix);
+                    REQUIRE(parallel.query(i) == sequential.query(i));
+                }
+            }
+        }
+    }
+
+    SECTION("Copy, move and clear") {
+        j::fenwick_tree<int> a = {1, 2, 3};
+        j::fenwick_tree<int> b = a;
+        b.update(1, 10);
+        REQUIRE(a.query(3) == 6);
+        REQUIRE(b.query(3) == 16);
+
+        j::fenwick_tree<int> c = std::move(b);
+        REQUIRE(b.size() == 0);
+        REQUIRE(c.query(3) == 16);
+
+        a.swap(c);
+        REQUIRE(a.query(3) == 16);
+        a.clear();
+        REQUIRE(a.size() == 3);
+        REQUIRE(a.query(3) == 0);
+    }
+}
+
+constexpr int64_t MOD = 998244353;
+
+struct mod_plus {
+    int64_t operator()(int64_t lhs, int64_t rhs) const {
+        return (lhs + rhs) % MOD;
+    }
+    int64_t identity() const {
+        return 0;
+    }
+    int64_t inverse(int64_t value) const {
+        return (MOD - value) % MOD;
+    }
+};
+
+TEST_CASE("Fenwick Tree Operators") {
+    SECTION("Xor") {
+        std::mt19937 rng(4);
+        std::vector<uint32_t> ref(N);
+        for (auto &x : ref) {
+            x = static_cast<uint32_t>(rng());
+        }
+        j::fenwick_tree<uint32_t, std::dynamic_extent, std::allocator<uint32_t>, j::bit_xor<uint32_t>> tree(
+            ref.begin(), ref.end());
+        for (int round = 0; round < 500; ++round) {
+            const std::size_t index = rng() % N + 1;
+            const auto value = static_cast<uint32_t>(rng());
+            tree.update(index, value);
+            ref[index - 1] ^= value;
+            std::size_t l = rng() % N + 1, r = rng() % N + 1;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            REQUIRE(tree.query(l, r) == std::accumulate(ref.begin() + (l - 1), ref.begin() + r, uint32_t(0),
+                                                         [](uint32_t a, uint32_t b) { return a ^ b; }));
+        }
+    }
+
+    SECTION("Modular add") {
+        j::fenwick_tree<int64_t, 4, std::allocator<int64_t>, mod_plus> tree = {MOD - 1, 5, MOD - 2, 7};
+        REQUIRE(tree.query(4) == 9);
+        REQUIRE(tree.query(2, 3) == 3);
+        REQUIRE(tree.query(3, 3) == MOD - 2);
+        tree.update(1, 2);
+        REQUIRE(tree.query(1) == 1);
+    }
+}
+
+TEST_CASE("Range Fenwick Tree") {
+    SECTION("Range add and range sum against a reference") {
+        std::mt19937 rng(5);
+        std::vector<int64_t> ref(N);
+        for (auto &x : ref) {
+            x = static_cast<int64_t>(rng() % 2001) - 1000;
+        }
+        j::range_fenwick_tree<int64_t> tree(ref.begin(), ref.end());
+        REQUIRE(tree.size() == N);
+        for (int round = 0; round < 2000; ++round) {
+            std::size_t l = rng() % N + 1, r = rng() % N + 1;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            const int64_t delta = static_cast<int64_t>(rng() % 201) - 100;
+            if (round % 2 == 0) {
+                tree.update(l, r, delta);
+                std::for_each(ref.begin() + (l - 1), ref.begin() + r, [delta](int64_t &x) { x += delta; });
+            } else {
+                tree.update(l, delta);
+                ref[l - 1] += delta;
+            }
+            REQUIRE(tree.query(l, r) == std::accumulate(ref.begin() + (l - 1), ref.begin() + r, 0LL));
+            REQUIRE(tree.query(r) == std::accumulate(ref.begin(), ref.begin() + r, 0LL));
+        }
+    }
+
+    SECTION("Copy, move and clear") {
+        j::range_fenwick_tree<int> a = {1, 2, 3};
+        a.update(1, 3, 1);
+        j::range_fenwick_tree<int> b = a;
+        REQUIRE(b.query(3) == 9);
+        j::range_fenwick_tree<int> c = std::move(b);
+        REQUIRE(b.size() == 0);
+        REQUIRE(c.query(2, 3) == 7);
+        c.clear();
+        REQUIRE(c.size() == 3);
+        REQUIRE(c.query(3) == 0);
+        j::range_fenwick_tree<int> sized(4);
+        sized.update(2, 4, 5);
+        REQUIRE(sized.query(1) == 0);
+        REQUIRE(sized.query(4) == 15);
+    }
+}
+
+TEST_CASE("Fenwick Tree 2D") {
+    SECTION("Rectangle sums against a reference") {
+        constexpr std::size_t ROWS = 37, COLS = 23;
+        std::mt19937 rng(6);
+        std::vector<int64_t> ref(ROWS * COLS);
+        for (auto &x : ref) {
+            x = static_cast<int64_t>(rng() % 2001) - 1000;
+        }
+        j::fenwick_tree_2d<int64_t> tree(ROWS, COLS, ref.begin());
+        REQUIRE(tree.rows() == ROWS);
+        REQUIRE(tree.cols() == COLS);
+        const auto rectangle = [&](std::size_t r1, std::size_t c1, std::size_t r2, std::size_t c2) {
+            int64_t sum = 0;
+            for (std::size_t i = r1; i <= r2; ++i) {
+                sum = std::accumulate(ref.begin() + ((i - 1) * COLS + c1 - 1), ref.begin() + ((i - 1) * COLS + c2),
+                                      sum);
+            }
+            return sum;
+        };
+        for (int round = 0; round < 500; ++round) {
+            const std::size_t row = rng() % ROWS + 1, col = rng() % COLS + 1;
+            const int64_t delta = static_cast<int64_t>(rng() % 201) - 100;
+            tree.update(row, col, delta);
+            ref[(row - 1) * COLS + col - 1] += delta;
+            std::size_t r1 = rng() % ROWS + 1, r2 = rng() % ROWS + 1, c1 = rng() % COLS + 1, c2 = rng() % COLS + 1;
+            if (r1 > r2) {
+                std::swap(r1, r2);
+            }
+            if (c1 > c2) {
+                std::swap(c1, c2);
+            }
+            REQUIRE(tree.query(r1, c1, r2, c2) == rectangle(r1, c1, r2, c2));
+            REQUIRE(tree.query(r2, c2) == rectangle(1, 1, r2, c2));
+        }
+    }
+
+    SECTION("Construction, copy and clear") {
+        j::fenwick_tree_2d<int> tree = {{1, 2, 3}, {4, 5, 6}};
+        REQUIRE(tree.query(2, 3) == 21);
+        REQUIRE(tree.query(2, 2, 2, 3) == 11);
+        REQUIRE_THROWS_AS((j::fenwick_tree_2d<int>{{1, 2}, {3}}), std::invalid_argument);
+
+        j::fenwick_tree_2d<int> copy = tree;
+        copy.update(1, 1, 10);
+        REQUIRE(tree.query(1, 1) == 1);
+        REQUIRE(copy.query(1, 1) == 11);
+        j::fenwick_tree_2d<int> moved = std::move(copy);
+        REQUIRE(copy.empty());
+        REQUIRE(moved.query(2, 3) == 31);
+        moved.clear();
+        REQUIRE(moved.query(2, 3) == 0);
+
+        j::fenwick_tree_2d<uint32_t, std::allocator<uint32_t>, j::bit_xor<uint32_t>> xor_tree = {{1, 2}, {4, 8}};
+        REQUIRE(xor_tree.query(1, 1, 2, 2) == 15);
+        REQUIRE(xor_tree.query(2, 1, 2, 2) == 12);
+    }
+}
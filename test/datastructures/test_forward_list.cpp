@@ -9,6 +9,8 @@
 
 #include <catch2/catch_all.hpp>
 #include <algorithm>
+#include <iterator>
+#include <memory>
 #include <random>
 #include <vector>
 import j;
@@ -680,3 +682,165 @@ TEST_CASE("Forward List Operations on Large Dataset") {
         REQUIRE(std::equal(flist.begin(), flist.end(), vec.begin()));
     }
 }
+
+TEST_CASE("Forward List Tracked Policy") {
+    using tracked_list = j::forward_list<int, std::allocator<int>, j::forward_list_tracked>;
+    // the plain policy pays nothing for the bookkeeping
+    STATIC_REQUIRE(sizeof(tracked_list) == sizeof(j::forward_list<int>) + sizeof(std::size_t) + sizeof(void *));
+
+    // size() and back() must agree with a walk of the list after every operation
+    auto consistent = [](const tracked_list &l) {
+        const auto walked = static_cast<std::size_t>(std::distance(l.begin(), l.end()));
+        if (walked != l.size())
+            return false;
+        if (l.empty())
+            return l.before_end() == l.before_begin();
+        return std::next(l.before_end()) == l.end() && &l.back() == &*l.before_end();
+    };
+
+    SECTION("Push back, push front and pop") {
+        tracked_list l;
+        REQUIRE(consistent(l));
+        for (int i = 0; i < 10; ++i) {
+            l.push_back(i);
+            l.push_front(-i - 1);
+        }
+        REQUIRE(consistent(l));
+        REQUIRE(l.size() == 20);
+        REQUIRE(l.front() == -10);
+        REQUIRE(l.back() == 9);
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+
+        while (!l.empty()) {
+            l.pop_front();
+            REQUIRE(consistent(l));
+        }
+        l.emplace_back(3);
+        REQUIRE(l.front() == 3);
+        REQUIRE(l.back() == 3);
+    }
+
+    SECTION("Insert, erase and resize") {
+        tracked_list l = {1, 2, 3};
+        l.insert_after(l.before_end(), {4, 5});
+        REQUIRE(l.back() == 5);
+        l.erase_after(std::next(l.begin(), 2));
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 5);
+        l.erase_after(std::next(l.begin(), 2));
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 3);
+        l.erase_after(l.before_begin(), l.end());
+        REQUIRE(consistent(l));
+        REQUIRE(l.empty());
+
+        l.resize(4, 7);
+        REQUIRE(consistent(l));
+        l.resize(2);
+        REQUIRE(consistent(l));
+        REQUIRE(l.size() == 2);
+        l.assign({9, 8, 7});
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 7);
+        l.clear();
+        REQUIRE(consistent(l));
+    }
+
+    SECTION("Copy, move and swap") {
+        tracked_list a = {1, 2, 3};
+        tracked_list b(a);
+        REQUIRE(consistent(b));
+        tracked_list c(std::move(a));
+        REQUIRE(consistent(a));
+        REQUIRE(consistent(c));
+        c.push_back(4);
+        a.push_back(0);
+        REQUIRE(consistent(a));
+        swap(a, c);
+        REQUIRE(consistent(a));
+        REQUIRE(consistent(c));
+        REQUIRE(a.back() == 4);
+        REQUIRE(c.back() == 0);
+        b = std::move(a);
+        REQUIRE(consistent(a));
+        REQUIRE(consistent(b));
+        REQUIRE(b.size() == 4);
+    }
+
+    SECTION("Splice after") {
+        // appending a whole chain at before_end() is O(1)
+        tracked_list chain;
+        for (int chunk = 0; chunk < 4; ++chunk) {
+            tracked_list piece = {chunk * 2, chunk * 2 + 1};
+            chain.splice_after(chain.before_end(), piece);
+            REQUIRE(piece.empty());
+            REQUIRE(consistent(piece));
+            REQUIRE(consistent(chain));
+        }
+        REQUIRE(std::vector<int>(chain.begin(), chain.end()) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+
+        tracked_list other = {10, 11, 12};
+        chain.splice_after(chain.before_begin(), other, std::next(other.begin()));
+        REQUIRE(chain.front() == 12);
+        REQUIRE(other.back() == 11);
+        REQUIRE(consistent(chain));
+        REQUIRE(consistent(other));
+
+        chain.splice_after(chain.before_end(), other, other.before_begin(), other.end());
+        REQUIRE(other.empty());
+        REQUIRE(chain.back() == 11);
+        REQUIRE(consistent(chain));
+        REQUIRE(consistent(other));
+
+        // a range in the middle of the source and one ending it
+        tracked_list source = {1, 2, 3, 4, 5};
+        chain.splice_after(chain.begin(), source, source.begin(), std::next(source.begin(), 3));
+        REQUIRE(std::vector<int>(source.begin(), source.end()) == std::vector<int>{1, 4, 5});
+        REQUIRE(consistent(chain));
+        REQUIRE(consistent(source));
+        chain.splice_after(chain.before_end(), source, source.begin(), source.end());
+        REQUIRE(chain.back() == 5);
+        REQUIRE(source.back() == 1);
+        REQUIRE(consistent(chain));
+        REQUIRE(consistent(source));
+
+        // moving a node after itself or after its predecessor leaves the list alone
+        tracked_list self = {1, 2};
+        self.splice_after(self.begin(), self, self.before_begin());
+        self.splice_after(self.before_begin(), self, self.before_begin());
+        REQUIRE(std::vector<int>(self.begin(), self.end()) == std::vector<int>{1, 2});
+        self.splice_after(self.before_begin(), self, self.begin());
+        REQUIRE(std::vector<int>(self.begin(), self.end()) == std::vector<int>{2, 1});
+        REQUIRE(consistent(self));
+    }
+
+    SECTION("Remove, unique, merge, sort and reverse") {
+        tracked_list l = {5, 5, 1, 1, 4, 4, 2, 3, 3};
+        REQUIRE(l.unique() == 4);
+        REQUIRE(consistent(l));
+        REQUIRE(l.remove(3) == 1);
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 2);
+        l.sort();
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 5);
+
+        tracked_list high = {0, 6, 7};
+        l.merge(high);
+        REQUIRE(consistent(l));
+        REQUIRE(consistent(high));
+        REQUIRE(l.back() == 7);
+        tracked_list low = {-1, 3};
+        l.merge(low);
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 7);
+        REQUIRE(l.size() == 9);
+
+        l.reverse();
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == -1);
+        REQUIRE(l.remove_if([](int v) { return v < 1; }) == 2);
+        REQUIRE(consistent(l));
+        REQUIRE(l.back() == 1);
+    }
+}
@@ -0,0 +1,272 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+import j;
+
+// adjacency list of a random directed graph with non-negative weights
+using graph = std::vector<std::vector<std::pair<uint32_t, uint32_t>>>;
+
+graph random_graph(uint32_t vertices, uint32_t edges, uint32_t max_weight, unsigned seed) {
+    std::mt19937 rng(seed);
+    graph g(vertices);
+    for (uint32_t i = 1; i < vertices; ++i) {
+        g[rng() % i].emplace_back(i, rng() % max_weight); // keeps every vertex reachable from 0
+    }
+    for (uint32_t e = vertices - 1; e < edges; ++e) {
+        g[rng() % vertices].emplace_back(rng() % vertices, rng() % max_weight);
+    }
+    return g;
+}
+
+constexpr uint64_t INF = std::numeric_limits<uint64_t>::max();
+
+std::vector<uint64_t> dijkstra_reference(const graph &g) {
+    std::vector<uint64_t> dist(g.size(), INF);
+    std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t>>, std::greater<>> pq;
+    dist[0] = 0;
+    pq.emplace(0, 0);
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+        if (d != dist[u])
+            continue;
+        for (auto [v, w] : g[u]) {
+            if (d + w < dist[v]) {
+                dist[v] = d + w;
+                pq.emplace(dist[v], v);
+            }
+        }
+    }
+    return dist;
+}
+
+// decrease-key Dijkstra, one queue entry per vertex
+template <class Queue> std::vector<uint64_t> dijkstra_indexed(const graph &g, Queue &pq) {
+    std::vector<uint64_t> dist(g.size(), INF);
+    dist[0] = 0;
+    pq.update(0, 0);
+    while (!pq.empty()) {
+        auto [u, d] = pq.top();
+        pq.pop();
+        for (auto [v, w] : g[u]) {
+            if (d + w < dist[v]) {
+                dist[v] = d + w;
+                pq.update(v, dist[v]);
+            }
+        }
+    }
+    return dist;
+}
+
+TEST_CASE("Indexed Priority Queue Basic") {
+    SECTION("Push/Top/Pop") {
+        j::indexed_priority_queue<int, int> pq;
+        REQUIRE(pq.empty());
+        REQUIRE(pq.push(1, 10));
+        REQUIRE(pq.push(2, 30));
+        REQUIRE(pq.push(3, 20));
+        REQUIRE_FALSE(pq.push(2, 5)); // already queued
+        REQUIRE(pq.size() == 3);
+        REQUIRE(pq.top() == std::pair{2, 30});
+        pq.pop();
+        REQUIRE(pq.top() == std::pair{3, 20});
+        REQUIRE_FALSE(pq.contains(2));
+        REQUIRE(pq.contains(1));
+    }
+
+    SECTION("Update raises and lowers") {
+        j::indexed_priority_queue<int, int> pq;
+        for (int k = 0; k < 10; ++k) {
+            pq.push(k, k);
+        }
+        pq.update(0, 100);
+        REQUIRE(pq.top().first == 0);
+        pq.update(0, -1);
+        REQUIRE(pq.top().first == 9);
+        pq.update(42, 50); // not queued yet: inserts
+        REQUIRE(pq.top() == std::pair{42, 50});
+        REQUIRE(pq.priority(0) == -1);
+        REQUIRE(pq.size() == 11);
+    }
+
+    SECTION("Erase") {
+        j::indexed_priority_queue<int, int, std::greater<int>> pq;
+        for (int k = 0; k < 20; ++k) {
+            pq.push(k, (k * 7) % 20);
+        }
+        REQUIRE(pq.erase(0));
+        REQUIRE_FALSE(pq.erase(0));
+        REQUIRE(pq.erase(3));
+        REQUIRE_FALSE(pq.contains(3));
+        std::vector<int> order;
+        while (!pq.empty()) {
+            order.push_back(pq.top().second);
+            pq.pop();
+        }
+        REQUIRE(order.size() == 18);
+        REQUIRE(std::is_sorted(order.begin(), order.end()));
+    }
+
+    SECTION("Non-integral keys") {
+        j::indexed_priority_queue<std::string, double, std::greater<double>> pq;
+        pq.push("b", 2.0);
+        pq.push("a", 3.0);
+        pq.push("c", 1.0);
+        pq.update("a", 0.5);
+        REQUIRE(pq.top().first == "a");
+        REQUIRE(pq.priority("b") == 2.0);
+        REQUIRE_THROWS_AS(pq.priority("z"), std::out_of_range);
+        pq.clear();
+        REQUIRE(pq.empty());
+        REQUIRE_FALSE(pq.contains("a"));
+    }
+
+    SECTION("Negative and sparse integral keys") {
+        j::indexed_priority_queue<int64_t, int> pq;
+        const int64_t keys[] = {-1, std::numeric_limits<int64_t>::min(), int64_t{1} << 60, 1700000000000, 3};
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(pq.push(keys[i], i));
+        }
+        REQUIRE_FALSE(pq.push(-1, 9));
+        REQUIRE(pq.priority(int64_t{1} << 60) == 2);
+        REQUIRE(pq.erase(std::numeric_limits<int64_t>::min()));
+        REQUIRE_FALSE(pq.contains(std::numeric_limits<int64_t>::min()));
+        REQUIRE_FALSE(pq.erase(-2));
+        REQUIRE(pq.top() == std::pair<int64_t, int>{3, 4});
+
+        // Hash and KeyEqual apply to integral keys as well
+        struct mod_hash {
+            size_t operator()(int k) const {
+                return std::hash<int>()(k % 10);
+            }
+        };
+        struct mod_equal {
+            bool operator()(int a, int b) const {
+                return a % 10 == b % 10;
+            }
+        };
+        j::indexed_priority_queue<int, int, std::less<int>, 4, mod_hash, mod_equal> mod;
+        REQUIRE(mod.push(3, 1));
+        REQUIRE_FALSE(mod.push(13, 2));
+        REQUIRE(mod.contains(23));
+    }
+
+    SECTION("Declared key bound") {
+        j::indexed_priority_queue<int, int> pq(100);
+        REQUIRE(pq.push(0, 1));
+        REQUIRE(pq.push(99, 2));
+        REQUIRE_THROWS_AS(pq.push(-1, 3), std::out_of_range);
+        REQUIRE_THROWS_AS(pq.update(100, 3), std::out_of_range);
+        REQUIRE_FALSE(pq.contains(-1));
+        REQUIRE_FALSE(pq.contains(1 << 30));
+        REQUIRE_FALSE(pq.erase(-5));
+        REQUIRE(pq.size() == 2);
+        REQUIRE(pq.top() == std::pair{99, 2});
+        pq.clear();
+        REQUIRE_FALSE(pq.contains(99));
+        REQUIRE(pq.push(99, 0));
+
+        j::indexed_radix_heap<int, uint32_t> heap(10);
+        REQUIRE_THROWS_AS(heap.push(-1, 0), std::out_of_range);
+        REQUIRE_THROWS_AS(heap.update(10, 0), std::out_of_range);
+        REQUIRE(heap.empty());
+        REQUIRE(heap.push(9, 4));
+        REQUIRE(heap.top() == std::pair{9, 4u});
+    }
+
+    SECTION("Random operations match a reference") {
+        std::mt19937 rng(7);
+        j::indexed_priority_queue<int, int, std::less<int>, 3> pq;
+        std::vector<int> reference(200, std::numeric_limits<int>::min()); // min marks "not queued"
+        for (int step = 0; step < 20000; ++step) {
+            const int key = static_cast<int>(rng() % reference.size());
+            switch (rng() % 4) {
+            case 0:
+            case 1:
+                reference[key] = static_cast<int>(rng() % 1000);
+                pq.update(key, reference[key]);
+                break;
+            case 2:
+                REQUIRE(pq.erase(key) == (reference[key] != std::numeric_limits<int>::min()));
+                reference[key] = std::numeric_limits<int>::min();
+                break;
+            default:
+                if (!pq.empty()) {
+                    const int best = *std::max_element(reference.begin(), reference.end());
+                    REQUIRE(pq.top().second == best);
+                    reference[pq.top().first] = std::numeric_limits<int>::min();
+                    pq.pop();
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Indexed Radix Heap Basic") {
+    SECTION("Min order") {
+        j::indexed_radix_heap<int, uint32_t> heap;
+        for (int k = 0; k < 100; ++k) {
+            heap.push(k, static_cast<uint32_t>((k * 37) % 100));
+        }
+        REQUIRE_FALSE(heap.push(5, 0));
+        for (uint32_t expected = 0; expected < 100; ++expected) {
+            REQUIRE(heap.top().second == expected);
+            heap.pop();
+        }
+        REQUIRE(heap.empty());
+    }
+
+    SECTION("Update, erase and monotonicity") {
+        j::indexed_radix_heap<int, uint32_t> heap;
+        heap.push(1, 10);
+        heap.push(2, 20);
+        heap.push(3, 30);
+        heap.update(3, 5);
+        REQUIRE(heap.top() == std::pair{3, 5u});
+        REQUIRE(heap.erase(1));
+        REQUIRE_FALSE(heap.contains(1));
+        heap.pop();
+        heap.push(4, 5); // equal to the last minimum is allowed
+        REQUIRE(heap.priority(2) == 20);
+        REQUIRE_THROWS_AS(heap.update(2, 4), std::invalid_argument);
+        REQUIRE(heap.top() == std::pair{4, 5u});
+    }
+}
+
+TEST_CASE("Indexed Priority Queue Dijkstra") {
+    const graph g = random_graph(2000, 10000, 1000, 42);
+    const auto expected = dijkstra_reference(g);
+
+    SECTION("indexed_priority_queue") {
+        j::indexed_priority_queue<uint32_t, uint64_t, std::greater<uint64_t>> pq;
+        REQUIRE(dijkstra_indexed(g, pq) == expected);
+    }
+
+    SECTION("indexed_radix_heap") {
+        j::indexed_radix_heap<uint32_t, uint64_t> heap;
+        REQUIRE(dijkstra_indexed(g, heap) == expected);
+    }
+
+    SECTION("Dense vertex ids") {
+        j::indexed_priority_queue<uint32_t, uint64_t, std::greater<uint64_t>> pq(g.size());
+        REQUIRE(dijkstra_indexed(g, pq) == expected);
+        j::indexed_radix_heap<uint32_t, uint64_t> heap(g.size());
+        REQUIRE(dijkstra_indexed(g, heap) == expected);
+    }
+}
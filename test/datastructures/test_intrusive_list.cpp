@@ -0,0 +1,241 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+import j;
+
+// a pooled object that is on an LRU list and possibly a dirty list at the same time
+struct page {
+    int id = 0;
+    j::list_hook lru;
+    j::list_hook dirty;
+    j::forward_list_hook free;
+
+    explicit page(int i = 0) : id(i) {}
+    bool operator==(const page &other) const {
+        return id == other.id;
+    }
+    bool operator<(const page &other) const {
+        return id < other.id;
+    }
+};
+
+using lru_list = j::intrusive_list<page, &page::lru>;
+using dirty_list = j::intrusive_list<page, &page::dirty>;
+using free_list = j::intrusive_forward_list<page, &page::free>;
+
+template <class List> std::vector<int> ids(const List &l) {
+    std::vector<int> out;
+    for (const page &p : l) {
+        out.push_back(p.id);
+    }
+    return out;
+}
+
+TEST_CASE("Intrusive List Basic") {
+    std::vector<page> pool;
+    for (int i = 0; i < 10; ++i) {
+        pool.emplace_back(i);
+    }
+
+    SECTION("Push/Pop/Erase") {
+        lru_list l;
+        REQUIRE(l.empty());
+        for (auto &p : pool) {
+            l.push_back(p);
+        }
+        REQUIRE(l.size() == 10);
+        REQUIRE(l.front().id == 0);
+        REQUIRE(l.back().id == 9);
+        REQUIRE(pool[3].lru.is_linked());
+
+        l.erase(l.iterator_to(pool[3]));
+        REQUIRE_FALSE(pool[3].lru.is_linked());
+        l.pop_front();
+        l.pop_back();
+        l.push_front(pool[3]);
+        REQUIRE(ids(l) == std::vector<int>{3, 1, 2, 4, 5, 6, 7, 8});
+        REQUIRE(l.size() == 8);
+
+        std::vector<int> reversed;
+        for (auto it = l.rbegin(); it != l.rend(); ++it) {
+            reversed.push_back(it->id);
+        }
+        REQUIRE(reversed == std::vector<int>{8, 7, 6, 5, 4, 2, 1, 3});
+
+        l.clear();
+        REQUIRE(l.empty());
+        REQUIRE(std::none_of(pool.begin(), pool.end(), [](const page &p) { return p.lru.is_linked(); }));
+    }
+
+    SECTION("An object on two lists") {
+        lru_list lru;
+        dirty_list dirty;
+        for (auto &p : pool) {
+            lru.push_back(p);
+            if (p.id % 3 == 0)
+                dirty.push_front(p);
+        }
+        REQUIRE(ids(dirty) == std::vector<int>{9, 6, 3, 0});
+
+        // touching a page moves it to the back of the LRU list without affecting the dirty list
+        lru.splice(lru.end(), lru, lru.iterator_to(pool[6]));
+        REQUIRE(lru.back().id == 6);
+        REQUIRE(lru.size() == 10);
+        dirty.erase(dirty.iterator_to(pool[6]));
+        REQUIRE(ids(dirty) == std::vector<int>{9, 3, 0});
+        REQUIRE(pool[6].lru.is_linked());
+    }
+
+    SECTION("Splice between lists") {
+        lru_list a(pool.begin(), pool.begin() + 5);
+        lru_list b(pool.begin() + 5, pool.end());
+        a.splice(std::next(a.begin()), b, std::next(b.begin()), std::prev(b.end()));
+        REQUIRE(ids(a) == std::vector<int>{0, 6, 7, 8, 1, 2, 3, 4});
+        REQUIRE(ids(b) == std::vector<int>{5, 9});
+        REQUIRE(a.size() == 8);
+        REQUIRE(b.size() == 2);
+        a.splice(a.end(), b);
+        REQUIRE(b.empty());
+        REQUIRE(a.size() == 10);
+
+        lru_list moved(std::move(a));
+        REQUIRE(a.empty());
+        REQUIRE(moved.size() == 10);
+        swap(moved, b);
+        REQUIRE(b.size() == 10);
+        REQUIRE(b.front().id == 0);
+    }
+
+    SECTION("Sort, merge, unique, reverse") {
+        std::mt19937 rng(11);
+        std::vector<page> values;
+        for (int i = 0; i < 200; ++i) {
+            values.emplace_back(static_cast<int>(rng() % 50));
+        }
+        lru_list l(values.begin(), values.end());
+        l.sort();
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+        REQUIRE(l.size() == 200);
+
+        lru_list other(pool.begin(), pool.end());
+        l.merge(other);
+        REQUIRE(other.empty());
+        REQUIRE(l.size() == 210);
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+
+        const auto removed = l.unique();
+        REQUIRE(l.size() == 210 - removed);
+        REQUIRE(std::adjacent_find(l.begin(), l.end()) == l.end());
+
+        l.reverse();
+        REQUIRE(std::is_sorted(l.rbegin(), l.rend()));
+        REQUIRE(l.remove_if([](const page &p) { return p.id % 2 == 0; }) > 0);
+        REQUIRE(std::all_of(l.begin(), l.end(), [](const page &p) { return p.id % 2 == 1; }));
+    }
+
+    SECTION("Sort is stable and survives a throwing comparator") {
+        std::vector<page> values;
+        for (int i = 0; i < 100; ++i) {
+            values.emplace_back(i);
+        }
+        lru_list l(values.begin(), values.end());
+        l.sort([](const page &a, const page &b) { return a.id % 10 < b.id % 10; });
+        std::vector<int> expected;
+        for (int r = 0; r < 10; ++r) {
+            for (int i = r; i < 100; i += 10) {
+                expected.push_back(i);
+            }
+        }
+        REQUIRE(ids(l) == expected);
+
+        int calls = 0;
+        REQUIRE_THROWS_AS(l.sort([&](const page &a, const page &b) {
+            if (++calls == 150)
+                throw std::runtime_error("compare");
+            return a.id < b.id;
+        }),
+                          std::runtime_error);
+        REQUIRE(l.size() == 100);
+        REQUIRE(static_cast<size_t>(std::distance(l.begin(), l.end())) == 100);
+        l.sort();
+        REQUIRE(ids(l).front() == 0);
+
+        // the last comparison falls in the merge of the leftover bins, after every carry has settled
+        const auto by_digit = [](const page &a, const page &b) { return a.id % 7 < b.id % 7; };
+        const auto descending = [](const page &a, const page &b) { return b < a; };
+        l.sort(descending);
+        int total = 0;
+        l.sort([&](const page &a, const page &b) { return ++total, by_digit(a, b); });
+        l.sort(descending);
+        calls = 0;
+        REQUIRE_THROWS_AS(l.sort([&](const page &a, const page &b) {
+            if (++calls == total)
+                throw std::runtime_error("compare");
+            return by_digit(a, b);
+        }),
+                          std::runtime_error);
+        REQUIRE(l.size() == 100);
+        REQUIRE(static_cast<size_t>(std::distance(l.begin(), l.end())) == 100);
+        l.sort();
+        REQUIRE(ids(l).front() == 0);
+        REQUIRE(ids(l).back() == 99);
+    }
+}
+
+TEST_CASE("Intrusive Forward List Basic") {
+    std::vector<page> pool;
+    for (int i = 0; i < 10; ++i) {
+        pool.emplace_back(9 - i);
+    }
+
+    SECTION("Free list") {
+        free_list l;
+        REQUIRE(l.empty());
+        for (auto &p : pool) {
+            l.push_front(p);
+        }
+        REQUIRE(ids(l) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        l.pop_front();
+        l.erase_after(l.iterator_to(pool[5])); // removes the page after id 4
+        REQUIRE(ids(l) == std::vector<int>{1, 2, 3, 4, 6, 7, 8, 9});
+        l.insert_after(l.before_begin(), pool[9]);
+        REQUIRE(l.front().id == 0);
+    }
+
+    SECTION("Sort, merge, unique, reverse, splice") {
+        free_list l(pool.begin(), pool.end());
+        l.sort();
+        REQUIRE(ids(l) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        l.reverse();
+        REQUIRE(l.front().id == 9);
+        l.reverse();
+
+        std::vector<page> more;
+        for (int i : {1, 1, 4, 12}) {
+            more.emplace_back(i);
+        }
+        free_list other(more.begin(), more.end());
+        l.merge(other);
+        REQUIRE(other.empty());
+        REQUIRE(ids(l) == std::vector<int>{0, 1, 1, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 12});
+        REQUIRE(l.unique() == 3);
+        REQUIRE(ids(l) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12});
+        REQUIRE(&*std::next(l.begin()) == &pool[8]); // the first of each run is kept
+
+        free_list tail;
+        tail.splice_after(tail.before_begin(), l, l.iterator_to(pool[0]), l.end()); // everything after id 9
+        REQUIRE(ids(tail) == std::vector<int>{12});
+        REQUIRE(l.remove(page(3)) == 1);
+        REQUIRE(ids(l) == std::vector<int>{0, 1, 2, 4, 5, 6, 7, 8, 9});
+    }
+}
@@ -690,6 +690,44 @@ TEST_CASE("List Operations on Large Dataset") {
         REQUIRE(std::equal(lst1.begin(), lst1.end(), vec1.begin()));
     }
 
+    SECTION("Sort through a contiguous buffer") {
+        // lists this long take the gather-sort-scatter path for small trivially copyable elements
+        std::mt19937 gen(5);
+        std::uniform_int_distribution<long long> dis(-1000000, 1000000);
+        j::list<long long> lst;
+        std::vector<long long> vec;
+        for (size_t i = 0; i < data_size; ++i) {
+            lst.push_back(dis(gen));
+            vec.push_back(lst.back());
+        }
+        const auto first = lst.begin();
+        const long long first_value = *first;
+
+        lst.sort();
+        std::sort(vec.begin(), vec.end());
+        REQUIRE(std::equal(lst.begin(), lst.end(), vec.begin(), vec.end()));
+        REQUIRE(*first == first_value); // nodes are relinked, not overwritten
+        REQUIRE(std::is_sorted(lst.rbegin(), lst.rend(), std::greater<long long>()));
+
+        lst.sort(std::greater<>());
+        REQUIRE(std::is_sorted(lst.begin(), lst.end(), std::greater<long long>()));
+        REQUIRE(lst.size() == data_size);
+
+        // a custom comparator takes the stable comparison sort
+        struct item {
+            int key;
+            int order;
+        };
+        j::list<item> items;
+        for (size_t i = 0; i < data_size; ++i) {
+            items.push_back({static_cast<int>(gen() % 10), static_cast<int>(i)});
+        }
+        items.sort([](const item &a, const item &b) { return a.key < b.key; });
+        REQUIRE(std::is_sorted(items.begin(), items.end(), [](const item &a, const item &b) {
+            return a.key < b.key || (a.key == b.key && a.order < b.order);
+        }));
+    }
+
     SECTION("Unique") {
         j::list<int> lst;
         std::vector<int> vec;
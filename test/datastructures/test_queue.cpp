@@ -13,6 +13,10 @@
 #include <random>
 #include <deque>
 #include <list>
+#include <bit>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
 
 import j;
 
@@ -330,3 +334,152 @@ TEST_CASE("Priority Queue Large Dataset") {
         REQUIRE(pq.empty());
     }
 }
+
+TEST_CASE("D-ary Heap Algorithms") {
+    auto check = [](auto arity) {
+        constexpr size_t D = decltype(arity)::value;
+        std::vector<int> v(N);
+        for (auto &x : v) x = dis(gen);
+
+        j::make_heap<D>(v.begin(), v.end());
+        for (size_t i = 1; i < v.size(); ++i) {
+            REQUIRE_FALSE(v[(i - 1) / D] < v[i]);
+        }
+
+        std::vector<int> sorted;
+        for (auto last = v.end(); last != v.begin(); --last) {
+            j::pop_heap<D>(v.begin(), last);
+            sorted.push_back(*(last - 1));
+        }
+        REQUIRE(std::is_sorted(sorted.rbegin(), sorted.rend()));
+
+        std::vector<int> h;
+        for (size_t i = 0; i < N; ++i) {
+            h.push_back(dis(gen));
+            j::push_heap<D>(h.begin(), h.end(), std::greater<>());
+            REQUIRE(h.front() == *std::min_element(h.begin(), h.end()));
+        }
+    };
+
+    SECTION("Binary") { check(std::integral_constant<size_t, 2>{}); }
+    SECTION("3-ary") { check(std::integral_constant<size_t, 3>{}); }
+    SECTION("4-ary") { check(std::integral_constant<size_t, 4>{}); }
+    SECTION("8-ary") { check(std::integral_constant<size_t, 8>{}); }
+}
+
+TEST_CASE("Priority Queue Arity Policy") {
+    j::priority_queue<int, j::vector<int>, std::less<int>, 4> pq4;
+    j::priority_queue<int, j::vector<int>, std::greater<int>, 8> pq8;
+    std::vector<int> data;
+    for (size_t i = 0; i < N; ++i) {
+        int val = dis(gen);
+        data.push_back(val);
+        pq4.push(val);
+        pq8.emplace(val);
+    }
+
+    std::sort(data.begin(), data.end());
+    for (size_t i = 0; i < data.size(); ++i) {
+        REQUIRE(pq4.top() == data[data.size() - 1 - i]);
+        REQUIRE(pq8.top() == data[i]);
+        pq4.pop();
+        pq8.pop();
+    }
+    REQUIRE(pq4.empty());
+    REQUIRE(pq8.empty());
+
+    j::priority_queue<int, std::vector<int>, std::less<int>, 4> from_range(data.begin(), data.end());
+    REQUIRE(from_range.top() == data.back());
+}
+
+template <size_t D, class Iter, class Compare = std::less<>> bool is_dary_heap(Iter first, Iter last, Compare comp = {}) {
+    for (auto i = 1; i < last - first; ++i) {
+        if (comp(first[(i - 1) / D], first[i])) return false;
+    }
+    return true;
+}
+
+TEST_CASE("Heap Batch Operations") {
+    SECTION("pop_heap uses the bottom-up sift") {
+        std::vector<int> v(N);
+        for (auto &x : v) x = dis(gen);
+        size_t comparisons = 0;
+        auto comp = [&](int a, int b) { ++comparisons; return a < b; };
+        j::make_heap(v.begin(), v.end(), comp);
+        comparisons = 0;
+        for (auto last = v.end(); last != v.begin(); --last) {
+            j::pop_heap(v.begin(), last, comp);
+        }
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+        // bottom-up sift: about log2(n) comparisons per pop instead of 2 * log2(n)
+        REQUIRE(comparisons < N * std::bit_width(N) * 3 / 2);
+    }
+
+    SECTION("push_heap_range small and large batches") {
+        for (size_t k : {size_t{1}, size_t{10}, N / 2, N, 4 * N}) {
+            std::vector<int> v(N);
+            for (auto &x : v) x = dis(gen);
+            j::make_heap<4>(v.begin(), v.end());
+            for (size_t i = 0; i < k; ++i) v.push_back(dis(gen));
+            j::push_heap_range<4>(v.begin(), v.begin() + N, v.end());
+            REQUIRE(is_dary_heap<4>(v.begin(), v.end()));
+
+            std::vector<int> empty_heap(v.begin(), v.end());
+            j::push_heap_range(empty_heap.begin(), empty_heap.begin(), empty_heap.end(), std::greater<>());
+            REQUIRE(is_dary_heap<2>(empty_heap.begin(), empty_heap.end(), std::greater<>()));
+        }
+    }
+
+    SECTION("pop_heap_n") {
+        std::vector<int> v(N);
+        for (auto &x : v) x = dis(gen);
+        std::vector<int> sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+
+        j::make_heap(v.begin(), v.end());
+        j::pop_heap_n(v.begin(), v.end(), 100);
+        REQUIRE(is_dary_heap<2>(v.begin(), v.end() - 100));
+        REQUIRE(std::equal(v.end() - 100, v.end(), sorted.end() - 100));
+
+        j::pop_heap_n(v.begin(), v.end() - 100, 2 * N);
+        REQUIRE(v == sorted);
+    }
+
+    SECTION("priority_queue push_range/pop_n") {
+        j::priority_queue<int, j::vector<int>, std::less<int>, 4> pq;
+        std::vector<int> data(N);
+        for (auto &x : data) x = dis(gen);
+        pq.push(dis(gen));
+        pq.push_range(data);
+        REQUIRE(pq.size() == N + 1);
+
+        std::vector<int> top;
+        pq.pop_n(std::back_inserter(top), 10);
+        REQUIRE(top.size() == 10);
+        REQUIRE(std::is_sorted(top.rbegin(), top.rend()));
+        REQUIRE(pq.size() == N - 9);
+        REQUIRE_FALSE(pq.top() > top.back());
+
+        pq.pop_n(std::back_inserter(top), 2 * N);
+        REQUIRE(pq.empty());
+        REQUIRE(std::is_sorted(top.rbegin(), top.rend()));
+    }
+
+    SECTION("priority_queue push_range leaves the heap unchanged when an element throws") {
+        j::priority_queue<int, j::vector<int>, std::less<int>, 4> pq;
+        for (int i = 0; i < 100; ++i) {
+            pq.push(i * 7 % 100);
+        }
+        auto throwing = std::views::iota(0, 1000) | std::views::transform([](int i) {
+                            if (i == 500)
+                                throw std::runtime_error("element");
+                            return 1000 + i;
+                        });
+        REQUIRE_THROWS_AS(pq.push_range(throwing), std::runtime_error);
+        REQUIRE(pq.size() == 100);
+        std::vector<int> top;
+        pq.pop_n(std::back_inserter(top), 100);
+        REQUIRE(top.front() == 99);
+        REQUIRE(std::is_sorted(top.rbegin(), top.rend()));
+    }
+}
@@ -0,0 +1,722 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+import j;
+
+constexpr std::size_t N = 1000;
+
+std::vector<int64_t> random_values(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int64_t> v(n);
+    for (auto &x : v) {
+        x = static_cast<int64_t>(rng() % 2001) - 1000;
+    }
+    return v;
+}
+
+TEST_CASE("Segment Tree") {
+    SECTION("Construction") {
+        j::segment_tree<int> empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty.size() == 0);
+
+        j::segment_tree<int> sized(10);
+        REQUIRE(sized.size() == 10);
+        REQUIRE(sized.tree_size() == 20);
+        REQUIRE(sized.query(0, 10) == 0);
+
+        j::segment_tree<int> il = {1, 2, 3, 4, 5};
+        REQUIRE(il.is_built());
+        REQUIRE(il.query(0, 5) == 15);
+        REQUIRE(il.query(1, 3) == 5);
+        REQUIRE(il.query(4) == 5);
+
+        std::istringstream in("3 1 4 1 5");
+        j::segment_tree<int> single_pass(std::istream_iterator<int>(in), std::istream_iterator<int>{});
+        REQUIRE(single_pass.size() == 5);
+        REQUIRE(single_pass.query(0, 5) == 14);
+    }
+
+    SECTION("Point update and range query against a reference") {
+        auto ref = random_values(N, 1);
+        j::segment_tree<int64_t> tree(ref.begin(), ref.end());
+        std::mt19937 rng(2);
+        for (int round = 0; round < 2000; ++round) {
+            const std::size_t pos = rng() % N;
+            ref[pos] = static_cast<int64_t>(rng() % 2001) - 1000;
+            tree.update(pos, ref[pos]);
+            std::size_t l = rng() % N, r = rng() % (N + 1);
+            if (l > r) {
+                std::swap(l, r);
+            }
+            REQUIRE(static_cast<int64_t>(tree.query(l, r)) == std::accumulate(ref.begin() + l, ref.begin() + r, 0LL));
+        }
+        REQUIRE(std::equal(tree.data().begin(), tree.data().end(), ref.begin(), ref.end()));
+    }
+
+    SECTION("Max operator on odd sizes") {
+        for (std::size_t n : {1, 2, 3, 7, 13, 100}) {
+            auto ref = random_values(n, static_cast<unsigned>(n));
+            j::segment_tree<int64_t, std::allocator<int64_t>, j::max<int64_t>> tree(ref.begin(), ref.end());
+            for (std::size_t l = 0; l < n; ++l) {
+                for (std::size_t r = l + 1; r <= n; ++r) {
+                    REQUIRE(static_cast<int64_t>(tree.query(l, r)) ==
+                            *std::max_element(ref.begin() + l, ref.begin() + r));
+                }
+            }
+        }
+    }
+
+    SECTION("Copy, move and resize") {
+        j::segment_tree<int> a = {1, 2, 3, 4};
+        j::segment_tree<int> b = a;
+        b.update(0, 10);
+        REQUIRE(a.query(0, 4) == 10);
+        REQUIRE(b.query(0, 4) == 19);
+
+        j::segment_tree<int> c = std::move(b);
+        REQUIRE(c.query(0, 4) == 19);
+        REQUIRE(b.empty());
+
+        a.swap(c);
+        REQUIRE(a.query(0, 4) == 19);
+        REQUIRE(c.query(0, 4) == 10);
+
+        REQUIRE(a.resize(6) == 6);
+        REQUIRE(a.query(0, 6) == 0);
+        a.clear();
+        REQUIRE(a.empty());
+        a.assign({5, 6});
+        REQUIRE(a.query(0, 2) == 11);
+    }
+}
+
+template <class Tree, class Reduce> void check_against_reference(std::vector<int64_t> ref, Reduce reduce) {
+    Tree tree(ref.begin(), ref.end());
+    const std::size_t n = ref.size();
+    std::mt19937 rng(static_cast<unsigned>(n));
+    for (int round = 0; round < 500; ++round) {
+        const std::size_t pos = rng() % n;
+        ref[pos] = static_cast<int64_t>(rng() % 2001) - 1000;
+        tree.update(pos, ref[pos]);
+        std::size_t l = rng() % n, r = rng() % (n + 1);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        REQUIRE(static_cast<int64_t>(tree.query(l, r)) == reduce(ref.begin() + l, ref.begin() + r));
+    }
+    REQUIRE(std::equal(tree.data().begin(), tree.data().end(), ref.begin(), ref.end()));
+}
+
+TEST_CASE("Segment Tree Layouts") {
+    const auto sum = [](auto first, auto last) { return std::accumulate(first, last, int64_t(0)); };
+    const auto maximum = [](auto first, auto last) {
+        return first == last ? std::numeric_limits<int64_t>::lowest() : *std::max_element(first, last);
+    };
+
+    SECTION("Wide nodes against a reference") {
+        for (std::size_t n : {1, 2, 7, 8, 9, 64, 65, 1000, 5000}) {
+            const auto ref = random_values(n, static_cast<unsigned>(n));
+            check_against_reference<j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>,
+                                                    j::segment_tree_wide<>>>(ref, sum);
+            check_against_reference<j::segment_tree<int64_t, std::allocator<int64_t>, j::max<int64_t>,
+                                                    j::segment_tree_wide<>>>(ref, maximum);
+            check_against_reference<j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>,
+                                                    j::segment_tree_wide<3>>>(ref, sum);
+            check_against_reference<j::segment_tree<int64_t, std::allocator<int64_t>, j::max<int64_t>,
+                                                    j::segment_tree_wide<32>>>(ref, maximum);
+        }
+    }
+
+    SECTION("Wide nodes copy, move and resize") {
+        using wide_tree = j::segment_tree<int, std::allocator<int>, j::plus<int>, j::segment_tree_wide<>>;
+        wide_tree a = {1, 2, 3, 4, 5};
+        wide_tree b = a;
+        b.update(4, 10);
+        REQUIRE(a.query(0, 5) == 15);
+        REQUIRE(b.query(0, 5) == 20);
+        wide_tree c = std::move(b);
+        REQUIRE(b.empty());
+        REQUIRE(c.query(3, 5) == 14);
+        REQUIRE(c.resize(100) == 100);
+        REQUIRE(c.query(0, 100) == 0);
+        c.update(99, 7);
+        REQUIRE(c.query(50, 100) == 7);
+        c.clear();
+        c.assign({4, 4});
+        REQUIRE(c.query(0, 2) == 8);
+    }
+}
+
+// non-commutative: keeps the first and last element of a range
+struct first_last {
+    std::pair<int64_t, int64_t> operator()(const std::pair<int64_t, int64_t> &lhs,
+                                           const std::pair<int64_t, int64_t> &rhs) const {
+        if (lhs == identity()) {
+            return rhs;
+        }
+        return rhs == identity() ? lhs : std::pair<int64_t, int64_t>(lhs.first, rhs.second);
+    }
+    std::pair<int64_t, int64_t> identity() const {
+        return {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min()};
+    }
+};
+
+
+template <class Layout> void check_operand_order() {
+    std::vector<std::pair<int64_t, int64_t>> values;
+    for (int64_t i = 0; i < 300; ++i) {
+        values.emplace_back(i, i);
+    }
+    j::segment_tree<std::pair<int64_t, int64_t>, std::allocator<std::pair<int64_t, int64_t>>, first_last, Layout> tree(
+        values.begin(), values.end());
+    for (std::size_t l = 0; l < 300; l += 7) {
+        for (std::size_t r = l + 1; r <= 300; r += 11) {
+            REQUIRE(tree.query(l, r) == std::pair<int64_t, int64_t>(l, r - 1));
+        }
+    }
+}
+
+template <class Tree> void check_query_many(std::size_t n) {
+    const auto ref = random_values(n, static_cast<unsigned>(n) + 7);
+    const Tree tree(ref.begin(), ref.end());
+    std::mt19937 rng(static_cast<unsigned>(n));
+    std::vector<std::pair<std::size_t, std::size_t>> ranges = {{0, n}, {0, 0}, {n, n}};
+    for (int round = 0; round < 100; ++round) {
+        std::size_t l = rng() % (n + 1), r = rng() % (n + 1);
+        ranges.emplace_back(std::min(l, r), std::max(l, r));
+    }
+    const auto results = tree.query_many(ranges);
+    REQUIRE(results.size() == ranges.size());
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+        REQUIRE(results[i] == Tree(tree).query(ranges[i].first, ranges[i].second));
+    }
+}
+
+TEST_CASE("Segment Tree Queries") {
+    SECTION("Results keep the value type") {
+        j::segment_tree<double> tree = {0.25, 0.5, 1.5};
+        REQUIRE(tree.query(0, 2) == 0.75);
+        REQUIRE(tree.query(2) == 1.5);
+        j::segment_tree<double, std::allocator<double>, j::plus<double>, j::segment_tree_wide<>> wide = {0.25, 0.5};
+        REQUIRE(wide.query(0, 2) == 0.75);
+        j::lazy_segment_tree<double> lazy = {0.25, 0.5, 1.5};
+        lazy.update(0, 2, 0.125);
+        REQUIRE(lazy.query(0, 1) == 1.0);
+        REQUIRE(lazy.query(2) == 1.625);
+    }
+
+    SECTION("Non-commutative operators keep the operand order") {
+        check_operand_order<j::segment_tree_binary>();
+        check_operand_order<j::segment_tree_wide<4>>();
+    }
+
+    SECTION("Batched queries match single queries") {
+        for (std::size_t n : {1, 9, 1000}) {
+            check_query_many<j::segment_tree<int64_t>>(n);
+            check_query_many<j::segment_tree<int64_t, std::allocator<int64_t>, j::max<int64_t>>>(n);
+            check_query_many<
+                j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>, j::segment_tree_wide<>>>(n);
+        }
+    }
+}
+
+// every left (right) bound and threshold against a linear scan of the prefix (suffix) sums
+template <class Tree> void check_binary_search(std::size_t n) {
+    std::vector<int64_t> ref(n);
+    std::mt19937 rng(static_cast<unsigned>(n));
+    for (auto &x : ref) {
+        x = static_cast<int64_t>(rng() % 5);
+    }
+    Tree tree(ref.begin(), ref.end());
+    for (std::size_t bound = 0; bound <= n; ++bound) {
+        for (int64_t limit : {0, 1, 3, 10, 1000}) {
+            const auto below = [limit](int64_t sum) { return sum <= limit; };
+            std::size_t right = bound;
+            for (int64_t sum = 0; right < n && sum + ref[right] <= limit; ++right) {
+                sum += ref[right];
+            }
+            REQUIRE(tree.max_right(bound, below) == right);
+            std::size_t left = bound;
+            for (int64_t sum = 0; left > 0 && sum + ref[left - 1] <= limit; --left) {
+                sum += ref[left - 1];
+            }
+            REQUIRE(tree.min_left(bound, below) == left);
+        }
+    }
+}
+
+TEST_CASE("Segment Tree Binary Search") {
+    for (std::size_t n : {0, 1, 2, 5, 8, 13, 64, 100}) {
+        check_binary_search<j::segment_tree<int64_t>>(n);
+        check_binary_search<j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>,
+                                            j::segment_tree_wide<>>>(n);
+        check_binary_search<j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>,
+                                            j::segment_tree_wide<3>>>(n);
+        check_binary_search<j::lazy_segment_tree<int64_t>>(n);
+    }
+
+    SECTION("Lazy tags are pushed on the way down") {
+        j::lazy_segment_tree<int64_t> tree(16);
+        tree.update(4, 11, 2);
+        const auto below = [](int64_t sum) { return sum <= 5; };
+        REQUIRE(tree.max_right(0, below) == 6);
+        REQUIRE(tree.min_left(16, below) == 10);
+        REQUIRE(tree.max_right(12, below) == 16);
+    }
+}
+
+constexpr int64_t MOD = 998244353;
+
+struct mod_plus {
+    int64_t operator()(int64_t lhs, int64_t rhs) const {
+        return (lhs + rhs) % MOD;
+    }
+    int64_t identity() const {
+        return 0;
+    }
+};
+
+// x -> first * x + second, composed as (old, new) -> new after old
+struct affine {
+    std::pair<int64_t, int64_t> operator()(const std::pair<int64_t, int64_t> &old,
+                                           const std::pair<int64_t, int64_t> &tag) const {
+        return {tag.first * old.first % MOD, (tag.first * old.second + tag.second) % MOD};
+    }
+    std::pair<int64_t, int64_t> identity() const {
+        return {1, 0};
+    }
+};
+
+struct affine_to_sum {
+    int64_t operator()(const std::pair<int64_t, int64_t> &tag, int64_t sum, std::size_t length) const {
+        return (tag.first * sum + tag.second * static_cast<int64_t>(length % MOD)) % MOD;
+    }
+};
+
+// every [l, r) against prefix sums of ref: all of them for small trees, random ones otherwise. A range query reads
+// internal nodes on every level, so a wrong node shows up where leaf comparisons would not see it
+template <class Tree> void check_ranges(Tree &tree, const std::vector<int64_t> &ref, std::mt19937 &rng) {
+    const std::size_t n = ref.size();
+    std::vector<int64_t> prefix(n + 1, 0);
+    std::partial_sum(ref.begin(), ref.end(), prefix.begin() + 1);
+    if (n <= 100) {
+        for (std::size_t l = 0; l <= n; ++l) {
+            for (std::size_t r = l; r <= n; ++r) {
+                REQUIRE(static_cast<int64_t>(tree.query(l, r)) == prefix[r] - prefix[l]);
+            }
+        }
+        return;
+    }
+    for (int round = 0; round < 500; ++round) {
+        std::size_t l = rng() % (n + 1), r = rng() % (n + 1);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        REQUIRE(static_cast<int64_t>(tree.query(l, r)) == prefix[r] - prefix[l]);
+    }
+}
+
+// update_many and a parallel build answer every range query as the one-by-one updates and the sequential build do
+template <class Layout> void check_bulk(std::size_t n) {
+    using tree_type = j::segment_tree<int64_t, std::allocator<int64_t>, j::plus<int64_t>, Layout>;
+    auto ref = random_values(n, static_cast<unsigned>(n) + 11);
+    tree_type sequential(ref.begin(), ref.end());
+    tree_type parallel;
+    parallel.assign(j::execution::par, ref.begin(), ref.end());
+    REQUIRE(parallel.is_built());
+    REQUIRE(std::ranges::equal(parallel.data(), sequential.data()));
+    std::mt19937 rng(static_cast<unsigned>(n));
+    check_ranges(parallel, ref, rng);
+
+    for (std::size_t count : {std::size_t{1}, std::size_t{7}, n / 50 + 1, n / 3 + 1, 2 * n}) {
+        std::vector<std::pair<std::size_t, int64_t>> updates;
+        for (std::size_t i = 0; i < count; ++i) {
+            updates.emplace_back(rng() % std::min<std::size_t>(n, count + 3), static_cast<int64_t>(rng() % 1000));
+        }
+        for (const auto &[pos, value] : updates) {
+            sequential.update(pos, value);
+            ref[pos] = value;
+        }
+        parallel.update_many(updates);
+        REQUIRE(std::ranges::equal(parallel.data(), sequential.data()));
+        check_ranges(parallel, ref, rng);
+        check_ranges(sequential, ref, rng);
+    }
+    parallel.update_many({});
+    check_ranges(parallel, ref, rng);
+}
+
+TEST_CASE("Segment Tree Bulk Operations") {
+    for (std::size_t n : {1, 2, 3, 100, 1000, 100000}) {
+        check_bulk<j::segment_tree_binary>(n);
+        check_bulk<j::segment_tree_wide<>>(n);
+        check_bulk<j::segment_tree_wide<4>>(n);
+    }
+}
+
+TEST_CASE("Lazy Segment Tree") {
+    SECTION("Range add and range sum against a reference") {
+        for (std::size_t n : {1, 5, 64, 1000}) {
+            auto ref = random_values(n, 3);
+            j::lazy_segment_tree<int64_t> tree(ref.begin(), ref.end());
+            std::mt19937 rng(4);
+            for (int round = 0; round < 1000; ++round) {
+                std::size_t l = rng() % n, r = rng() % n;
+                if (l > r) {
+                    std::swap(l, r);
+                }
+                const int64_t value = static_cast<int64_t>(rng() % 201) - 100;
+                switch (rng() % 3) {
+                case 0:
+                    tree.update(l, r, value);
+                    for (std::size_t i = l; i <= r; ++i) {
+                        ref[i] += value;
+                    }
+                    break;
+                case 1:
+                    tree.update(l, value);
+                    ref[l] += value;
+                    break;
+                default:
+                    REQUIRE(static_cast<int64_t>(tree.query(l, r)) ==
+                            std::accumulate(ref.begin() + l, ref.begin() + r + 1, 0LL));
+                    REQUIRE(static_cast<int64_t>(tree.query(r)) == ref[r]);
+                }
+            }
+            REQUIRE(std::equal(tree.data().begin(), tree.data().end(), ref.begin(), ref.end()));
+        }
+    }
+
+    SECTION("Range add on a max tree") {
+        auto ref = random_values(N, 5);
+        using max_add_tree =
+            j::lazy_segment_tree<int64_t, std::allocator<int64_t>, j::max<int64_t>, j::plus<int64_t>,
+                                 j::add_to_max<int64_t>>;
+        max_add_tree tree(ref.begin(), ref.end());
+        std::mt19937 rng(6);
+        for (int round = 0; round < 1000; ++round) {
+            std::size_t l = rng() % N, r = rng() % N;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            if (rng() & 1) {
+                const int64_t value = static_cast<int64_t>(rng() % 201) - 100;
+                tree.update(l, r, value);
+                for (std::size_t i = l; i <= r; ++i) {
+                    ref[i] += value;
+                }
+            } else {
+                REQUIRE(static_cast<int64_t>(tree.query(l, r)) ==
+                        *std::max_element(ref.begin() + l, ref.begin() + r + 1));
+            }
+        }
+    }
+
+    SECTION("Affine tags of a different type than the values") {
+        auto ref = random_values(N, 7);
+        for (auto &x : ref) {
+            x = (x + 1000) % MOD;
+        }
+        j::lazy_segment_tree<int64_t, std::allocator<int64_t>, mod_plus, affine, affine_to_sum> tree(ref.begin(),
+                                                                                                     ref.end());
+        std::mt19937 rng(8);
+        for (int round = 0; round < 1000; ++round) {
+            std::size_t l = rng() % N, r = rng() % N;
+            if (l > r) {
+                std::swap(l, r);
+            }
+            if (rng() & 1) {
+                const std::pair<int64_t, int64_t> tag(rng() % MOD, rng() % MOD);
+                tree.update(l, r, tag);
+                for (std::size_t i = l; i <= r; ++i) {
+                    ref[i] = (tag.first * ref[i] + tag.second) % MOD;
+                }
+            } else {
+                int64_t expected = 0;
+                for (std::size_t i = l; i <= r; ++i) {
+                    expected = (expected + ref[i]) % MOD;
+                }
+                REQUIRE(static_cast<int64_t>(tree.query(l, r)) == expected);
+            }
+        }
+    }
+
+    SECTION("Copy, move and flush") {
+        j::lazy_segment_tree<int> a = {1, 2, 3, 4, 5};
+        a.update(1, 3, 10);
+        j::lazy_segment_tree<int> b = a;
+        REQUIRE(b.query(0, 4) == 45);
+        j::lazy_segment_tree<int> c = std::move(a);
+        REQUIRE(a.empty());
+        REQUIRE(c.query(2) == 13);
+
+        c.flush();
+        const std::vector<int> expected = {1, 12, 13, 14, 5};
+        REQUIRE(std::equal(c.data().begin(), c.data().end(), expected.begin(), expected.end()));
+        REQUIRE(c.resize(3) == 3);
+        REQUIRE(c.query(0, 2) == 0);
+    }
+}
+
+TEST_CASE("Persistent Segment Tree") {
+    SECTION("Every version against its own reference") {
+        const auto initial = random_values(N, 9);
+        j::persistent_segment_tree<int64_t> tree(initial.begin(), initial.end());
+        REQUIRE(tree.size() == N);
+        REQUIRE(tree.node_count() == 2 * N - 1);
+        std::vector<j::persistent_segment_tree<int64_t>::version> versions = {tree.initial()};
+        std::vector<std::vector<int64_t>> refs = {initial};
+        std::mt19937 rng(10);
+        for (int round = 0; round < 500; ++round) {
+            const std::size_t from = rng() % versions.size(), pos = rng() % N;
+            const int64_t value = static_cast<int64_t>(rng() % 2001) - 1000;
+            versions.push_back(tree.update(versions[from], pos, value));
+            refs.push_back(refs[from]);
+            refs.back()[pos] = value;
+        }
+        REQUIRE(tree.node_count() <= 2 * N - 1 + 500 * 11);
+        for (int round = 0; round < 2000; ++round) {
+            const std::size_t v = rng() % versions.size();
+            std::size_t l = rng() % N, r = rng() % (N + 1);
+            if (l > r) {
+                std::swap(l, r);
+            }
+            REQUIRE(tree.query(versions[v], l, r) == std::accumulate(refs[v].begin() + l, refs[v].begin() + r, 0LL));
+            REQUIRE(tree.query(versions[v], l) == refs[v][l]);
+        }
+    }
+
+    SECTION("Collect keeps the given versions and reuses the rest") {
+        j::persistent_segment_tree<int> tree(8);
+        std::vector<j::persistent_segment_tree<int>::version> versions = {tree.initial()};
+        for (int i = 1; i <= 100; ++i) {
+            versions.push_back(tree.update(versions.back(), static_cast<std::size_t>(i) % 8, i));
+        }
+        REQUIRE(tree.node_count() == 15 + 100 * 4);
+        const auto last = versions.back();
+        const int sum = tree.query(last, 0, 8);
+        tree.collect(std::span(&last, 1));
+        REQUIRE(tree.node_count() == 15);
+        REQUIRE(tree.query(last, 0, 8) == sum);
+        REQUIRE(tree.initial() == j::persistent_segment_tree<int>::version());
+
+        const auto next = tree.update(last, 3, 0);
+        REQUIRE(tree.node_count() == 19);
+        REQUIRE(tree.query(next, 0, 8) == sum - 99);
+        REQUIRE(tree.query(last, 3) == 99);
+    }
+
+    SECTION("Non-commutative operators and copies") {
+        std::vector<std::pair<int64_t, int64_t>> values;
+        for (int64_t i = 0; i < 50; ++i) {
+            values.emplace_back(i, i);
+        }
+        j::persistent_segment_tree<std::pair<int64_t, int64_t>, std::allocator<std::pair<int64_t, int64_t>>, first_last>
+            tree(values.begin(), values.end());
+        const auto v = tree.update(tree.initial(), 0, {-1, -1});
+        REQUIRE(tree.query(tree.initial(), 0, 50) == std::pair<int64_t, int64_t>(0, 49));
+        REQUIRE(tree.query(v, 0, 50) == std::pair<int64_t, int64_t>(-1, 49));
+        REQUIRE(tree.query(v, 10, 20) == std::pair<int64_t, int64_t>(10, 19));
+
+        auto copy = tree;
+        auto moved = std::move(tree);
+        REQUIRE(tree.empty());
+        REQUIRE(copy.query(v, 0, 1) == std::pair<int64_t, int64_t>(-1, -1));
+        REQUIRE(moved.query(v, 0, 50) == std::pair<int64_t, int64_t>(-1, 49));
+        moved.clear();
+        REQUIRE(moved.node_count() == 0);
+    }
+}
+
+TEST_CASE("Dynamic Segment Tree") {
+    SECTION("Range add and range sum against a reference") {
+        constexpr int64_t FIRST = -500, LAST = 499;
+        std::vector<int64_t> ref(LAST - FIRST + 1, 0);
+        j::dynamic_segment_tree<int64_t> tree(FIRST, LAST);
+        std::mt19937 rng(11);
+        for (int round = 0; round < 2000; ++round) {
+            int64_t l = FIRST + static_cast<int64_t>(rng() % ref.size());
+            int64_t r = FIRST + static_cast<int64_t>(rng() % ref.size());
+            if (l > r) {
+                std::swap(l, r);
+            }
+            if (rng() & 1) {
+                const int64_t value = static_cast<int64_t>(rng() % 201) - 100;
+                tree.update(l, r, value);
+                for (int64_t i = l; i <= r; ++i) {
+                    ref[i - FIRST] += value;
+                }
+            } else {
+                const auto begin = ref.begin() + (l - FIRST);
+                const auto expected = std::accumulate(begin, begin + (r - l + 1), int64_t{0});
+                REQUIRE(tree.query(l, r) == expected);
+                REQUIRE(tree.query(l) == ref[l - FIRST]);
+            }
+        }
+    }
+
+    SECTION("Only touched nodes over a 64-bit domain") {
+        constexpr int64_t FIRST = std::numeric_limits<int64_t>::min() / 2;
+        constexpr int64_t LAST = std::numeric_limits<int64_t>::max() / 2;
+        j::dynamic_segment_tree<int64_t> tree(FIRST, LAST);
+        REQUIRE(tree.node_count() == 0);
+        REQUIRE(tree.query(FIRST, LAST) == 0);
+        tree.update(1700000000000LL, 5);
+        tree.update(-42, 7);
+        REQUIRE(tree.node_count() <= 2 * 64);
+        REQUIRE(tree.query(FIRST, LAST) == 12);
+        REQUIRE(tree.query(-42) == 7);
+        REQUIRE(tree.query(-41, 1699999999999LL) == 0);
+
+        tree.update(0, 9, 1); // a range tag covers 10 keys without materializing them
+        REQUIRE(tree.query(FIRST, LAST) == 22);
+        REQUIRE(tree.query(5, 100) == 5);
+        REQUIRE(tree.node_count() <= 6 * 64);
+
+        auto moved = std::move(tree);
+        REQUIRE(tree.node_count() == 0);
+        REQUIRE(tree.query(FIRST, LAST) == 0);
+        REQUIRE(moved.query(-100, 100) == 17);
+        moved.clear();
+        REQUIRE(moved.query(FIRST, LAST) == 0);
+        REQUIRE(moved.first() == FIRST);
+    }
+
+    SECTION("Coordinate compression") {
+        j::coordinate_compression<int64_t> keys(j::vector<int64_t>{1000000007, -5, 42, 42, 1000000007, 7});
+        REQUIRE(keys.size() == 4);
+        REQUIRE(keys.index(-5) == 0);
+        REQUIRE(keys.index(42) == 2);
+        REQUIRE(keys.index(43) == 3);
+        REQUIRE(keys.index(2000000000) == 4);
+        REQUIRE(keys.key(3) == 1000000007);
+        REQUIRE(keys.contains(7));
+        REQUIRE_FALSE(keys.contains(8));
+        REQUIRE(std::is_sorted(keys.keys().begin(), keys.keys().end()));
+
+        j::segment_tree<int64_t> tree(keys.size());
+        tree.update(keys.index(42), 3);
+        tree.update(keys.index(1000000007), 4);
+        REQUIRE(tree.query(keys.index(0), keys.index(1000000000)) == 3);
+    }
+}
+
+// every range of a small table, random ranges of a large one, against a left fold of the values
+template <class Table, class Operator>
+void check_static_table(const std::vector<typename Table::value_type> &values, Operator op) {
+    const Table table(values.begin(), values.end(), op);
+    const std::size_t n = values.size();
+    REQUIRE(table.size() == n);
+    auto check = [&](std::size_t l, std::size_t r) {
+        auto expected = op.identity();
+        for (std::size_t i = l; i < r; ++i) {
+            expected = op(expected, values[i]);
+        }
+        REQUIRE(table.query(l, r) == expected);
+    };
+    if (n <= 130) {
+        for (std::size_t l = 0; l <= n; ++l) {
+            for (std::size_t r = l; r <= n; ++r) {
+                check(l, r);
+            }
+        }
+    } else {
+        std::mt19937 rng(static_cast<unsigned>(n));
+        for (int round = 0; round < 200; ++round) {
+            std::size_t l = rng() % (n + 1), r = rng() % (n + 1);
+            check(std::min(l, r), std::max(l, r));
+        }
+    }
+}
+
+TEST_CASE("Sparse Table") {
+    SECTION("Idempotent operators") {
+        for (std::size_t n : {0, 1, 2, 3, 31, 32, 33, 130, 5000}) {
+            const auto values = random_values(n, static_cast<unsigned>(n) + 3);
+            check_static_table<j::sparse_table<int64_t>>(values, j::min<int64_t>());
+            check_static_table<j::sparse_table<int64_t, std::allocator<int64_t>, j::max<int64_t>>>(values,
+                                                                                                   j::max<int64_t>());
+            std::vector<int64_t> multiples;
+            for (const auto x : values) {
+                multiples.push_back(x * 6);
+            }
+            check_static_table<j::sparse_table<int64_t, std::allocator<int64_t>, j::gcd<int64_t>>>(multiples,
+                                                                                                   j::gcd<int64_t>());
+        }
+        std::vector<float> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(static_cast<float>((i * 7919) % 1009) / 8.0f);
+        }
+        check_static_table<j::sparse_table<float, std::allocator<float>, j::max<float>>>(values, j::max<float>());
+    }
+
+    SECTION("Construction and point queries") {
+        j::sparse_table table = {5, 3, 8, 1, 9};
+        REQUIRE(table.size() == 5);
+        REQUIRE(table.query(2) == 8);
+        REQUIRE(table.query(0, 5) == 1);
+        REQUIRE(table.query(4, 4) == std::numeric_limits<int>::max());
+
+        j::sparse_table<int> moved = std::move(table);
+        REQUIRE(table.empty());
+        REQUIRE(moved.query(0, 3) == 3);
+        moved.assign({4, 2});
+        REQUIRE(moved.query(0, 2) == 2);
+        moved.clear();
+        REQUIRE(moved.empty());
+    }
+}
+
+TEST_CASE("Disjoint Sparse Table") {
+    SECTION("Associative operators") {
+        for (std::size_t n : {0, 1, 2, 3, 31, 32, 33, 130, 5000}) {
+            const auto values = random_values(n, static_cast<unsigned>(n) + 5);
+            check_static_table<j::disjoint_sparse_table<int64_t>>(values, j::plus<int64_t>());
+            check_static_table<j::disjoint_sparse_table<int64_t, std::allocator<int64_t>, j::min<int64_t>>>(
+                values, j::min<int64_t>());
+        }
+    }
+
+    SECTION("Operand order") {
+        std::vector<std::pair<int64_t, int64_t>> values;
+        for (int64_t i = 0; i < 300; ++i) {
+            values.emplace_back(i, i);
+        }
+        j::disjoint_sparse_table<std::pair<int64_t, int64_t>, std::allocator<std::pair<int64_t, int64_t>>, first_last>
+            table(values.begin(), values.end());
+        for (std::size_t l = 0; l < 300; ++l) {
+            for (std::size_t r = l + 1; r <= 300; r += 3) {
+                REQUIRE(table.query(l, r) == std::pair<int64_t, int64_t>(l, r - 1));
+            }
+        }
+    }
+
+    SECTION("Construction and point queries") {
+        j::disjoint_sparse_table table = {5, 3, 8, 1, 9};
+        REQUIRE(table.query(3) == 1);
+        REQUIRE(table.query(1, 4) == 12);
+        REQUIRE(table.query(2, 2) == 0);
+        auto copy = table;
+        table.clear();
+        REQUIRE(table.empty());
+        REQUIRE(copy.query(0, 5) == 26);
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+import j;
+
+constexpr size_t N = 100000;
+
+TEST_CASE("Thread Pool Submit") {
+    j::thread_pool pool(3);
+    REQUIRE(pool.worker_count() == 3);
+    REQUIRE(pool.concurrency() == 4);
+
+    SECTION("Futures receive the results") {
+        std::vector<std::future<size_t>> results;
+        for (size_t i = 0; i < 1000; ++i) {
+            results.push_back(pool.submit([](size_t x) { return x * x; }, i));
+        }
+        for (size_t i = 0; i < 1000; ++i) {
+            REQUIRE(results[i].get() == i * i);
+        }
+    }
+
+    SECTION("Void tasks and bound arguments") {
+        std::atomic<int> sum{0};
+        std::vector<std::future<void>> results;
+        for (int i = 1; i <= 100; ++i) {
+            results.push_back(pool.submit([&sum](int x) { sum.fetch_add(x); }, i));
+        }
+        for (auto &result : results) {
+            result.get();
+        }
+        REQUIRE(sum.load() == 5050);
+
+        auto text = pool.submit([](std::string s, int n) { return s + std::to_string(n); }, std::string("task"), 7);
+        REQUIRE(text.get() == "task7");
+    }
+
+    SECTION("Exceptions reach the future") {
+        auto result = pool.submit([]() -> int { throw std::runtime_error("fail"); });
+        REQUIRE_THROWS_AS(result.get(), std::runtime_error);
+    }
+
+    SECTION("submit_then passes the result on") {
+        std::atomic<size_t> sum{0};
+        std::atomic<size_t> calls{0};
+        std::promise<void> finished;
+        const size_t count = 500;
+        for (size_t i = 0; i < count; ++i) {
+            pool.submit_then([i] { return i; },
+                             [&](size_t x) {
+                                 sum.fetch_add(x);
+                                 if (calls.fetch_add(1) + 1 == count)
+                                     finished.set_value();
+                             });
+        }
+        finished.get_future().wait();
+        REQUIRE(sum.load() == count * (count - 1) / 2);
+    }
+
+    SECTION("Tasks may submit tasks") {
+        std::atomic<int> leaves{0};
+        std::vector<std::future<void>> outer;
+        for (int i = 0; i < 16; ++i) {
+            outer.push_back(pool.submit([&] {
+                for (int k = 0; k < 16; ++k) {
+                    pool.submit_then([] {}, [&] { leaves.fetch_add(1); });
+                }
+            }));
+        }
+        for (auto &result : outer) {
+            result.get();
+        }
+        while (leaves.load() != 256) {
+            std::this_thread::yield();
+        }
+        REQUIRE(leaves.load() == 256);
+    }
+}
+
+TEST_CASE("Thread Pool Destruction") {
+    SECTION("Every submitted task runs before the workers join") {
+        std::atomic<int> runs{0};
+        {
+            j::thread_pool pool(2);
+            for (int i = 0; i < 1000; ++i) {
+                pool.submit_then([] {}, [&] { runs.fetch_add(1); });
+            }
+        }
+        REQUIRE(runs.load() == 1000);
+    }
+
+    SECTION("A pool without workers runs parallel_for inline") {
+        j::thread_pool pool(0);
+        REQUIRE(pool.concurrency() == 1);
+        std::vector<int> hits(100, 0);
+        pool.parallel_for(0, 100, [&](int i) { ++hits[i]; });
+        REQUIRE(std::count(hits.begin(), hits.end(), 1) == 100);
+    }
+
+    SECTION("A pool without workers runs submitted tasks inline") {
+        j::thread_pool pool(0);
+        REQUIRE(pool.submit([](int x) { return x + 1; }, 41).get() == 42);
+        REQUIRE_THROWS_AS(pool.submit([]() -> int { throw std::runtime_error("fail"); }).get(), std::runtime_error);
+        int calls = 0;
+        pool.submit_then([] { return 2; }, [&](int x) { calls += x; });
+        pool.submit_then([] {}, [&] { ++calls; });
+        REQUIRE(calls == 3);
+    }
+}
+
+TEST_CASE("Thread Pool Parallel For") {
+    j::thread_pool pool(3);
+
+    SECTION("Every index exactly once") {
+        for (size_t grain : {size_t(0), size_t(1), size_t(7), size_t(1000), N}) {
+            std::vector<std::atomic<int>> hits(N);
+            pool.parallel_for(size_t(0), N, [&](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); },
+                              grain);
+            size_t wrong = 0;
+            for (auto &hit : hits) {
+                if (hit.load() != 1)
+                    ++wrong;
+            }
+            REQUIRE(wrong == 0);
+        }
+    }
+
+    SECTION("Signed and empty ranges") {
+        std::atomic<long long> sum{0};
+        pool.parallel_for(-500, 500, [&](int i) { sum.fetch_add(i); }, 1);
+        REQUIRE(sum.load() == -500);
+
+        std::atomic<int> calls{0};
+        pool.parallel_for(10, 10, [&](int) { calls.fetch_add(1); });
+        pool.parallel_for(10, 3, [&](int) { calls.fetch_add(1); });
+        REQUIRE(calls.load() == 0);
+    }
+
+    SECTION("Nested parallel_for") {
+        std::atomic<size_t> total{0};
+        pool.parallel_for(0, 64, [&](int) {
+            pool.parallel_for(0, 1000, [&](int) { total.fetch_add(1, std::memory_order_relaxed); }, 16);
+        }, 1);
+        REQUIRE(total.load() == 64000);
+    }
+
+    SECTION("Exceptions propagate to the caller") {
+        std::atomic<int> calls{0};
+        REQUIRE_THROWS_AS(pool.parallel_for(size_t(0), N,
+                                            [&](size_t i) {
+                                                calls.fetch_add(1, std::memory_order_relaxed);
+                                                if (i == N / 2)
+                                                    throw std::runtime_error("fail");
+                                            },
+                                            1),
+                          std::runtime_error);
+        // the pool is still usable afterwards
+        std::atomic<size_t> count{0};
+        pool.parallel_for(size_t(0), N, [&](size_t) { count.fetch_add(1, std::memory_order_relaxed); });
+        REQUIRE(count.load() == N);
+    }
+
+    SECTION("Called from a submitted task") {
+        auto result = pool.submit([&] {
+            std::atomic<size_t> count{0};
+            pool.parallel_for(size_t(0), N, [&](size_t) { count.fetch_add(1, std::memory_order_relaxed); });
+            return count.load();
+        });
+        REQUIRE(result.get() == N);
+    }
+
+    SECTION("j::par algorithms on a given pool") {
+        j::vector<int> v(N);
+        for (size_t i = 0; i < N; ++i) {
+            v[i] = static_cast<int>((i * 7919) % 1000);
+        }
+        j::par::sort(j::execution::par.on(pool), v.begin(), v.end());
+        REQUIRE(std::is_sorted(v.begin(), v.end()));
+        REQUIRE(j::par::reduce(j::execution::par.on(pool), v.begin(), v.end(), 0LL) ==
+                std::accumulate(v.begin(), v.end(), 0LL));
+    }
+}
+
+TEST_CASE("Thread Pool submit_then exceptions") {
+    SECTION("A throwing callback run by a waiting thread terminates instead of unwinding parallel_for") {
+        // the child process runs a parallel_for whose waiting caller picks up a throwing submit_then job
+        const pid_t child = fork();
+        REQUIRE(child >= 0);
+        if (child == 0) {
+            j::thread_pool pool(1);
+            std::atomic<bool> started{false};
+            try {
+                pool.parallel_for(0, 2, [&](int i) {
+                    if (i == 1) {
+                        started.store(true); // the worker holds this range task and never finishes it
+                        while (true) {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                        }
+                    }
+                    while (!started.load()) {
+                        std::this_thread::yield();
+                    }
+                    pool.submit_then([] {}, [] { throw std::runtime_error("callback"); });
+                }, 1);
+            } catch (...) {
+                _exit(1); // unwound out of parallel_for while the worker still used its frame
+            }
+            _exit(0);
+        }
+        int status = 0;
+        REQUIRE(waitpid(child, &status, 0) == child);
+        REQUIRE(WIFSIGNALED(status));
+        REQUIRE(WTERMSIG(status) == SIGABRT);
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+import j;
+
+TEST_CASE("Timer Wheel Basic") {
+    SECTION("Expires in deadline order") {
+        j::timer_wheel<int> wheel;
+        REQUIRE(wheel.empty());
+        wheel.insert(5, 5);
+        wheel.insert(3, 3);
+        wheel.insert(300, 300);
+        wheel.insert(70000, 70000);
+        wheel.insert(3, 33);
+        REQUIRE(wheel.size() == 5);
+
+        std::vector<int> fired;
+        REQUIRE(wheel.advance(4, [&](int &v) { fired.push_back(v); }) == 2);
+        REQUIRE(fired == std::vector<int>{3, 33});
+        REQUIRE(wheel.now() == 4);
+
+        REQUIRE(wheel.advance(299, [&](int &v) { fired.push_back(v); }) == 1);
+        REQUIRE(wheel.advance(300, [&](int &v) { fired.push_back(v); }) == 1);
+        REQUIRE(wheel.advance(1000000, [&](int &v) { fired.push_back(v); }) == 1);
+        REQUIRE(fired == std::vector<int>{3, 33, 5, 300, 70000});
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("Cancel") {
+        j::timer_wheel<std::string> wheel;
+        auto a = wheel.insert(10, "a");
+        auto b = wheel.insert(5000, "b");
+        auto c = wheel.insert(10, "c");
+        REQUIRE(wheel.pending(a));
+        REQUIRE(wheel.cancel(a));
+        REQUIRE_FALSE(wheel.cancel(a));
+        REQUIRE(wheel.cancel(b));
+        REQUIRE(wheel.size() == 1);
+
+        std::vector<std::string> fired;
+        wheel.advance(10000, [&](std::string &s) { fired.push_back(s); });
+        REQUIRE(fired == std::vector<std::string>{"c"});
+        REQUIRE_FALSE(wheel.pending(c));
+        REQUIRE_FALSE(wheel.cancel(c)); // already fired
+        REQUIRE_FALSE(wheel.pending(decltype(wheel)::handle{}));
+    }
+
+    SECTION("Past deadlines and rescheduling from the callback") {
+        j::timer_wheel<int> wheel(100);
+        wheel.insert(50, 1); // already due
+        std::vector<int> fired;
+        wheel.advance(100, [&](int &v) { fired.push_back(v); });
+        REQUIRE(fired == std::vector<int>{1});
+
+        int ticks = 0;
+        wheel.insert(101, 0);
+        wheel.advance(200, [&](int &v) {
+            ++ticks;
+            if (v < 9)
+                wheel.insert(wheel.now() + 10, v + 1); // periodic timer
+        });
+        REQUIRE(ticks == 10);
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("Callback cancels a timer of the same batch") {
+        j::timer_wheel<int> wheel;
+        j::timer_wheel<int>::handle second;
+        wheel.insert(7, 1);
+        second = wheel.insert(7, 2);
+        std::vector<int> fired;
+        wheel.advance(7, [&](int &v) {
+            fired.push_back(v);
+            wheel.cancel(second);
+        });
+        REQUIRE(fired == std::vector<int>{1});
+        REQUIRE(wheel.empty());
+    }
+
+    SECTION("Throwing callback keeps the rest due") {
+        j::timer_wheel<int> wheel;
+        for (int i = 0; i < 4; ++i) {
+            wheel.insert(9, i);
+        }
+        REQUIRE_THROWS_AS(wheel.advance(20, [](int &v) {
+            if (v == 1)
+                throw std::runtime_error("callback");
+        }),
+                          std::runtime_error);
+        REQUIRE(wheel.size() == 2);
+        std::vector<int> fired;
+        wheel.advance(20, [&](int &v) { fired.push_back(v); });
+        REQUIRE(fired == std::vector<int>{2, 3});
+    }
+
+    SECTION("Values are destroyed") {
+        auto counter = std::make_shared<int>(0);
+        {
+            j::timer_wheel<std::shared_ptr<int>> wheel;
+            for (int i = 0; i < 100; ++i) {
+                wheel.insert(static_cast<std::uint64_t>(i * 1000), counter);
+            }
+            auto h = wheel.insert(5, counter);
+            wheel.cancel(h);
+            wheel.advance(50000, [](std::shared_ptr<int> &) {});
+            REQUIRE(counter.use_count() == 50);
+            wheel.clear();
+            REQUIRE(counter.use_count() == 1);
+            wheel.insert(1u << 30, counter);
+        }
+        REQUIRE(counter.use_count() == 1);
+    }
+}
+
+TEST_CASE("Timer Wheel Random Schedule") {
+    // small wheel (3 levels of 4 slots = 64 ticks) so cascades and the overflow list are exercised
+    j::timer_wheel<std::uint64_t, 2, 3> wheel;
+    std::mt19937_64 rng(3);
+    std::multimap<std::uint64_t, std::uint64_t> reference; // deadline -> id
+    std::map<std::uint64_t, j::timer_wheel<std::uint64_t, 2, 3>::handle> handles;
+    std::uint64_t next_id = 0;
+
+    for (int step = 0; step < 2000; ++step) {
+        for (int k = 0; k < 5; ++k) {
+            const std::uint64_t deadline = wheel.now() + rng() % (rng() % 4 == 0 ? 5000 : 100);
+            const std::uint64_t id = next_id++;
+            handles[id] = wheel.insert(deadline, id);
+            reference.emplace(deadline, id);
+        }
+        if (!handles.empty() && rng() % 2 == 0) {
+            auto it = handles.begin();
+            std::advance(it, static_cast<long>(rng() % handles.size()));
+            REQUIRE(wheel.cancel(it->second));
+            for (auto r = reference.begin(); r != reference.end(); ++r) {
+                if (r->second == it->first) {
+                    reference.erase(r);
+                    break;
+                }
+            }
+            handles.erase(it);
+        }
+
+        const std::uint64_t now = wheel.now() + rng() % 40;
+        std::vector<std::uint64_t> fired;
+        wheel.advance(now, [&](std::uint64_t &id) { fired.push_back(id); });
+
+        std::vector<std::uint64_t> expected;
+        std::uint64_t last_deadline = 0;
+        bool ordered = true;
+        for (std::uint64_t id : fired) {
+            auto r = std::find_if(reference.begin(), reference.end(), [&](const auto &p) { return p.second == id; });
+            REQUIRE(r != reference.end());
+            ordered = ordered && r->first >= last_deadline;
+            last_deadline = r->first;
+        }
+        REQUIRE(ordered);
+        while (!reference.empty() && reference.begin()->first <= now) {
+            expected.push_back(reference.begin()->second);
+            handles.erase(reference.begin()->second);
+            reference.erase(reference.begin());
+        }
+        std::sort(fired.begin(), fired.end());
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(fired == expected);
+        REQUIRE(wheel.size() == reference.size());
+    }
+}
@@ -0,0 +1,333 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+import j;
+
+// small nodes so that splits, merges and refills happen after a handful of operations
+using small_list = j::unrolled_list<int, 64>;
+
+template <class List> std::vector<int> values(const List &l) {
+    return std::vector<int>(l.begin(), l.end());
+}
+
+// counts live instances so leaks and double destructions show up
+struct tracked {
+    static inline int live = 0;
+    int value;
+
+    tracked(int v = 0) : value(v) {
+        ++live;
+    }
+    tracked(const tracked &other) : value(other.value) {
+        ++live;
+    }
+    tracked &operator=(const tracked &) = default;
+    ~tracked() {
+        --live;
+    }
+    bool operator==(const tracked &other) const {
+        return value == other.value;
+    }
+    bool operator<(const tracked &other) const {
+        return value < other.value;
+    }
+};
+
+TEST_CASE("Unrolled List Basic") {
+    SECTION("Iterator Category") {
+        STATIC_REQUIRE(std::bidirectional_iterator<small_list::iterator>);
+        STATIC_REQUIRE(std::bidirectional_iterator<small_list::const_iterator>);
+        STATIC_REQUIRE(small_list::node_capacity == 10);
+        STATIC_REQUIRE(j::unrolled_list<std::string, 32>::node_capacity == 4);
+    }
+
+    SECTION("Constructors and assignment") {
+        small_list empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty.begin() == empty.end());
+
+        small_list filled(25, 7);
+        REQUIRE(filled.size() == 25);
+        REQUIRE(std::all_of(filled.begin(), filled.end(), [](int v) { return v == 7; }));
+
+        small_list il = {1, 2, 3, 4, 5};
+        REQUIRE(values(il) == std::vector<int>{1, 2, 3, 4, 5});
+
+        small_list copy(il);
+        REQUIRE(copy == il);
+        small_list moved(std::move(copy));
+        REQUIRE(copy.empty());
+        REQUIRE(moved == il);
+
+        moved = filled;
+        REQUIRE(moved == filled);
+        moved = {9, 8};
+        REQUIRE(values(moved) == std::vector<int>{9, 8});
+        moved = std::move(il);
+        REQUIRE(values(moved) == std::vector<int>{1, 2, 3, 4, 5});
+        REQUIRE(il.empty());
+
+        swap(moved, filled);
+        REQUIRE(moved.size() == 25);
+        REQUIRE(values(filled) == std::vector<int>{1, 2, 3, 4, 5});
+        REQUIRE(filled < moved);
+    }
+
+    SECTION("Push, pop and element access") {
+        small_list l;
+        for (int i = 0; i < 50; ++i) {
+            l.push_back(i);
+            l.push_front(-i - 1);
+        }
+        REQUIRE(l.size() == 100);
+        REQUIRE(l.front() == -50);
+        REQUIRE(l.back() == 49);
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+
+        std::vector<int> reversed(l.rbegin(), l.rend());
+        REQUIRE(std::is_sorted(reversed.rbegin(), reversed.rend()));
+
+        int &kept = l.front();
+        for (int i = 0; i < 60; ++i) {
+            l.pop_back();
+        }
+        REQUIRE(&kept == &l.front()); // pop_back leaves the other elements in place
+        REQUIRE(l.size() == 40);
+        REQUIRE(l.back() == -11);
+        l.pop_front();
+        REQUIRE(l.front() == -49);
+
+        l.resize(5);
+        REQUIRE(values(l) == std::vector<int>{-49, -48, -47, -46, -45});
+        l.resize(7, 1);
+        REQUIRE(values(l) == std::vector<int>{-49, -48, -47, -46, -45, 1, 1});
+        l.clear();
+        REQUIRE(l.empty());
+    }
+
+    SECTION("Insert and erase in the middle") {
+        small_list l;
+        auto it = l.insert(l.end(), {1, 5});
+        REQUIRE(*it == 1);
+        it = l.insert(std::next(l.begin()), 3, 4);
+        REQUIRE(values(l) == std::vector<int>{1, 4, 4, 4, 5});
+        REQUIRE(*it == 4);
+        REQUIRE(*std::prev(it) == 1);
+
+        for (int i = 0; i < 30; ++i) {
+            l.insert(std::next(l.begin(), static_cast<long>(l.size() / 2)), 100 + i);
+        }
+        REQUIRE(l.size() == 35);
+
+        it = l.erase(std::next(l.begin()), std::prev(l.end()));
+        REQUIRE(*it == 5);
+        REQUIRE(values(l) == std::vector<int>{1, 5});
+
+        // an element inserted from a reference into a full node
+        small_list full(10, 0);
+        std::iota(full.begin(), full.end(), 0);
+        full.insert(std::next(full.begin(), 2), full.back());
+        REQUIRE(values(full) == std::vector<int>{0, 1, 9, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+}
+
+TEST_CASE("Unrolled List Operations") {
+    SECTION("Splice") {
+        small_list a = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        small_list b = {20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+
+        a.splice(std::next(a.begin(), 3), b, std::next(b.begin(), 2), std::next(b.begin(), 12));
+        REQUIRE(values(a) == std::vector<int>{0, 1, 2, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 3, 4, 5, 6, 7, 8, 9,
+                                              10, 11});
+        REQUIRE(values(b) == std::vector<int>{20, 21, 32});
+        REQUIRE(a.size() == 22);
+        REQUIRE(b.size() == 3);
+
+        a.splice(a.begin(), b, std::next(b.begin()));
+        REQUIRE(a.front() == 21);
+        REQUIRE(values(b) == std::vector<int>{20, 32});
+
+        a.splice(std::next(a.begin(), 5), b);
+        REQUIRE(b.empty());
+        REQUIRE(a.size() == 25);
+        REQUIRE(*std::next(a.begin(), 5) == 20);
+        REQUIRE(*std::next(a.begin(), 6) == 32);
+
+        // within one list
+        small_list c = {1, 2, 3, 4, 5, 6};
+        c.splice(c.end(), c, c.begin());
+        REQUIRE(values(c) == std::vector<int>{2, 3, 4, 5, 6, 1});
+        c.splice(c.begin(), c, std::next(c.begin(), 3), c.end());
+        REQUIRE(values(c) == std::vector<int>{5, 6, 1, 2, 3, 4});
+    }
+
+    SECTION("Remove, unique, merge, sort, reverse") {
+        small_list l;
+        for (int i = 0; i < 100; ++i) {
+            l.push_back(i / 3);
+        }
+        REQUIRE(l.unique() == 66);
+        REQUIRE(l.size() == 34);
+        REQUIRE(l.remove_if([](int v) { return v % 2 == 1; }) == 17);
+        REQUIRE(l.remove(0) == 1);
+        REQUIRE(j::erase(l, 2) == 1);
+        REQUIRE(l.front() == 4);
+
+        small_list odd;
+        for (int i = 1; i < 70; i += 2) {
+            odd.push_back(i);
+        }
+        l.merge(odd);
+        REQUIRE(odd.empty());
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+        REQUIRE(l.size() == 15 + 35);
+
+        l.reverse();
+        REQUIRE(std::is_sorted(l.rbegin(), l.rend()));
+        l.sort();
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+        l.sort(std::greater<int>());
+        REQUIRE(std::is_sorted(l.rbegin(), l.rend()));
+    }
+
+    SECTION("Sort is stable") {
+        j::unrolled_list<std::pair<int, int>, 64> l;
+        for (int i = 0; i < 200; ++i) {
+            l.emplace_back(i % 7, i);
+        }
+        l.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+        REQUIRE(std::is_sorted(l.begin(), l.end()));
+    }
+}
+
+TEST_CASE("Unrolled List Random Operations") {
+    // differential test against std::list with the smallest possible nodes
+    std::mt19937 rng(17);
+    {
+        j::unrolled_list<tracked, 8> l;
+        STATIC_REQUIRE(decltype(l)::node_capacity == 4);
+        std::list<int> reference;
+        for (int step = 0; step < 5000; ++step) {
+            const auto op = rng() % 8;
+            const auto pos = reference.empty() ? 0 : rng() % (reference.size() + 1);
+            auto lit = std::next(l.begin(), static_cast<long>(pos));
+            auto rit = std::next(reference.begin(), static_cast<long>(pos));
+            const int v = static_cast<int>(rng() % 1000);
+            if (op < 3) {
+                auto inserted = l.insert(lit, tracked(v));
+                reference.insert(rit, v);
+                REQUIRE(inserted->value == v);
+            } else if (op < 5 && !reference.empty()) {
+                if (pos == reference.size()) {
+                    l.pop_back();
+                    reference.pop_back();
+                } else {
+                    auto next = l.erase(lit);
+                    auto rnext = reference.erase(rit);
+                    REQUIRE((next == l.end()) == (rnext == reference.end()));
+                    if (rnext != reference.end())
+                        REQUIRE(next->value == *rnext);
+                }
+            } else if (op == 5 && pos < reference.size()) {
+                const auto count = rng() % (reference.size() - pos + 1);
+                auto next = l.erase(lit, std::next(lit, static_cast<long>(count)));
+                auto rnext = reference.erase(rit, std::next(rit, static_cast<long>(count)));
+                REQUIRE((next == l.end()) == (rnext == reference.end()));
+            } else if (op == 6) {
+                l.push_front(tracked(v));
+                reference.push_front(v);
+            } else {
+                l.push_back(tracked(v));
+                reference.push_back(v);
+            }
+            REQUIRE(l.size() == reference.size());
+            if (step % 50 == 0) {
+                std::vector<int> got;
+                for (const tracked &t : l) {
+                    got.push_back(t.value);
+                }
+                REQUIRE(got == std::vector<int>(reference.begin(), reference.end()));
+            }
+        }
+        REQUIRE(tracked::live == static_cast<int>(reference.size()));
+    }
+    REQUIRE(tracked::live == 0);
+}
+
+// copies and moves that throw every so often; splits, merges and shifts must neither leak nor destroy twice
+struct brittle {
+    static inline int live = 0;
+    static inline int countdown = 0; // the construction that brings it to 0 throws
+    int value;
+
+    static void tick() {
+        if (countdown > 0 && --countdown == 0)
+            throw std::runtime_error("brittle");
+    }
+    brittle(int v = 0) : value(v) {
+        ++live;
+    }
+    brittle(const brittle &other) : value(other.value) {
+        tick();
+        ++live;
+    }
+    brittle(brittle &&other) : value(other.value) {
+        tick();
+        ++live;
+    }
+    brittle &operator=(const brittle &other) {
+        tick();
+        value = other.value;
+        return *this;
+    }
+    brittle &operator=(brittle &&other) {
+        tick();
+        value = other.value;
+        return *this;
+    }
+    ~brittle() {
+        --live;
+    }
+};
+
+TEST_CASE("Unrolled List Throwing Element Moves") {
+    std::mt19937 rng(23);
+    {
+        j::unrolled_list<brittle, 8> l;
+        int thrown = 0;
+        for (int step = 0; step < 5000; ++step) {
+            brittle::countdown = static_cast<int>(rng() % 6);
+            const auto pos = l.empty() ? 0 : rng() % (l.size() + 1);
+            try {
+                auto it = std::next(l.begin(), static_cast<long>(pos));
+                if (rng() % 5 < 3) {
+                    l.emplace(it, static_cast<int>(step));
+                } else if (pos < l.size()) {
+                    const auto count = rng() % 2 == 0 ? 1 : rng() % (l.size() - pos + 1);
+                    l.erase(it, std::next(it, static_cast<long>(count)));
+                }
+            } catch (const std::runtime_error &) {
+                ++thrown;
+            }
+            brittle::countdown = 0;
+            REQUIRE(static_cast<std::size_t>(std::distance(l.begin(), l.end())) == l.size());
+            REQUIRE(brittle::live == static_cast<int>(l.size()));
+        }
+        REQUIRE(thrown > 0);
+    }
+    REQUIRE(brittle::live == 0);
+}
@@ -0,0 +1,141 @@
+/*
+ * @ Created by jaehyung409 on 26. 10. 18.
+ * @ Copyright (c) 2026 jaehyung409
+ * This software is licensed under the MIT License.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+import j;
+
+constexpr size_t N = 100000;
+
+TEST_CASE("Work Stealing Deque Basic") {
+    SECTION("Owner pops newest first") {
+        j::work_stealing_deque<int> d(4);
+        REQUIRE(d.empty());
+        REQUIRE(d.capacity() == 4);
+        for (int i = 0; i < 3; ++i) {
+            d.push(i);
+        }
+        REQUIRE(d.size() == 3);
+
+        int out = -1;
+        for (int i = 2; i >= 0; --i) {
+            REQUIRE(d.try_pop(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE_FALSE(d.try_pop(out));
+        REQUIRE(d.empty());
+    }
+
+    SECTION("Thieves steal oldest first") {
+        j::work_stealing_deque<int> d;
+        for (int i = 0; i < 5; ++i) {
+            d.push(i);
+        }
+        int out = -1;
+        REQUIRE(d.try_steal(out));
+        REQUIRE(out == 0);
+        REQUIRE(d.try_steal(out));
+        REQUIRE(out == 1);
+        REQUIRE(d.try_pop(out));
+        REQUIRE(out == 4);
+        REQUIRE(d.size() == 2);
+        REQUIRE(d.try_steal(out));
+        REQUIRE(out == 2);
+        REQUIRE(d.try_pop(out));
+        REQUIRE(out == 3);
+        REQUIRE_FALSE(d.try_steal(out));
+        REQUIRE_FALSE(d.try_pop(out));
+    }
+
+    SECTION("Growth keeps the order") {
+        j::work_stealing_deque<int> d(2);
+        int out = -1;
+        // move top away from 0 first, so the copy into the bigger ring wraps
+        d.push(-1);
+        REQUIRE(d.try_steal(out));
+        for (int i = 0; i < 1000; ++i) {
+            d.push(i);
+        }
+        REQUIRE(d.capacity() >= 1000);
+        REQUIRE(d.size() == 1000);
+        for (int i = 0; i < 500; ++i) {
+            REQUIRE(d.try_steal(out));
+            REQUIRE(out == i);
+        }
+        for (int i = 999; i >= 500; --i) {
+            REQUIRE(d.try_pop(out));
+            REQUIRE(out == i);
+        }
+        REQUIRE(d.empty());
+    }
+
+    SECTION("Interleaved push and pop") {
+        j::work_stealing_deque<size_t> d(8);
+        size_t out = 0;
+        for (size_t round = 0; round < 100; ++round) {
+            for (size_t k = 0; k < round % 13; ++k) {
+                d.push(round * 100 + k);
+            }
+            for (size_t k = round % 13; k > 0; --k) {
+                REQUIRE(d.try_pop(out));
+                REQUIRE(out == round * 100 + k - 1);
+            }
+        }
+        REQUIRE(d.empty());
+    }
+}
+
+TEST_CASE("Work Stealing Deque Concurrent") {
+    SECTION("Every element is taken exactly once") {
+        const size_t thief_count = 3;
+        j::work_stealing_deque<size_t> d(16);
+        std::vector<std::atomic<int>> taken(N);
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> thieves;
+        for (size_t t = 0; t < thief_count; ++t) {
+            thieves.emplace_back([&] {
+                size_t value;
+                while (!done.load(std::memory_order_acquire)) {
+                    if (d.try_steal(value))
+                        taken[value].fetch_add(1, std::memory_order_relaxed);
+                    else
+                        std::this_thread::yield();
+                }
+                while (d.try_steal(value)) {
+                    taken[value].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        // the owner pushes in bursts and pops some back, racing the thieves for the last element
+        size_t value;
+        for (size_t i = 0; i < N; ++i) {
+            d.push(i);
+            if (i % 3 == 0 && d.try_pop(value))
+                taken[value].fetch_add(1, std::memory_order_relaxed);
+        }
+        while (d.try_pop(value)) {
+            taken[value].fetch_add(1, std::memory_order_relaxed);
+        }
+        done.store(true, std::memory_order_release);
+        for (auto &thief : thieves) {
+            thief.join();
+        }
+
+        size_t wrong = 0;
+        for (auto &count : taken) {
+            if (count.load() != 1)
+                ++wrong;
+        }
+        REQUIRE(wrong == 0);
+        REQUIRE(d.empty());
+    }
+}